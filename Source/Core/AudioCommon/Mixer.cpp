@@ -12,6 +12,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Common/Trace.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "VideoCommon/PerformanceMetrics.h"
@@ -160,6 +161,8 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   if (!samples)
     return 0;
 
+  TRACE_SCOPE("Audio mix");
+
   memset(samples, 0, num_samples * 2 * sizeof(short));
 
   // TODO: Determine how emulation speed will be used in audio
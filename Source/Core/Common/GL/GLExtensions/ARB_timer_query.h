@@ -0,0 +1,21 @@
+/*
+** Copyright (c) 2013-2015 The Khronos Group Inc.
+** SPDX-License-Identifier: MIT
+*/
+
+#include "Common/GL/GLExtensions/gl_common.h"
+
+#define GL_TIME_ELAPSED 0x88BF
+#define GL_TIMESTAMP 0x8E28
+
+typedef void(APIENTRYP PFNDOLQUERYCOUNTERPROC)(GLuint id, GLenum target);
+typedef void(APIENTRYP PFNDOLGETQUERYOBJECTI64VPROC)(GLuint id, GLenum pname, GLint64* params);
+typedef void(APIENTRYP PFNDOLGETQUERYOBJECTUI64VPROC)(GLuint id, GLenum pname, GLuint64* params);
+
+extern PFNDOLQUERYCOUNTERPROC dolQueryCounter;
+extern PFNDOLGETQUERYOBJECTI64VPROC dolGetQueryObjecti64v;
+extern PFNDOLGETQUERYOBJECTUI64VPROC dolGetQueryObjectui64v;
+
+#define glQueryCounter dolQueryCounter
+#define glGetQueryObjecti64v dolGetQueryObjecti64v
+#define glGetQueryObjectui64v dolGetQueryObjectui64v
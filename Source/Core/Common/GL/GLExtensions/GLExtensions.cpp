@@ -907,6 +907,11 @@ PFNDOLTEXSTORAGE3DPROC dolTexStorage3D;
 PFNDOLTEXSTORAGE2DMULTISAMPLEPROC dolTexStorage2DMultisample;
 PFNDOLTEXSTORAGE3DMULTISAMPLEPROC dolTexStorage3DMultisample;
 
+// ARB_timer_query
+PFNDOLQUERYCOUNTERPROC dolQueryCounter;
+PFNDOLGETQUERYOBJECTI64VPROC dolGetQueryObjecti64v;
+PFNDOLGETQUERYOBJECTUI64VPROC dolGetQueryObjectui64v;
+
 // ARB_ES2_compatibility
 PFNDOLCLEARDEPTHFPROC dolClearDepthf;
 PFNDOLDEPTHRANGEFPROC dolDepthRangef;
@@ -1970,6 +1975,11 @@ const GLFunc gl_function_array[] = {
     GLFUNC_SUFFIX(glTexStorage3DMultisample, OES,
                   "GL_OES_texture_storage_multisample_2d_array !VERSION_GLES_3_2"),
 
+    // ARB_timer_query
+    GLFUNC_REQUIRES(glQueryCounter, "GL_ARB_timer_query"),
+    GLFUNC_REQUIRES(glGetQueryObjecti64v, "GL_ARB_timer_query"),
+    GLFUNC_REQUIRES(glGetQueryObjectui64v, "GL_ARB_timer_query"),
+
     // ARB_ES2_compatibility
     GLFUNC_REQUIRES(glClearDepthf, "GL_ARB_ES2_compatibility |VERSION_GLES_2"),
     GLFUNC_REQUIRES(glDepthRangef, "GL_ARB_ES2_compatibility |VERSION_GLES_2"),
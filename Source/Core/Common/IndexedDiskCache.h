@@ -0,0 +1,718 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/MappedFile.h"
+#include "Common/Random.h"
+#include "Common/Thread.h"
+#include "Common/Version.h"
+
+// On disk format:
+// Data file, append-only between compactions:
+// header{
+// u32 'DCIX';
+// u16 sizeof(key_type);
+// u16 sizeof(value_type);
+// u64 file_id;  // random, changes whenever the file is recreated or compacted
+// char version[40];
+//}
+
+// record{
+// u32 value_size;
+// u32 value_crc32;
+// u64 key_hash;
+// key_type   key;
+// value_type[value_size]   value;
+//}
+
+// Index file (<filename>.idx), rewritten by Sync() and Close():
+// header{
+// u32 'DCID';
+// u32 session;
+// u64 file_id;
+// u64 data_size;  // records past this offset are recovered by scanning the data file
+// u64 dead_bytes;
+// u64 num_entries;
+//}
+
+// entry{
+// u64 key_hash;
+// u64 offset;
+// u32 value_size;
+// u32 last_session;
+//}
+
+namespace Common
+{
+template <typename K, typename V>
+class IndexedDiskCacheReader
+{
+public:
+  virtual void Read(const K& key, const V* value, u32 value_size) = 0;
+};
+
+// Key-value store for caching generated shader bytecode and pipeline data between executions.
+//
+// Records are addressed by a hash of their key. An index of the live records is kept next to the
+// data file, so opening the cache does not read the records themselves, and values are read
+// lazily out of a memory mapping of the data file.
+//
+// Appending a key which is already present replaces its record. Replaced records, and records
+// evicted because the cache grew beyond its size limit, are reclaimed by compacting the data file
+// on a background thread once they make up a large enough part of it.
+//
+// Keys and values can contain any characters, including \0.
+// Does not support values larger than 4GB. Values can have zero length.
+
+// K and V are some POD type
+// K : the key type
+// V : value array type
+template <typename K, typename V>
+class IndexedDiskCache
+{
+public:
+  IndexedDiskCache() = default;
+  ~IndexedDiskCache() { Close(); }
+
+  IndexedDiskCache(const IndexedDiskCache&) = delete;
+  IndexedDiskCache& operator=(const IndexedDiskCache&) = delete;
+
+  // Opens the cache, discarding its contents if it was written with a different version string.
+  // Returns the number of entries.
+  u32 Open(const std::string& filename, std::string_view version = Common::GetScmRevGitStr())
+  {
+    // Since we're reading/writing directly to the storage of K and V instances,
+    // they must be trivially copyable.
+    static_assert(std::is_trivially_copyable_v<K>, "K must be a trivially copyable type");
+    static_assert(std::is_trivially_copyable_v<V>, "V must be a trivially copyable type");
+
+    Close();
+    m_filename = filename;
+    m_header.Init(version);
+    m_index_dirty = false;
+
+    Header file_header;
+    m_file.Open(filename, "r+b");
+    if (!m_file.ReadArray(&file_header, 1) || !m_header.IsCompatible(file_header))
+    {
+      // Failed to open file for reading or bad header, recreate the file.
+      CreateDataFile();
+      return 0;
+    }
+
+    m_header.file_id = file_header.file_id;
+    const u64 file_size = m_file.GetSize();
+
+    // Values are read out of the mapping when possible, and through m_file otherwise.
+    m_mapping.Open(filename);
+
+    u64 scan_start = sizeof(Header);
+    if (ReadIndex(file_size))
+    {
+      scan_start = m_data_size;
+    }
+    else
+    {
+      m_index.clear();
+      m_live_bytes = 0;
+      m_dead_bytes = 0;
+      m_session = 1;
+    }
+
+    // Pick up records which were appended after the index was last written. A partially-written
+    // record at the end of the file is overwritten by the next append.
+    m_data_size = ScanRecords(scan_start, file_size);
+    if (m_data_size != scan_start)
+      m_index_dirty = true;
+
+    StartCompactionIfNeeded();
+    return GetEntryCount();
+  }
+
+  // Opens the cache and passes every entry to the reader, in file order.
+  // Reading entries this way does not count as using them for the purpose of eviction.
+  u32 OpenAndRead(const std::string& filename, IndexedDiskCacheReader<K, V>& reader,
+                  std::string_view version = Common::GetScmRevGitStr())
+  {
+    if (Open(filename, version) == 0)
+      return 0;
+
+    std::vector<const IndexEntry*> entries;
+    entries.reserve(m_index.size());
+    for (const auto& it : m_index)
+      entries.push_back(&it.second);
+    std::sort(entries.begin(), entries.end(), [](const IndexEntry* lhs, const IndexEntry* rhs) {
+      return lhs->offset < rhs->offset;
+    });
+
+    K key;
+    std::vector<V> buffer;
+    u32 num_read = 0;
+    for (const IndexEntry* entry : entries)
+    {
+      const V* value;
+      if (!ReadAt(entry->offset + sizeof(RecordHeader), &key, sizeof(K)) ||
+          !GetValue(*entry, buffer, &value))
+      {
+        continue;
+      }
+
+      reader.Read(key, value, entry->value_size);
+      num_read++;
+    }
+
+    return num_read;
+  }
+
+  bool Contains(const K& key)
+  {
+    const auto it = m_index.find(HashKey(key));
+    return it != m_index.end() && HasKey(it->second, key);
+  }
+
+  // Passes the value stored for key to func as (const V* value, u32 value_size), and marks the
+  // entry as used in this session. Returns false if key is not present.
+  template <typename Func>
+  bool Lookup(const K& key, Func&& func)
+  {
+    const auto it = m_index.find(HashKey(key));
+    const V* value;
+    if (it == m_index.end() || !HasKey(it->second, key) || !GetValue(it->second, m_buffer, &value))
+      return false;
+
+    MarkUsed(it->second);
+    func(value, it->second.value_size);
+    return true;
+  }
+
+  // Marks key as used in this session, which protects it from eviction.
+  void Touch(const K& key)
+  {
+    const auto it = m_index.find(HashKey(key));
+    if (it != m_index.end() && HasKey(it->second, key))
+      MarkUsed(it->second);
+  }
+
+  // Appends a key-value pair to the store, replacing any existing value for the key. The append is
+  // dropped if the key's hash collides with a different key that is already stored.
+  void Append(const K& key, const V* value, u32 value_size)
+  {
+    if (!m_file.IsOpen())
+      return;
+
+    const u64 key_hash = HashKey(key);
+    const auto it = m_index.find(key_hash);
+    if (it != m_index.end() && !HasKey(it->second, key))
+    {
+      WARN_LOG_FMT(COMMON, "Not appending to disk cache {}: key hash {:016x} collides", m_filename,
+                   key_hash);
+      return;
+    }
+
+    const u64 value_bytes = static_cast<u64>(value_size) * sizeof(V);
+    const RecordHeader record_header = {
+        value_size,
+        ComputeCRC32(reinterpret_cast<const u8*>(value), static_cast<size_t>(value_bytes)),
+        key_hash};
+
+    // Reads through the file move the file position, so always seek to the end of the data.
+    if (!m_file.Seek(static_cast<s64>(m_data_size), File::SeekOrigin::Begin) ||
+        !m_file.WriteArray(&record_header, 1) || !m_file.WriteArray(&key, 1) ||
+        (value_size != 0 && !m_file.WriteArray(value, value_size)))
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to append to disk cache {}", m_filename);
+      m_file.ClearError();
+      return;
+    }
+
+    InsertEntry(record_header.key_hash, {m_data_size, value_size, m_session});
+    m_data_size += GetRecordSize(value_size);
+    m_index_dirty = true;
+  }
+
+  // Limits the total size of the live records. Least-recently-used entries beyond the limit are
+  // evicted when the cache is closed. Zero means unlimited.
+  void SetSizeLimit(u64 bytes) { m_size_limit = bytes; }
+
+  void Sync()
+  {
+    m_file.Flush();
+    WriteIndex();
+  }
+
+  void Close()
+  {
+    if (!m_file.IsOpen())
+      return;
+
+    EvictToSizeLimit();
+    m_file.Flush();
+    FinishCompaction();
+    WriteIndex();
+
+    m_file.Close();
+    m_mapping.Close();
+    m_index.clear();
+    m_buffer = {};
+    m_live_bytes = 0;
+    m_dead_bytes = 0;
+    m_data_size = 0;
+  }
+
+  bool IsOpen() const { return m_file.IsOpen(); }
+  u32 GetEntryCount() const { return static_cast<u32>(m_index.size()); }
+
+  // Bytes used by live records, and by replaced or evicted records awaiting compaction.
+  u64 GetLiveBytes() const { return m_live_bytes; }
+  u64 GetDeadBytes() const { return m_dead_bytes; }
+
+private:
+  // Compaction is started when at least a quarter of the data file, and this many bytes, are
+  // taken up by dead records.
+  static constexpr u64 MIN_COMPACTION_BYTES = 1024 * 1024;
+
+  struct Header
+  {
+    void Init(std::string_view version)
+    {
+      // Null-terminator is intentionally not copied.
+      std::memcpy(&id, "DCIX", sizeof(u32));
+      std::memset(ver, 0, sizeof(ver));
+      std::memcpy(ver, version.data(), std::min(version.size(), sizeof(ver)));
+    }
+
+    bool IsCompatible(const Header& other) const
+    {
+      return id == other.id && key_t_size == other.key_t_size &&
+             value_t_size == other.value_t_size && std::memcmp(ver, other.ver, sizeof(ver)) == 0;
+    }
+
+    u32 id = 0;
+    u16 key_t_size = sizeof(K);
+    u16 value_t_size = sizeof(V);
+    u64 file_id = 0;
+    char ver[40] = {};
+  };
+
+  struct RecordHeader
+  {
+    u32 value_size;
+    u32 value_crc32;
+    u64 key_hash;
+  };
+
+  struct IndexHeader
+  {
+    u32 id;
+    u32 session;
+    u64 file_id;
+    u64 data_size;
+    u64 dead_bytes;
+    u64 num_entries;
+  };
+
+  struct IndexFileEntry
+  {
+    u64 key_hash;
+    u64 offset;
+    u32 value_size;
+    u32 last_session;
+  };
+
+  struct IndexEntry
+  {
+    u64 offset;
+    u32 value_size;
+    u32 last_session;
+  };
+
+  struct CompactionRecord
+  {
+    u64 key_hash;
+    u64 old_offset;
+    u64 size;
+    u64 new_offset;
+  };
+
+  struct CompactionJob
+  {
+    std::string filename;
+    Header header;
+    std::vector<CompactionRecord> records;
+    u64 size = 0;
+    bool success = false;
+  };
+
+  static constexpr u32 INDEX_ID = 0x44494344;  // DCID
+
+  static u64 HashKey(const K& key)
+  {
+    const SHA1::Digest digest = SHA1::CalculateDigest(reinterpret_cast<const u8*>(&key), sizeof(K));
+    u64 hash;
+    std::memcpy(&hash, digest.data(), sizeof(hash));
+    return hash;
+  }
+
+  static constexpr u64 GetRecordSize(u32 value_size)
+  {
+    return sizeof(RecordHeader) + sizeof(K) + static_cast<u64>(value_size) * sizeof(V);
+  }
+
+  std::string GetIndexFilename() const { return m_filename + ".idx"; }
+
+  void CreateDataFile()
+  {
+    m_file.Open(m_filename, "w+b");
+    m_header.file_id = Common::Random::GenerateValue<u64>();
+    m_file.WriteArray(&m_header, 1);
+    m_data_size = sizeof(Header);
+    m_session = 1;
+    m_index_dirty = true;
+  }
+
+  bool ReadIndex(u64 file_size)
+  {
+    File::IOFile file(GetIndexFilename(), "rb");
+    IndexHeader header;
+    if (!file.ReadArray(&header, 1) || header.id != INDEX_ID ||
+        header.file_id != m_header.file_id || header.data_size < sizeof(Header) ||
+        header.data_size > file_size || header.num_entries > file_size ||
+        file.GetSize() != sizeof(IndexHeader) + header.num_entries * sizeof(IndexFileEntry))
+    {
+      return false;
+    }
+
+    std::vector<IndexFileEntry> entries(header.num_entries);
+    if (!entries.empty() && !file.ReadArray(entries.data(), entries.size()))
+      return false;
+
+    m_index.clear();
+    m_index.reserve(entries.size());
+    m_live_bytes = 0;
+    for (const IndexFileEntry& entry : entries)
+    {
+      const u64 record_size = GetRecordSize(entry.value_size);
+      if (entry.offset < sizeof(Header) || entry.offset + record_size > header.data_size)
+        return false;
+
+      m_index.emplace(entry.key_hash,
+                      IndexEntry{entry.offset, entry.value_size, entry.last_session});
+      m_live_bytes += record_size;
+    }
+
+    m_session = header.session + 1;
+    m_data_size = header.data_size;
+    m_dead_bytes = header.dead_bytes;
+    return true;
+  }
+
+  void WriteIndex()
+  {
+    if (!m_index_dirty)
+      return;
+
+    std::vector<IndexFileEntry> entries;
+    entries.reserve(m_index.size());
+    for (const auto& [key_hash, entry] : m_index)
+      entries.push_back({key_hash, entry.offset, entry.value_size, entry.last_session});
+
+    const IndexHeader header = {INDEX_ID,    m_session,    m_header.file_id,
+                                m_data_size, m_dead_bytes, entries.size()};
+    File::IOFile file(GetIndexFilename(), "wb");
+    if (!file.WriteArray(&header, 1) ||
+        (!entries.empty() && !file.WriteArray(entries.data(), entries.size())))
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to write disk cache index {}", GetIndexFilename());
+      return;
+    }
+
+    m_index_dirty = false;
+  }
+
+  // Validates and indexes the records in [start, end), returning the end of the last valid one.
+  u64 ScanRecords(u64 start, u64 end)
+  {
+    K key;
+    std::vector<V> buffer;
+    u64 offset = start;
+    while (end - offset >= GetRecordSize(0))
+    {
+      RecordHeader record_header;
+      if (!ReadAt(offset, &record_header, sizeof(record_header)))
+        break;
+
+      const IndexEntry entry = {offset, record_header.value_size, m_session - 1};
+      const u64 record_size = GetRecordSize(entry.value_size);
+      const V* value;
+      if (record_size > end - offset || !ReadAt(offset + sizeof(RecordHeader), &key, sizeof(K)) ||
+          HashKey(key) != record_header.key_hash || !GetValue(entry, buffer, &value) ||
+          ComputeCRC32(reinterpret_cast<const u8*>(value),
+                       static_cast<size_t>(record_size - GetRecordSize(0))) !=
+              record_header.value_crc32)
+      {
+        break;
+      }
+
+      InsertEntry(record_header.key_hash, entry);
+      offset += record_size;
+    }
+
+    m_file.ClearError();
+    return offset;
+  }
+
+  bool ReadAt(u64 offset, void* data, u64 size)
+  {
+    if (m_mapping.IsOpen() && offset + size <= m_mapping.GetSize())
+    {
+      std::memcpy(data, m_mapping.GetData() + offset, static_cast<size_t>(size));
+      return true;
+    }
+
+    return m_file.Seek(static_cast<s64>(offset), File::SeekOrigin::Begin) &&
+           m_file.ReadBytes(data, static_cast<size_t>(size));
+  }
+
+  // Whether the entry's record is stored under key, rather than a different key with the same hash.
+  bool HasKey(const IndexEntry& entry, const K& key)
+  {
+    K stored_key;
+    return ReadAt(entry.offset + sizeof(RecordHeader), &stored_key, sizeof(K)) &&
+           std::memcmp(&stored_key, &key, sizeof(K)) == 0;
+  }
+
+  // Points value at the entry's value, either in the mapping or copied into buffer.
+  bool GetValue(const IndexEntry& entry, std::vector<V>& buffer, const V** value)
+  {
+    const u64 offset = entry.offset + sizeof(RecordHeader) + sizeof(K);
+    const u64 size = static_cast<u64>(entry.value_size) * sizeof(V);
+    if (m_mapping.IsOpen() && offset + size <= m_mapping.GetSize())
+    {
+      const u8* mapped = m_mapping.GetData() + offset;
+      if (reinterpret_cast<uintptr_t>(mapped) % alignof(V) == 0)
+      {
+        *value = reinterpret_cast<const V*>(mapped);
+        return true;
+      }
+    }
+
+    buffer.resize(entry.value_size);
+    *value = buffer.data();
+    return ReadAt(offset, buffer.data(), size);
+  }
+
+  void InsertEntry(u64 key_hash, const IndexEntry& entry)
+  {
+    const auto [it, inserted] = m_index.try_emplace(key_hash, entry);
+    if (!inserted)
+    {
+      RemoveLiveBytes(it->second);
+      it->second = entry;
+    }
+
+    m_live_bytes += GetRecordSize(entry.value_size);
+  }
+
+  void RemoveLiveBytes(const IndexEntry& entry)
+  {
+    const u64 record_size = GetRecordSize(entry.value_size);
+    m_live_bytes -= record_size;
+    m_dead_bytes += record_size;
+  }
+
+  void MarkUsed(IndexEntry& entry)
+  {
+    if (entry.last_session == m_session)
+      return;
+
+    entry.last_session = m_session;
+    m_index_dirty = true;
+  }
+
+  void EvictToSizeLimit()
+  {
+    if (m_size_limit == 0 || m_live_bytes <= m_size_limit)
+      return;
+
+    std::vector<std::pair<u64, IndexEntry>> entries(m_index.begin(), m_index.end());
+    std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+      return std::tie(lhs.second.last_session, lhs.second.offset) <
+             std::tie(rhs.second.last_session, rhs.second.offset);
+    });
+
+    u32 num_evicted = 0;
+    for (const auto& [key_hash, entry] : entries)
+    {
+      if (m_live_bytes <= m_size_limit)
+        break;
+
+      RemoveLiveBytes(entry);
+      m_index.erase(key_hash);
+      num_evicted++;
+    }
+
+    INFO_LOG_FMT(COMMON, "Evicted {} entries from disk cache {}", num_evicted, m_filename);
+    m_index_dirty = true;
+  }
+
+  void StartCompactionIfNeeded()
+  {
+    if (!m_mapping.IsOpen() || m_mapping.GetSize() < m_data_size ||
+        m_dead_bytes < MIN_COMPACTION_BYTES || m_dead_bytes * 4 < m_data_size)
+    {
+      return;
+    }
+
+    // The compaction thread only reads the records which exist now, through the mapping, so the
+    // cache can keep being appended to while it runs.
+    m_compaction = {};
+    m_compaction.filename = m_filename + ".compact";
+    m_compaction.header = m_header;
+    m_compaction.header.file_id = Common::Random::GenerateValue<u64>();
+    m_compaction.records.reserve(m_index.size());
+    for (const auto& [key_hash, entry] : m_index)
+      m_compaction.records.push_back({key_hash, entry.offset, GetRecordSize(entry.value_size), 0});
+    std::sort(m_compaction.records.begin(), m_compaction.records.end(),
+              [](const CompactionRecord& lhs, const CompactionRecord& rhs) {
+                return lhs.old_offset < rhs.old_offset;
+              });
+
+    m_compaction_thread = std::thread(&IndexedDiskCache::CompactionThread, &m_compaction,
+                                      m_mapping.GetData());
+  }
+
+  static void CompactionThread(CompactionJob* job, const u8* data)
+  {
+    Common::SetCurrentThreadName("Disk cache compaction");
+
+    File::IOFile file(job->filename, "wb");
+    bool success = file.WriteArray(&job->header, 1);
+    u64 offset = sizeof(Header);
+    for (CompactionRecord& record : job->records)
+    {
+      if (!success)
+        break;
+
+      success = file.WriteBytes(data + record.old_offset, static_cast<size_t>(record.size));
+      record.new_offset = offset;
+      offset += record.size;
+    }
+
+    job->size = offset;
+    job->success = success && file.Close();
+  }
+
+  void FinishCompaction()
+  {
+    if (!m_compaction_thread.joinable())
+      return;
+
+    m_compaction_thread.join();
+    CompactionJob job = std::move(m_compaction);
+    m_compaction = {};
+    if (!job.success)
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to compact disk cache {}", m_filename);
+      File::Delete(job.filename);
+      return;
+    }
+
+    std::unordered_map<u64, const CompactionRecord*> compacted;
+    compacted.reserve(job.records.size());
+    for (const CompactionRecord& record : job.records)
+      compacted.emplace(record.key_hash, &record);
+
+    // Records which were appended while the compaction was running are copied over now, and
+    // records which were replaced or evicted in the meantime are left behind as dead space.
+    File::IOFile file(job.filename, "r+b");
+    bool success = file.Seek(static_cast<s64>(job.size), File::SeekOrigin::Begin);
+    u64 size = job.size;
+    std::vector<u8> buffer;
+    std::vector<std::pair<IndexEntry*, u64>> new_offsets;
+    new_offsets.reserve(m_index.size());
+    for (auto& [key_hash, entry] : m_index)
+    {
+      const auto it = compacted.find(key_hash);
+      if (it != compacted.end() && it->second->old_offset == entry.offset)
+      {
+        new_offsets.emplace_back(&entry, it->second->new_offset);
+        continue;
+      }
+
+      const u64 record_size = GetRecordSize(entry.value_size);
+      buffer.resize(static_cast<size_t>(record_size));
+      success = success && ReadAt(entry.offset, buffer.data(), record_size) &&
+                file.WriteBytes(buffer.data(), buffer.size());
+      new_offsets.emplace_back(&entry, size);
+      size += record_size;
+    }
+
+    if (!file.Close() || !success)
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to compact disk cache {}", m_filename);
+      File::Delete(job.filename);
+      return;
+    }
+
+    // The old file has to be closed before it can be replaced on Windows.
+    m_file.Close();
+    m_mapping.Close();
+    if (!File::Rename(job.filename, m_filename))
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to replace disk cache {} with its compacted copy", m_filename);
+      File::Delete(job.filename);
+      // The entries still point into the original file, which is left as it was.
+      if (!m_file.Open(m_filename, "r+b"))
+        ERROR_LOG_FMT(COMMON, "Failed to reopen disk cache {}", m_filename);
+      else
+        m_mapping.Open(m_filename);
+      return;
+    }
+
+    for (const auto& [entry, offset] : new_offsets)
+      entry->offset = offset;
+
+    INFO_LOG_FMT(COMMON, "Compacted disk cache {} from {} to {} bytes", m_filename, m_data_size,
+                 size);
+    m_header.file_id = job.header.file_id;
+    m_data_size = size;
+    m_dead_bytes = size - sizeof(Header) - m_live_bytes;
+    m_index_dirty = true;
+  }
+
+  std::string m_filename;
+  File::IOFile m_file;
+  File::MappedFile m_mapping;
+  Header m_header;
+  std::unordered_map<u64, IndexEntry> m_index;
+  std::vector<V> m_buffer;
+  u64 m_data_size = 0;
+  u64 m_live_bytes = 0;
+  u64 m_dead_bytes = 0;
+  u64 m_size_limit = 0;
+  u32 m_session = 1;
+  bool m_index_dirty = false;
+
+  std::thread m_compaction_thread;
+  CompactionJob m_compaction;
+};
+}  // namespace Common
@@ -0,0 +1,37 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+// Read-only memory mapping of a whole file.
+// The mapping covers the size of the file at the time it was opened. Data appended to the file
+// afterwards is not visible through it, but the file may still be written through other handles.
+class MappedFile
+{
+public:
+  MappedFile();
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Fails for empty files, as those can't be mapped.
+  bool Open(const std::string& filename);
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  const u8* GetData() const { return m_data; }
+  u64 GetSize() const { return m_size; }
+
+private:
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+};
+}  // namespace File
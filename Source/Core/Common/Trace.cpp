@@ -0,0 +1,206 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/Trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+
+namespace Common::Trace
+{
+std::atomic<bool> g_recording = false;
+
+namespace
+{
+// About 1.5 MiB per thread. Once a buffer is full, the oldest events of the thread are overwritten.
+constexpr u64 EVENTS_PER_THREAD = 1 << 16;
+
+struct Event
+{
+  const char* name;
+  u64 begin_ns;
+  u64 end_ns;
+};
+
+struct ThreadBuffer
+{
+  std::unique_ptr<Event[]> events = std::make_unique<Event[]>(EVENTS_PER_THREAD);
+
+  // Only written by the thread that owns the buffer. The events are reset lazily by that thread
+  // when it first records an event in a new trace.
+  std::atomic<u64> num_events = 0;
+  std::atomic<u32> session = 0;
+
+  // Guarded by s_mutex
+  u32 id = 0;
+  std::string name;
+  bool in_use = false;
+};
+
+std::mutex s_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+std::atomic<u32> s_session = 0;
+u64 s_start_ns = 0;
+
+struct ThreadState
+{
+  ThreadBuffer* buffer = nullptr;
+  std::string name;
+
+  // Hand the buffer back when the thread exits, so that a new thread can use it once its events
+  // are no longer part of a running trace.
+  ~ThreadState()
+  {
+    if (!buffer)
+      return;
+
+    std::lock_guard lk(s_mutex);
+    buffer->in_use = false;
+  }
+};
+
+thread_local ThreadState s_thread;
+
+ThreadBuffer* AcquireBuffer()
+{
+  std::lock_guard lk(s_mutex);
+
+  const u32 session = s_session.load(std::memory_order_relaxed);
+  auto it = std::find_if(s_buffers.begin(), s_buffers.end(), [session](const auto& buffer) {
+    return !buffer->in_use && buffer->session.load(std::memory_order_relaxed) != session;
+  });
+
+  ThreadBuffer* buffer;
+  if (it != s_buffers.end())
+  {
+    buffer = it->get();
+  }
+  else
+  {
+    buffer = s_buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+    buffer->id = static_cast<u32>(s_buffers.size());
+  }
+
+  buffer->in_use = true;
+  buffer->name = s_thread.name.empty() ? fmt::format("Thread {}", buffer->id) : s_thread.name;
+  return buffer;
+}
+}  // namespace
+
+void Start()
+{
+  std::lock_guard lk(s_mutex);
+  if (g_recording.load(std::memory_order_relaxed))
+    return;
+
+  s_start_ns = GetTimeNs();
+  s_session.fetch_add(1, std::memory_order_relaxed);
+  g_recording.store(true, std::memory_order_relaxed);
+}
+
+bool Stop(const std::string& path)
+{
+  std::lock_guard lk(s_mutex);
+  if (!g_recording.load(std::memory_order_relaxed))
+    return false;
+
+  g_recording.store(false, std::memory_order_relaxed);
+
+  if (!File::CreateFullPath(path))
+    return false;
+
+  File::IOFile file(path, "w");
+  if (!file)
+    return false;
+
+  // Chrome trace times are in microseconds
+  file.WriteString("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                   "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+                   "\"args\":{\"name\":\"Dolphin\"}}");
+
+  const u32 session = s_session.load(std::memory_order_relaxed);
+  std::vector<Event> events;
+  for (const auto& buffer : s_buffers)
+  {
+    if (buffer->session.load(std::memory_order_acquire) != session)
+      continue;
+
+    // Threads may still be finishing events that started before the trace was stopped, so copy
+    // the events out first and then drop the ones that might have been overwritten meanwhile.
+    const u64 num_events = buffer->num_events.load(std::memory_order_acquire);
+    const u64 first_event = num_events - std::min(num_events, EVENTS_PER_THREAD);
+    events.clear();
+    for (u64 i = first_event; i < num_events; i++)
+      events.push_back(buffer->events[i % EVENTS_PER_THREAD]);
+
+    const u64 num_events_after = buffer->num_events.load(std::memory_order_acquire);
+    const u64 first_valid_event =
+        std::max(num_events_after + 1, EVENTS_PER_THREAD) - EVENTS_PER_THREAD;
+    const size_t num_invalid = std::min<u64>(
+        events.size(), first_valid_event - std::min(first_valid_event, first_event));
+
+    file.WriteString(fmt::format(",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                                 "\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+                                 buffer->id, buffer->name));
+
+    for (size_t i = num_invalid; i < events.size(); i++)
+    {
+      const Event& event = events[i];
+      // Events that were already running when the trace started
+      if (event.begin_ns < s_start_ns)
+        continue;
+
+      file.WriteString(fmt::format(
+          ",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+          event.name, buffer->id, (event.begin_ns - s_start_ns) / 1000.0,
+          (event.end_ns - event.begin_ns) / 1000.0));
+    }
+  }
+
+  file.WriteString("\n]}\n");
+  return file.IsGood();
+}
+
+void SetCurrentThreadName(const char* name)
+{
+  s_thread.name = name;
+  if (!s_thread.buffer)
+    return;
+
+  std::lock_guard lk(s_mutex);
+  s_thread.buffer->name = name;
+}
+
+u64 GetTimeNs()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void AddEvent(const char* name, u64 begin_ns, u64 end_ns)
+{
+  ThreadBuffer* buffer = s_thread.buffer;
+  if (!buffer)
+    buffer = s_thread.buffer = AcquireBuffer();
+
+  const u32 session = s_session.load(std::memory_order_relaxed);
+  if (buffer->session.load(std::memory_order_relaxed) != session)
+  {
+    buffer->num_events.store(0, std::memory_order_relaxed);
+    buffer->session.store(session, std::memory_order_release);
+  }
+
+  const u64 index = buffer->num_events.load(std::memory_order_relaxed);
+  buffer->events[index % EVENTS_PER_THREAD] = {name, begin_ns, end_ns};
+  buffer->num_events.store(index + 1, std::memory_order_release);
+}
+}  // namespace Common::Trace
@@ -0,0 +1,67 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Records a timeline of what each thread was doing, which can be written out as a Chrome trace
+// (viewable with chrome://tracing or Perfetto). Every thread records into its own buffer, so
+// recording an event never takes a lock. While no trace is running, an event costs a single
+// relaxed load.
+namespace Common::Trace
+{
+extern std::atomic<bool> g_recording;
+
+inline bool IsRecording()
+{
+  return g_recording.load(std::memory_order_relaxed);
+}
+
+// Starts a new trace, discarding the events of the previous one.
+void Start();
+
+// Stops the trace and writes it to the given path. Returns false if no trace was running or the
+// file couldn't be written.
+bool Stop(const std::string& path);
+
+// Called by Common::SetCurrentThreadName so that threads are labelled in the trace.
+void SetCurrentThreadName(const char* name);
+
+u64 GetTimeNs();
+
+// name must be a string literal (or otherwise outlive the trace).
+void AddEvent(const char* name, u64 begin_ns, u64 end_ns);
+
+class ScopedEvent
+{
+public:
+  explicit ScopedEvent(const char* name)
+  {
+    if (IsRecording()) [[unlikely]]
+    {
+      m_name = name;
+      m_begin_ns = GetTimeNs();
+    }
+  }
+
+  ~ScopedEvent()
+  {
+    if (m_name) [[unlikely]]
+      AddEvent(m_name, m_begin_ns, GetTimeNs());
+  }
+
+  ScopedEvent(const ScopedEvent&) = delete;
+  ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+private:
+  const char* m_name = nullptr;
+  u64 m_begin_ns = 0;
+};
+}  // namespace Common::Trace
+
+// Records the rest of the enclosing scope as an event of the current thread.
+#define TRACE_SCOPE(name) Common::Trace::ScopedEvent trace_event(name)
@@ -95,6 +95,10 @@ public:
     layer->Set(Config::GFX_HACK_DEFER_EFB_COPIES, m_settings.defer_efb_copies);
     layer->Set(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE, m_settings.efb_access_tile_size);
     layer->Set(Config::GFX_HACK_EFB_DEFER_INVALIDATION, m_settings.efb_access_defer_invalidation);
+    // Peeks would return different values for players which read last frame's EFB
+    layer->Set(Config::GFX_HACK_EFB_ACCESS_DOUBLE_BUFFER, false);
+    // Likewise for bounding box values guessed while the GPU readback is in flight
+    layer->Set(Config::GFX_HACK_BBOX_ASYNC_READBACK, false);
 
     layer->Set(Config::SESSION_USE_FMA, m_settings.use_fma);
 
@@ -119,6 +123,9 @@ public:
                  m_settings.arbitrary_mipmap_detection_threshold);
       layer->Set(Config::GFX_ENABLE_GPU_TEXTURE_DECODING, m_settings.enable_gpu_texture_decoding);
 
+      // Picking the decoding path from timings would make it differ between players
+      layer->Set(Config::GFX_AUTO_GPU_TEXTURE_DECODING, false);
+
       // Disable AA as it isn't deterministic across GPUs
       layer->Set(Config::GFX_MSAA, 1);
       layer->Set(Config::GFX_SSAA, false);
@@ -50,6 +50,7 @@
 #include "Core/DSPEmulator.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/FifoPlayer/FifoRecorder.h"
 #include "Core/FreeLookManager.h"
 #include "Core/HLE/HLE.h"
 #include "Core/HW/CPU.h"
@@ -583,11 +584,12 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     PanicAlertFmt("Failed to initialize video backend!");
     return;
   }
-  Common::ScopeGuard video_guard{[] {
+  Common::ScopeGuard video_guard{[&system] {
     // Clear on screen messages that haven't expired
     OSD::ClearMessages();
 
     g_video_backend->Shutdown();
+    system.GetFifoRecorder().Shutdown();
   }};
 
   if (cpu_info.HTT)
@@ -5,10 +5,15 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <lz4.h>
+#include <xxhash.h>
+
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
@@ -16,11 +21,16 @@
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
-constexpr u32 MIN_LOADER_VERSION = 1;
-// This value is only used if the DFF file was created with overridden RAM sizes.
-// If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
-constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+constexpr u32 VERSION_NUMBER = 6;
+// Version 6 compresses the frames, which older versions can't read.
+constexpr u32 MIN_LOADER_VERSION = 6;
+
+// Memory updates with at least this much data are only written once for all frames they are in.
+// Smaller ones are written in the frame.
+constexpr u32 MIN_SHARED_DATA_SIZE = 256;
+
+// How much frame data of compressed files is kept in memory.
+constexpr u64 MAX_CACHED_FRAME_BYTES = 256 * 1024 * 1024;
 
 #pragma pack(push, 1)
 
@@ -73,11 +83,79 @@ struct FileMemoryUpdate
 };
 static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 bytes");
 
+// Starting with version 6, the frame list is an index of the LZ4 compressed FIFO data and memory
+// updates of each frame, which are read when the frame is played.
+struct CompressedFileFrameInfo
+{
+  u64 fifoDataOffset;
+  u32 fifoDataSize;
+  u32 fifoDataCompressedSize;
+  // The memory updates are a list of CompressedFileMemoryUpdate followed by the data of the
+  // updates which aren't shared.
+  u64 memoryUpdatesOffset;
+  u32 memoryUpdatesSize;
+  u32 memoryUpdatesCompressedSize;
+  u32 numMemoryUpdates;
+  u32 fifoStart;
+  u32 fifoEnd;
+  u8 reserved[20];
+};
+static_assert(sizeof(CompressedFileFrameInfo) == 64, "CompressedFileFrameInfo should be 64 bytes");
+
+struct CompressedFileMemoryUpdate
+{
+  enum : u8
+  {
+    // The data is compressed on its own at dataOffset in the file, rather than stored at
+    // dataOffset after the update list of the frame.
+    FLAG_SHARED_DATA = 1
+  };
+
+  u32 fifoPosition;
+  u32 address;
+  u64 dataOffset;
+  u32 dataSize;
+  u32 dataCompressedSize;
+  u8 type;
+  u8 flags;
+  u8 reserved[6];
+};
+static_assert(sizeof(CompressedFileMemoryUpdate) == 32,
+              "CompressedFileMemoryUpdate should be 32 bytes");
+
 #pragma pack(pop)
 
+static bool WriteCompressed(const u8* data, size_t size, File::IOFile& file, u32* compressed_size)
+{
+  if (size > LZ4_MAX_INPUT_SIZE)
+    return false;
+
+  const int max_compressed_size = LZ4_compressBound(static_cast<int>(size));
+  auto compressed_buffer = std::make_unique<char[]>(max_compressed_size);
+  const int compressed_len =
+      LZ4_compress_default(reinterpret_cast<const char*>(data), compressed_buffer.get(),
+                           static_cast<int>(size), max_compressed_size);
+  if (compressed_len <= 0)
+    return false;
+
+  *compressed_size = static_cast<u32>(compressed_len);
+  return file.WriteBytes(compressed_buffer.get(), compressed_len);
+}
+
+static u64 GetFrameDataSize(const FifoFrameInfo& frame)
+{
+  u64 size = frame.fifoData.size();
+  for (const MemoryUpdate& update : frame.memoryUpdates)
+    size += update.data.size();
+  return size;
+}
+
 FifoDataFile::FifoDataFile() = default;
 
-FifoDataFile::~FifoDataFile() = default;
+FifoDataFile::~FifoDataFile()
+{
+  m_prefetch_thread.Shutdown(true);
+}
 
 bool FifoDataFile::ShouldGenerateFakeVIUpdates() const
 {
@@ -99,9 +177,213 @@ bool FifoDataFile::GetIsWii() const
   return GetFlag(FLAG_IS_WII);
 }
 
-void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
+void FifoDataFile::AddFrame(FifoFrameInfo frameInfo)
+{
+  m_Frames.push_back(std::make_shared<FifoFrameInfo>(std::move(frameInfo)));
+}
+
+u32 FifoDataFile::GetFrameCount() const
+{
+  if (m_file.IsOpen())
+    return static_cast<u32>(m_frame_index.size());
+  return static_cast<u32>(m_Frames.size());
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  if (!m_file.IsOpen())
+    return m_Frames[frame];
+
+  {
+    std::unique_lock lk(m_cache_mutex);
+    m_frame_read_cv.wait(lk, [&] { return !m_frames_being_read.contains(frame); });
+
+    const auto it = m_frame_cache.find(frame);
+    if (it != m_frame_cache.end())
+    {
+      it->second.last_use = ++m_cache_use_counter;
+      return it->second.frame;
+    }
+  }
+
+  std::shared_ptr<const FifoFrameInfo> frame_info = ReadCompressedFrame(frame);
+  if (!frame_info)
+  {
+    PanicAlertFmtT("Failed to read frame {0} of the DFF file.", frame);
+    return nullptr;
+  }
+
+  std::lock_guard lk(m_cache_mutex);
+  CacheFrame(frame, frame_info);
+  return frame_info;
+}
+
+std::shared_ptr<const std::vector<u8>> FifoDataFile::GetFifoData(u32 frame) const
 {
-  m_Frames.push_back(frameInfo);
+  if (!m_file.IsOpen())
+    return {m_Frames[frame], &m_Frames[frame]->fifoData};
+
+  {
+    std::lock_guard lk(m_cache_mutex);
+    if (m_last_fifo_data && m_last_fifo_data_frame == frame)
+      return m_last_fifo_data;
+
+    // Looking at the FIFO data doesn't count as a use of the frame, so it isn't kept any longer.
+    const auto it = m_frame_cache.find(frame);
+    if (it != m_frame_cache.end())
+      return {it->second.frame, &it->second.frame->fifoData};
+  }
+
+  const CompressedFileFrameInfo& src_frame = m_frame_index[frame];
+  auto fifo_data = std::make_shared<std::vector<u8>>();
+  if (!ReadCompressed(src_frame.fifoDataOffset, src_frame.fifoDataCompressedSize,
+                      src_frame.fifoDataSize, fifo_data.get()))
+  {
+    return nullptr;
+  }
+
+  std::lock_guard lk(m_cache_mutex);
+  m_last_fifo_data_frame = frame;
+  m_last_fifo_data = std::move(fifo_data);
+  return m_last_fifo_data;
+}
+
+void FifoDataFile::PrefetchFrame(u32 frame) const
+{
+  if (!m_file.IsOpen())
+    return;
+
+  {
+    std::lock_guard lk(m_cache_mutex);
+    const auto it = m_frame_cache.find(frame);
+    if (it != m_frame_cache.end())
+    {
+      // Keep it from being evicted before it is used.
+      it->second.last_use = ++m_cache_use_counter;
+      return;
+    }
+    if (!m_frames_being_read.insert(frame).second)
+      return;
+  }
+
+  m_prefetch_thread.Push(frame);
+}
+
+void FifoDataFile::ReadFrameIntoCache(u32 frame) const
+{
+  std::shared_ptr<const FifoFrameInfo> frame_info = ReadCompressedFrame(frame);
+
+  std::lock_guard lk(m_cache_mutex);
+  m_frames_being_read.erase(frame);
+  // If the frame couldn't be read, GetFrame reads it again and reports the error.
+  if (frame_info)
+    CacheFrame(frame, std::move(frame_info));
+  m_frame_read_cv.notify_all();
+}
+
+// m_cache_mutex must be locked.
+void FifoDataFile::CacheFrame(u32 frame, std::shared_ptr<const FifoFrameInfo> frame_info) const
+{
+  const u64 size = GetFrameDataSize(*frame_info);
+  auto [it, inserted] = m_frame_cache.try_emplace(frame);
+  if (!inserted)
+    m_cached_bytes -= it->second.size;
+  it->second = {std::move(frame_info), size, ++m_cache_use_counter};
+  m_cached_bytes += size;
+
+  // The frame which was just cached is the most recently used one, so it is never evicted.
+  while (m_cached_bytes > MAX_CACHED_FRAME_BYTES && m_frame_cache.size() > 1)
+  {
+    const auto least_recently_used = std::ranges::min_element(
+        m_frame_cache, {}, [](const auto& cached) { return cached.second.last_use; });
+    m_cached_bytes -= least_recently_used->second.size;
+    m_frame_cache.erase(least_recently_used);
+  }
+}
+
+bool FifoDataFile::ReadCompressed(u64 offset, u32 compressed_size, u32 size,
+                                  std::vector<u8>* data) const
+{
+  if (size > LZ4_MAX_INPUT_SIZE || compressed_size > static_cast<u32>(LZ4_compressBound(size)))
+    return false;
+
+  auto compressed_buffer = std::make_unique<char[]>(compressed_size);
+  {
+    std::lock_guard lk(m_file_mutex);
+    if (!m_file.Seek(offset, File::SeekOrigin::Begin) ||
+        !m_file.ReadBytes(compressed_buffer.get(), compressed_size))
+    {
+      m_file.ClearError();
+      return false;
+    }
+  }
+
+  data->resize(size);
+  const int decompressed_size =
+      LZ4_decompress_safe(compressed_buffer.get(), reinterpret_cast<char*>(data->data()),
+                          static_cast<int>(compressed_size), static_cast<int>(size));
+  return decompressed_size == static_cast<int>(size);
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::ReadCompressedFrame(u32 frame) const
+{
+  const CompressedFileFrameInfo& src_frame = m_frame_index[frame];
+
+  auto dst_frame = std::make_shared<FifoFrameInfo>();
+  dst_frame->fifoStart = src_frame.fifoStart;
+  dst_frame->fifoEnd = src_frame.fifoEnd;
+  if (!ReadCompressed(src_frame.fifoDataOffset, src_frame.fifoDataCompressedSize,
+                      src_frame.fifoDataSize, &dst_frame->fifoData))
+  {
+    return nullptr;
+  }
+
+  std::vector<u8> updates;
+  if (!ReadCompressed(src_frame.memoryUpdatesOffset, src_frame.memoryUpdatesCompressedSize,
+                      src_frame.memoryUpdatesSize, &updates))
+  {
+    return nullptr;
+  }
+
+  const size_t update_list_size =
+      static_cast<size_t>(src_frame.numMemoryUpdates) * sizeof(CompressedFileMemoryUpdate);
+  if (updates.size() < update_list_size)
+    return nullptr;
+  const size_t unshared_data_size = updates.size() - update_list_size;
+
+  dst_frame->memoryUpdates.resize(src_frame.numMemoryUpdates);
+  for (u32 i = 0; i < src_frame.numMemoryUpdates; ++i)
+  {
+    CompressedFileMemoryUpdate src_update;
+    std::memcpy(&src_update, &updates[i * sizeof(CompressedFileMemoryUpdate)],
+                sizeof(CompressedFileMemoryUpdate));
+
+    MemoryUpdate& dst_update = dst_frame->memoryUpdates[i];
+    dst_update.address = src_update.address;
+    dst_update.fifoPosition = src_update.fifoPosition;
+    dst_update.type = static_cast<MemoryUpdate::Type>(src_update.type);
+
+    if (src_update.flags & CompressedFileMemoryUpdate::FLAG_SHARED_DATA)
+    {
+      if (!ReadCompressed(src_update.dataOffset, src_update.dataCompressedSize,
+                          src_update.dataSize, &dst_update.data))
+      {
+        return nullptr;
+      }
+    }
+    else
+    {
+      if (src_update.dataOffset > unshared_data_size ||
+          src_update.dataSize > unshared_data_size - src_update.dataOffset)
+      {
+        return nullptr;
+      }
+      const auto data_start = updates.begin() + update_list_size + src_update.dataOffset;
+      dst_update.data.assign(data_start, data_start + src_update.dataSize);
+    }
+  }
+
+  return dst_frame;
 }
 
 bool FifoDataFile::Save(const std::string& filename)
@@ -110,12 +392,14 @@ bool FifoDataFile::Save(const std::string& filename)
   if (!file.Open(filename, "wb"))
     return false;
 
+  const u32 frame_count = GetFrameCount();
+
   // Add space for header
   PadFile(sizeof(FileHeader), file);
 
   // Add space for frame list
   u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
+  PadFile(frame_count * sizeof(CompressedFileFrameInfo), file);
 
   u64 bpMemOffset = file.Tell();
   file.WriteArray(m_BPMem);
@@ -136,11 +420,7 @@ bool FifoDataFile::Save(const std::string& filename)
   FileHeader header;
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
-  // Maintain backwards compatability so long as the RAM sizes aren't overridden.
-  if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
-    header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
-  else
-    header.min_loader_version = MIN_LOADER_VERSION;
+  header.min_loader_version = MIN_LOADER_VERSION;
 
   header.bpMemOffset = bpMemOffset;
   header.bpMemSize = BP_MEM_SIZE;
@@ -158,7 +438,7 @@ bool FifoDataFile::Save(const std::string& filename)
   header.texMemSize = TEX_MEM_SIZE;
 
   header.frameListOffset = frameListOffset;
-  header.frameCount = (u32)m_Frames.size();
+  header.frameCount = frame_count;
 
   header.flags = m_Flags;
 
@@ -170,30 +450,102 @@ bool FifoDataFile::Save(const std::string& filename)
   file.Seek(0, File::SeekOrigin::Begin);
   file.WriteBytes(&header, sizeof(FileHeader));
 
+  // Games upload the same textures and vertex data over and over again, so the data of large
+  // memory updates is only written once and shared by all updates with the same data.
+  struct SharedData
+  {
+    u64 offset;
+    u32 compressed_size;
+    // The update the data was first written for, to compare the data of later updates with
+    u32 frame;
+    u32 update;
+  };
+  // Data with the same hash and size is only shared once its bytes were found to be the same.
+  std::map<std::pair<u64, u32>, std::vector<SharedData>> shared_data;
+
   // Write frames list
-  for (unsigned int i = 0; i < m_Frames.size(); ++i)
+  for (u32 i = 0; i < frame_count; ++i)
   {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
+    const std::shared_ptr<const FifoFrameInfo> srcFrame = GetFrame(i);
+    if (!srcFrame)
+      return false;
+
+    CompressedFileFrameInfo dstFrame{};
+    dstFrame.fifoStart = srcFrame->fifoStart;
+    dstFrame.fifoEnd = srcFrame->fifoEnd;
+    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame->memoryUpdates.size());
 
     // Write FIFO data
     file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
-    dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
-    dstFrame.fifoDataOffset = dataOffset;
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
-    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
+    dstFrame.fifoDataOffset = file.Tell();
+    dstFrame.fifoDataSize = static_cast<u32>(srcFrame->fifoData.size());
+    if (!WriteCompressed(srcFrame->fifoData.data(), srcFrame->fifoData.size(), file,
+                         &dstFrame.fifoDataCompressedSize))
+    {
+      return false;
+    }
+
+    // Write memory updates, after the shared data they use which wasn't written yet
+    std::vector<u8> updates(srcFrame->memoryUpdates.size() * sizeof(CompressedFileMemoryUpdate));
+    for (size_t j = 0; j < srcFrame->memoryUpdates.size(); ++j)
+    {
+      const MemoryUpdate& srcUpdate = srcFrame->memoryUpdates[j];
+
+      CompressedFileMemoryUpdate dstUpdate{};
+      dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+      dstUpdate.address = srcUpdate.address;
+      dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
+      dstUpdate.type = static_cast<u8>(srcUpdate.type);
+
+      if (srcUpdate.data.size() >= MIN_SHARED_DATA_SIZE)
+      {
+        const u64 hash = XXH64(srcUpdate.data.data(), srcUpdate.data.size(), 0);
+        std::vector<SharedData>& candidates = shared_data[{hash, dstUpdate.dataSize}];
+        const auto has_same_data = [&](const SharedData& candidate) {
+          const std::shared_ptr<const FifoFrameInfo> frame =
+              candidate.frame == i ? srcFrame : GetFrame(candidate.frame);
+          return frame && std::memcmp(frame->memoryUpdates[candidate.update].data.data(),
+                                      srcUpdate.data.data(), srcUpdate.data.size()) == 0;
+        };
+
+        auto it = std::ranges::find_if(candidates, has_same_data);
+        if (it == candidates.end())
+        {
+          it = candidates.insert(it, SharedData{file.Tell(), 0, i, static_cast<u32>(j)});
+          if (!WriteCompressed(srcUpdate.data.data(), srcUpdate.data.size(), file,
+                               &it->compressed_size))
+          {
+            return false;
+          }
+        }
+
+        dstUpdate.flags = CompressedFileMemoryUpdate::FLAG_SHARED_DATA;
+        dstUpdate.dataOffset = it->offset;
+        dstUpdate.dataCompressedSize = it->compressed_size;
+      }
+      else
+      {
+        dstUpdate.dataOffset = updates.size() - srcFrame->memoryUpdates.size() *
+                                                    sizeof(CompressedFileMemoryUpdate);
+        updates.insert(updates.end(), srcUpdate.data.begin(), srcUpdate.data.end());
+      }
+
+      std::memcpy(&updates[j * sizeof(CompressedFileMemoryUpdate)], &dstUpdate,
+                  sizeof(CompressedFileMemoryUpdate));
+    }
+
+    dstFrame.memoryUpdatesOffset = file.Tell();
+    dstFrame.memoryUpdatesSize = static_cast<u32>(updates.size());
+    if (!WriteCompressed(updates.data(), updates.size(), file,
+                         &dstFrame.memoryUpdatesCompressedSize))
+    {
+      return false;
+    }
 
     // Write frame info
-    u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
+    u64 frameOffset = frameListOffset + (i * sizeof(CompressedFileFrameInfo));
     file.Seek(frameOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstFrame, sizeof(FileFrameInfo));
+    file.WriteBytes(&dstFrame, sizeof(CompressedFileFrameInfo));
   }
 
   if (!file.Close())
@@ -316,6 +668,32 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
+  // Compressed frames are read when they are needed
+  if (dataFile->m_Version >= 6)
+  {
+    dataFile->m_frame_index.resize(header.frameCount);
+    file.Seek(header.frameListOffset, File::SeekOrigin::Begin);
+    if (!file.ReadArray(dataFile->m_frame_index.data(), header.frameCount))
+      return panic_failed_to_read();
+
+    const u64 file_size = file.GetSize();
+    for (const CompressedFileFrameInfo& frame : dataFile->m_frame_index)
+    {
+      if (frame.fifoDataOffset + frame.fifoDataCompressedSize > file_size ||
+          frame.memoryUpdatesOffset + frame.memoryUpdatesCompressedSize > file_size)
+      {
+        return panic_failed_to_read();
+      }
+    }
+
+    dataFile->m_file = std::move(file);
+    FifoDataFile* const data_file = dataFile.get();
+    data_file->m_prefetch_thread.Reset(
+        "FIFO Player Prefetch", [data_file](u32 frame) { data_file->ReadFrameIntoCache(frame); });
+
+    return dataFile;
+  }
+
   // Read frames
   for (u32 i = 0; i < header.frameCount; ++i)
   {
@@ -325,21 +703,21 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     if (!file.ReadBytes(&srcFrame, sizeof(FileFrameInfo)))
       return panic_failed_to_read();
 
-    FifoFrameInfo dstFrame;
-    dstFrame.fifoData.resize(srcFrame.fifoDataSize);
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
+    auto dstFrame = std::make_shared<FifoFrameInfo>();
+    dstFrame->fifoData.resize(srcFrame.fifoDataSize);
+    dstFrame->fifoStart = srcFrame.fifoStart;
+    dstFrame->fifoEnd = srcFrame.fifoEnd;
 
     file.Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
+    file.ReadBytes(dstFrame->fifoData.data(), srcFrame.fifoDataSize);
 
     ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
+                      dstFrame->memoryUpdates, file);
 
     if (!file.IsGood())
       return panic_failed_to_read();
 
-    dataFile->AddFrame(dstFrame);
+    dataFile->m_Frames.push_back(std::move(dstFrame));
   }
 
   return dataFile;
@@ -364,37 +742,6 @@ bool FifoDataFile::GetFlag(u32 flag) const
   return !!(m_Flags & flag);
 }
 
-u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
-                                     File::IOFile& file)
-{
-  // Add space for memory update list
-  u64 updateListOffset = file.Tell();
-  PadFile(memUpdates.size() * sizeof(FileMemoryUpdate), file);
-
-  for (unsigned int i = 0; i < memUpdates.size(); ++i)
-  {
-    const MemoryUpdate& srcUpdate = memUpdates[i];
-
-    // Write memory
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
-
-    FileMemoryUpdate dstUpdate;
-    dstUpdate.address = srcUpdate.address;
-    dstUpdate.dataOffset = dataOffset;
-    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
-    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.type = static_cast<u8>(srcUpdate.type);
-
-    u64 updateOffset = updateListOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstUpdate, sizeof(FileMemoryUpdate));
-  }
-
-  return updateListOffset;
-}
-
 void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                      std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
 {
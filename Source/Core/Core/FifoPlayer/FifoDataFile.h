@@ -4,17 +4,20 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/WorkQueueThread.h"
 #include "VideoCommon/XFMemory.h"
 
-namespace File
-{
-class IOFile;
-}
+struct CompressedFileFrameInfo;
 
 struct MemoryUpdate
 {
@@ -72,9 +75,21 @@ public:
   u32 GetRamSizeReal() { return m_ram_size_real; }
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
-  void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  void AddFrame(FifoFrameInfo frameInfo);
+  u32 GetFrameCount() const;
+
+  // Frames of compressed files are read from disk when they are needed, and kept in a cache of
+  // limited size. Returns nullptr if the frame could not be read.
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame) const;
+  // Only reads the FIFO data of the frame, which is much faster than reading the whole frame.
+  // Frames in memory or in the cache are shared instead of copied, and the FIFO data which was
+  // read last is kept, so that looking at the same frame again doesn't read it again. Returns
+  // nullptr if the FIFO data could not be read.
+  std::shared_ptr<const std::vector<u8>> GetFifoData(u32 frame) const;
+  // Starts reading the frame into the cache on another thread, so that it doesn't need to be
+  // read when GetFrame is called.
+  void PrefetchFrame(u32 frame) const;
+
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
@@ -90,10 +105,14 @@ private:
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
 
+  bool ReadCompressed(u64 offset, u32 compressed_size, u32 size, std::vector<u8>* data) const;
+  std::shared_ptr<const FifoFrameInfo> ReadCompressedFrame(u32 frame) const;
+  void ReadFrameIntoCache(u32 frame) const;
+  void CacheFrame(u32 frame, std::shared_ptr<const FifoFrameInfo> frame_info) const;
+
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
   std::array<u32, CP_MEM_SIZE> m_CPMem{};
   std::array<u32, XF_MEM_SIZE> m_XFMem{};
@@ -105,5 +124,28 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  // Frames which were recorded or loaded from an uncompressed file.
+  std::vector<std::shared_ptr<const FifoFrameInfo>> m_Frames;
+
+  // Compressed files are kept open, and their frames are read when they are needed.
+  struct CachedFrame
+  {
+    std::shared_ptr<const FifoFrameInfo> frame;
+    u64 size;
+    u64 last_use;
+  };
+
+  std::vector<CompressedFileFrameInfo> m_frame_index;
+  mutable File::IOFile m_file;
+  mutable std::mutex m_file_mutex;
+
+  mutable std::mutex m_cache_mutex;
+  mutable std::condition_variable m_frame_read_cv;
+  mutable std::map<u32, CachedFrame> m_frame_cache;
+  mutable std::set<u32> m_frames_being_read;
+  mutable u64 m_cached_bytes = 0;
+  mutable u64 m_cache_use_counter = 0;
+  mutable u32 m_last_fifo_data_frame = 0;
+  mutable std::shared_ptr<const std::vector<u8>> m_last_fifo_data;
+  mutable Common::WorkQueueThread<u32> m_prefetch_thread;
 };
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 
@@ -35,10 +36,13 @@
 
 namespace
 {
+// How many frames after the current one are read ahead from compressed files.
+constexpr u32 PREFETCH_FRAMES = 4;
+
 class FifoPlaybackAnalyzer : public OpcodeDecoder::Callback
 {
 public:
-  static void AnalyzeFrames(FifoDataFile* file, std::vector<AnalyzedFrameInfo>& frame_info);
+  static bool AnalyzeFrames(FifoDataFile* file, std::vector<AnalyzedFrameInfo>& frame_info);
 
   explicit FifoPlaybackAnalyzer(const u32* cpmem) : m_cpmem(cpmem) {}
 
@@ -73,7 +77,7 @@ public:
   CPState m_cpmem;
 };
 
-void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
+bool FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
                                          std::vector<AnalyzedFrameInfo>& frame_info)
 {
   FifoPlaybackAnalyzer analyzer(file->GetCPMem());
@@ -82,7 +86,10 @@ void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
 
   for (u32 frame_no = 0; frame_no < file->GetFrameCount(); frame_no++)
   {
-    const FifoFrameInfo& frame = file->GetFrame(frame_no);
+    // Only the FIFO data is read, as the memory updates of all frames may not fit in memory.
+    const std::shared_ptr<const std::vector<u8>> fifo_data = file->GetFifoData(frame_no);
+    if (!fifo_data)
+      return false;
     AnalyzedFrameInfo& analyzed = frame_info[frame_no];
 
     u32 offset = 0;
@@ -90,10 +97,10 @@ void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
     u32 part_start = 0;
     CPState cpmem;
 
-    while (offset < frame.fifoData.size())
+    while (offset < fifo_data->size())
     {
-      const u32 cmd_size = OpcodeDecoder::RunCommand(&frame.fifoData[offset],
-                                                     u32(frame.fifoData.size()) - offset, analyzer);
+      const u32 cmd_size = OpcodeDecoder::RunCommand(&(*fifo_data)[offset],
+                                                     u32(fifo_data->size()) - offset, analyzer);
 
       if (analyzer.m_start_of_primitives)
       {
@@ -124,9 +131,11 @@ void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
     }
 
     // The frame should end with an EFB copy, so part_start should have been updated to the end.
-    ASSERT(part_start == frame.fifoData.size());
-    ASSERT(offset == frame.fifoData.size());
+    ASSERT(part_start == fifo_data->size());
+    ASSERT(offset == fifo_data->size());
   }
+
+  return true;
 }
 
 void FifoPlaybackAnalyzer::OnBP(u8 command, u32 value)
@@ -189,12 +198,14 @@ bool FifoPlayer::Open(const std::string& filename)
 
   m_File = FifoDataFile::Load(filename, false);
 
-  if (m_File)
+  if (m_File && !FifoPlaybackAnalyzer::AnalyzeFrames(m_File.get(), m_FrameInfo))
   {
-    FifoPlaybackAnalyzer::AnalyzeFrames(m_File.get(), m_FrameInfo);
+    CriticalAlertFmtT("Failed to read DFF file.");
+    m_File.reset();
+  }
 
+  if (m_File)
     m_FrameRangeEnd = m_File->GetFrameCount() - 1;
-  }
 
   if (m_FileLoadedCb)
     m_FileLoadedCb();
@@ -297,7 +308,25 @@ CPU::State FifoPlayer::AdvanceFrame()
   if (m_EarlyMemoryUpdates && m_CurrentFrame == m_FrameRangeStart)
     WriteAllMemoryUpdates();
 
-  WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
+  const std::shared_ptr<const FifoFrameInfo> frame = m_File->GetFrame(m_CurrentFrame);
+  if (!frame)
+    return CPU::State::PowerDown;
+
+  // Read the next frames from disk while this one is played.
+  for (u32 i = 1; i <= PREFETCH_FRAMES; ++i)
+  {
+    u32 next_frame = m_CurrentFrame + i;
+    if (next_frame > m_FrameRangeEnd)
+    {
+      if (!m_Loop)
+        break;
+      next_frame = m_FrameRangeStart + (next_frame - m_FrameRangeEnd - 1) %
+                                           (m_FrameRangeEnd - m_FrameRangeStart + 1);
+    }
+    m_File->PrefetchFrame(next_frame);
+  }
+
+  WriteFrame(*frame, m_FrameInfo[m_CurrentFrame]);
 
   ++m_CurrentFrame;
   return CPU::State::Running;
@@ -482,8 +511,11 @@ void FifoPlayer::WriteAllMemoryUpdates()
 
   for (u32 frameNum = 0; frameNum < m_File->GetFrameCount(); ++frameNum)
   {
-    const FifoFrameInfo& frame = m_File->GetFrame(frameNum);
-    for (auto& update : frame.memoryUpdates)
+    const std::shared_ptr<const FifoFrameInfo> frame = m_File->GetFrame(frameNum);
+    if (!frame)
+      return;
+
+    for (auto& update : frame->memoryUpdates)
     {
       WriteMemory(update);
     }
@@ -547,7 +579,10 @@ void FifoPlayer::SetupFifo()
   WriteCP(CommandProcessor::CTRL_REGISTER, 0);   // disable read, BP, interrupts
   WriteCP(CommandProcessor::CLEAR_REGISTER, 7);  // clear overflow, underflow, metrics
 
-  const FifoFrameInfo& frame = m_File->GetFrame(m_CurrentFrame);
+  const std::shared_ptr<const FifoFrameInfo> frame_ptr = m_File->GetFrame(m_CurrentFrame);
+  if (!frame_ptr)
+    return;
+  const FifoFrameInfo& frame = *frame_ptr;
 
   // Set fifo bounds
   WriteCP(CommandProcessor::FIFO_BASE_LO, frame.fifoStart);
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <utility>
 
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -216,11 +217,17 @@ FifoRecorder::FifoRecorder(Core::System& system) : m_system(system)
 {
 }
 
-FifoRecorder::~FifoRecorder() = default;
+FifoRecorder::~FifoRecorder()
+{
+  StopWriterThread();
+}
 
 void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 {
-  std::lock_guard lk(m_mutex);
+  // The writer of a previous recording may still be waiting for its last frame.
+  StopWriterThread();
+  m_frame_queue.Clear();
+  m_recording_done.Clear();
 
   m_File = std::make_unique<FifoDataFile>();
 
@@ -242,6 +249,7 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 
   std::ranges::fill(m_Ram, 0);
   std::ranges::fill(m_ExRam, 0);
+  m_recorded_ranges.clear();
 
   m_File->SetIsWii(m_system.IsWii());
 
@@ -255,6 +263,8 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
   m_RequestedRecordingEnd = false;
   m_FinishedCb = finishedCb;
 
+  StartWriterThread();
+
   m_end_of_frame_event = AfterFrameEvent::Register(
       [this](const Core::System& system) {
         const bool was_recording = OpcodeDecoder::g_record_fifo_data;
@@ -296,13 +306,34 @@ void FifoRecorder::RecordInitialVideoMemory()
 
 void FifoRecorder::StopRecording()
 {
-  std::lock_guard lk(m_mutex);
   m_RequestedRecordingEnd = true;
 }
 
+void FifoRecorder::Shutdown()
+{
+  if (!m_writer_thread.joinable())
+    return;
+
+  m_end_of_frame_event.reset();
+  OpcodeDecoder::g_record_fifo_data = false;
+
+  if (!m_recording_done.IsSet())
+  {
+    // No more frames will end, so finish the recording with the frames that ended so far. The
+    // frame that was being recorded is incomplete and is dropped.
+    m_IsRecording = false;
+    if (m_FrameEnded && !m_FifoData.empty())
+      QueueEndedFrame(true);
+    else
+      QueueEndOfRecording();
+  }
+
+  m_writer_thread.join();
+}
+
 bool FifoRecorder::IsRecordingDone() const
 {
-  return m_WasRecording && m_File != nullptr;
+  return m_recording_done.IsSet();
 }
 
 FifoDataFile* FifoRecorder::GetRecordedFile() const
@@ -332,32 +363,51 @@ void FifoRecorder::WriteGPCommand(const u8* data, u32 size)
   }
 
   if (m_FrameEnded && !m_FifoData.empty())
-  {
-    m_CurrentFrame.fifoData = m_FifoData;
+    QueueEndedFrame(m_FrameIsLast);
 
-    {
-      std::lock_guard lk(m_mutex);
-
-      // Copy frame to file
-      // The file will be responsible for freeing the memory allocated for each frame's fifoData
-      m_File->AddFrame(m_CurrentFrame);
-
-      if (m_FinishedCb && m_RequestedRecordingEnd)
-        m_FinishedCb();
-    }
+  m_SkipNextData = m_SkipFutureData;
+}
 
-    m_CurrentFrame.memoryUpdates.clear();
-    m_FifoData.clear();
-    m_FrameEnded = false;
-  }
+void FifoRecorder::QueueEndedFrame(bool is_last)
+{
+  // Hand the frame over to the writer thread instead of copying it
+  const size_t fifo_data_capacity = m_FifoData.capacity();
+  m_CurrentFrame.fifoData = std::move(m_FifoData);
+  m_frame_queue.Push(RecordedFrame{std::move(m_CurrentFrame), is_last});
+  m_frame_queued.Set();
+
+  m_CurrentFrame = {};
+  m_FifoData = {};
+  m_FifoData.reserve(fifo_data_capacity);
+  m_FrameEnded = false;
+}
 
-  m_SkipNextData = m_SkipFutureData;
+void FifoRecorder::QueueEndOfRecording()
+{
+  m_frame_queue.Push(RecordedFrame{{}, true});
+  m_frame_queued.Set();
 }
 
 void FifoRecorder::UseMemory(u32 address, u32 size, MemoryUpdate::Type type, bool dynamicUpdate)
 {
   auto& memory = m_system.GetMemory();
 
+  // Vertex arrays and XF data are usually used many times per frame without being written to in
+  // between. If the range wasn't written since the shadow copy was made, it can't have changed.
+  const auto recorded = m_recorded_ranges.find(address);
+  if (!dynamicUpdate && recorded != m_recorded_ranges.end() && recorded->second.size >= size &&
+      !memory.WasRangeWritten(address, recorded->second.size, recorded->second.stamp))
+  {
+    return;
+  }
+
+  // Taken before comparing, so that a write which races with the copy is seen next time
+  const u64 stamp = memory.WatchRange(address, size);
+  if (stamp != 0)
+    m_recorded_ranges.insert_or_assign(address, RecordedRange{size, stamp});
+  else if (recorded != m_recorded_ranges.end())
+    m_recorded_ranges.erase(recorded);
+
   u8* curData;
   u8* newData;
   if (address & 0x10000000)
@@ -396,8 +446,6 @@ void FifoRecorder::UseMemory(u32 address, u32 size, MemoryUpdate::Type type, boo
 void FifoRecorder::EndFrame(u32 fifoStart, u32 fifoEnd)
 {
   // m_IsRecording is assumed to be true at this point, otherwise this function would not be called
-  std::lock_guard lk(m_mutex);
-
   m_FrameEnded = true;
 
   m_CurrentFrame.fifoStart = fifoStart;
@@ -427,20 +475,23 @@ void FifoRecorder::EndFrame(u32 fifoStart, u32 fifoEnd)
     m_FifoData.clear();
   }
 
-  if (m_RequestedRecordingEnd)
+  m_FrameIsLast = m_RequestedRecordingEnd;
+  if (m_FrameIsLast)
   {
     // Skip data after the next time WriteFifoData is called
     m_SkipFutureData = true;
     // Signal video backend that it should not call this function when the next frame ends
     m_IsRecording = false;
+
+    // The recording was stopped before its first frame ended, so no frame will be handed over
+    if (!m_FrameEnded)
+      QueueEndOfRecording();
   }
 }
 
 void FifoRecorder::SetVideoMemory(const u32* bpMem, const u32* cpMem, const u32* xfMem,
                                   const u32* xfRegs, u32 xfRegsSize, const u8* texMem_ptr)
 {
-  std::lock_guard lk(m_mutex);
-
   if (m_File)
   {
     memcpy(m_File->GetBPMem(), bpMem, FifoDataFile::BP_MEM_SIZE * 4);
@@ -460,3 +511,51 @@ bool FifoRecorder::IsRecording() const
 {
   return m_IsRecording;
 }
+
+void FifoRecorder::StartWriterThread()
+{
+  m_writer_thread = std::thread(&FifoRecorder::WriterThreadMain, this);
+}
+
+void FifoRecorder::StopWriterThread()
+{
+  if (!m_writer_thread.joinable())
+    return;
+
+  m_writer_thread_exiting.Set();
+  m_frame_queued.Set();
+  m_writer_thread.join();
+  m_writer_thread_exiting.Clear();
+}
+
+void FifoRecorder::WriterThreadMain()
+{
+  Common::SetCurrentThreadName("FIFO Recorder Writer");
+
+  while (true)
+  {
+    m_frame_queued.Wait();
+
+    RecordedFrame frame;
+    while (m_frame_queue.Pop(frame))
+    {
+      if (!frame.info.fifoData.empty())
+      {
+        // The FIFO data buffer is reserved for the largest frames
+        frame.info.fifoData.shrink_to_fit();
+        m_File->AddFrame(std::move(frame.info));
+      }
+
+      if (frame.is_last)
+      {
+        m_recording_done.Set();
+        if (m_FinishedCb)
+          m_FinishedCb();
+        return;
+      }
+    }
+
+    if (m_writer_thread_exiting.IsSet())
+      return;
+  }
+}
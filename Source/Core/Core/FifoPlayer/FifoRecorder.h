@@ -3,13 +3,18 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
-#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/HookableEvent.h"
+#include "Common/SPSCQueue.h"
 #include "Core/FifoPlayer/FifoDataFile.h"
 
 namespace Core
@@ -29,18 +34,25 @@ public:
   FifoRecorder& operator=(FifoRecorder&&) = delete;
   ~FifoRecorder();
 
+  // finishedCb is called on the writer thread once the last frame was added to the file.
   void StartRecording(s32 numFrames, CallbackFunc finishedCb);
   void StopRecording();
 
+  // Called once the video thread has stopped. A recording which is still running ends with the
+  // frames recorded so far.
+  void Shutdown();
+
   bool IsRecordingDone() const;
 
+  // Must not be accessed before the recording is done.
   FifoDataFile* GetRecordedFile() const;
   // Called from video thread
 
   // Must write one full GP command at a time
   void WriteGPCommand(const u8* data, u32 size);
 
-  // Track memory that has been used and write it to the fifolog if it has changed.
+  // Track memory that has been used and write it to the fifolog if it has changed. With write
+  // tracking, ranges which weren't written since they were last used aren't compared again.
   // If memory is updated by the video backend (dynamicUpdate == true) take special care to make
   // sure the data
   // isn't baked into the fifolog.
@@ -60,23 +72,54 @@ public:
 private:
   class FifoRecordAnalyzer;
 
+  struct RecordedFrame
+  {
+    // Empty if the recording ended without another frame to add
+    FifoFrameInfo info;
+    bool is_last = false;
+  };
+
+  // Memory that was copied to m_Ram or m_ExRam, and the write tracking stamp from before the copy.
+  struct RecordedRange
+  {
+    u32 size;
+    u64 stamp;
+  };
+
   void RecordInitialVideoMemory();
 
+  void QueueEndedFrame(bool is_last);
+  void QueueEndOfRecording();
+
+  void StartWriterThread();
+  void StopWriterThread();
+  void WriterThreadMain();
+
   // Accessed from both GUI and video threads
 
-  std::recursive_mutex m_mutex;
   // True if video thread should send data
-  bool m_IsRecording = false;
-  // True if m_IsRecording was true during last frame
-  bool m_WasRecording = false;
-  bool m_RequestedRecordingEnd = false;
+  std::atomic<bool> m_IsRecording = false;
+  std::atomic<bool> m_RequestedRecordingEnd = false;
+  Common::Flag m_recording_done;
+  // Written by the GUI thread before recording starts
   s32 m_RecordFramesRemaining = 0;
   CallbackFunc m_FinishedCb;
   std::unique_ptr<FifoDataFile> m_File;
 
+  // Finished frames are added to m_File on the writer thread, so that the video thread never has
+  // to wait for the GUI thread or copy a frame.
+  Common::SPSCQueue<RecordedFrame, false> m_frame_queue;
+  Common::Event m_frame_queued;
+  Common::Flag m_writer_thread_exiting;
+  std::thread m_writer_thread;
+
   // Accessed only from video thread
 
+  // True if m_IsRecording was true during last frame
+  bool m_WasRecording = false;
   bool m_SkipNextData = true;
+  // True if the frame which ended last is the last one that will be recorded
+  bool m_FrameIsLast = false;
   bool m_SkipFutureData = true;
   bool m_FrameEnded = false;
   FifoFrameInfo m_CurrentFrame;
@@ -84,6 +127,7 @@ private:
   std::vector<u8> m_FifoData;
   std::vector<u8> m_Ram;
   std::vector<u8> m_ExRam;
+  std::unordered_map<u32, RecordedRange> m_recorded_ranges;
 
   Common::EventHook m_end_of_frame_event;
 
@@ -6,6 +6,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Common/Trace.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
@@ -64,6 +65,8 @@ void DSPHLE::SendMailToDSP(u32 mail)
 {
   if (m_ucode != nullptr)
   {
+    TRACE_SCOPE("DSP HLE mail");
+
     DEBUG_LOG_FMT(DSP_MAIL, "CPU writes {:#010x}", mail);
     m_ucode->HandleMail(mail);
   }
@@ -78,6 +78,7 @@ void HLEMemory_Write_U16LE(Memory::MemoryManager& memory, u32 address, u16 value
     std::memcpy(&memory.GetEXRAM()[address & memory.GetExRamMask()], &value, sizeof(u16));
   else
     std::memcpy(&memory.GetRAM()[address & memory.GetRamMask()], &value, sizeof(u16));
+  memory.NotifyWrite(address, sizeof(u16));
 }
 
 void HLEMemory_Write_U16(Memory::MemoryManager& memory, u32 address, u16 value)
@@ -108,6 +109,7 @@ void HLEMemory_Write_U32LE(Memory::MemoryManager& memory, u32 address, u32 value
     std::memcpy(&memory.GetEXRAM()[address & memory.GetExRamMask()], &value, sizeof(u32));
   else
     std::memcpy(&memory.GetRAM()[address & memory.GetRamMask()], &value, sizeof(u32));
+  memory.NotifyWrite(address, sizeof(u32));
 }
 
 void HLEMemory_Write_U32(Memory::MemoryManager& memory, u32 address, u32 value)
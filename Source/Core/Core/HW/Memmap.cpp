@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstring>
 #include <memory>
 #include <span>
@@ -19,8 +20,10 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/HW/AudioInterface.h"
@@ -33,6 +36,7 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
+#include "Core/MemTools.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -154,6 +158,7 @@ void MemoryManager::Init()
   InitMMIO(wii);
 
   Clear();
+  InitWriteTracking();
 
   INFO_LOG_FMT(MEMMAP, "Memory system initialized. RAM at {}", fmt::ptr(m_ram));
   m_is_initialized = true;
@@ -211,6 +216,9 @@ bool MemoryManager::InitFastmemArena()
   m_physical_base = m_fastmem_arena + guard_size;
   m_logical_base = m_fastmem_arena + ppc_view_size + guard_size * 2;
 
+  // The new views aren't write protected.
+  ResetWriteProtection();
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -235,6 +243,10 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // The new logical views aren't write protected.
+  ResetWriteProtection();
+  std::lock_guard lock(m_write_protection_lock);
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -279,7 +291,7 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, intersection_start});
           }
 
           m_logical_page_mappings[i] =
@@ -337,6 +349,13 @@ void MemoryManager::DoState(PointerWrap& p)
   if (current_have_exram)
     p.DoArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
+
+  if (p.IsReadMode())
+  {
+    NotifyWrite(0, current_ram_size);
+    if (current_have_exram)
+      NotifyWrite(0x10000000, current_exram_size);
+  }
 }
 
 void MemoryManager::Shutdown()
@@ -362,6 +381,9 @@ void MemoryManager::ShutdownFastmemArena()
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  ResetWriteProtection();
+  std::lock_guard lock(m_write_protection_lock);
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -446,6 +468,7 @@ void MemoryManager::CopyToEmu(u32 address, const void* data, size_t size)
     return;
   }
   memcpy(pointer, data, size);
+  NotifyWrite(address, size);
 }
 
 void MemoryManager::Memset(u32 address, u8 value, size_t size)
@@ -460,6 +483,7 @@ void MemoryManager::Memset(u32 address, u8 value, size_t size)
     return;
   }
   memset(pointer, value, size);
+  NotifyWrite(address, size);
 }
 
 std::string MemoryManager::GetString(u32 em_address, size_t size)
@@ -573,4 +597,244 @@ void MemoryManager::Write_U64_Swap(u64 value, u32 address)
   CopyToEmu(address, &value, sizeof(value));
 }
 
+void MemoryManager::InitWriteTracking()
+{
+  m_write_tracking_enabled = false;
+  m_page_write_stamps.reset();
+  m_page_protect_stamps.reset();
+  m_write_tracking_pages = 0;
+  m_last_write_stamp = 0;
+
+  if (!Config::Get(Config::GFX_HACK_TEXTURE_WRITE_TRACKING))
+    return;
+
+#if defined(_M_ARM_64) && defined(__APPLE__)
+  // Pages can't be write protected, so JIT stores through fastmem would go unnoticed.
+  WARN_LOG_FMT(MEMMAP, "Write tracking is not supported on this platform.");
+  return;
+#else
+  if (!EMM::IsExceptionHandlerSupported())
+  {
+    WARN_LOG_FMT(MEMMAP, "Write tracking requires fault handling, which is not supported.");
+    return;
+  }
+
+  // Tracking pages must be whole host pages. Larger pages make the tracking coarser, but the
+  // logical views are mapped in BAT pages, so host pages must not be larger than those.
+  const size_t page_size = std::max<size_t>(Common::PageSize(), 0x1000);
+  if (!std::has_single_bit(page_size) || page_size > PowerPC::BAT_PAGE_SIZE)
+  {
+    WARN_LOG_FMT(MEMMAP, "Write tracking is not supported with {} byte pages.", page_size);
+    return;
+  }
+
+  m_write_tracking_page_shift = static_cast<u32>(std::countr_zero(page_size));
+  m_write_tracking_ram_pages = GetRamSize() >> m_write_tracking_page_shift;
+  const u32 exram_pages = m_exram ? GetExRamSize() >> m_write_tracking_page_shift : 0;
+  m_write_tracking_pages = m_write_tracking_ram_pages + exram_pages;
+
+  m_page_write_stamps = std::make_unique<std::atomic<u64>[]>(m_write_tracking_pages);
+  m_page_protect_stamps = std::make_unique<std::atomic<u64>[]>(m_write_tracking_pages);
+  m_write_tracking_enabled = true;
+  INFO_LOG_FMT(MEMMAP, "Write tracking enabled for {} pages of {} bytes.", m_write_tracking_pages,
+               page_size);
+#endif
+}
+
+void MemoryManager::DisableWriteTracking()
+{
+  if (!IsWriteTrackingEnabled())
+    return;
+
+  ResetWriteProtection();
+  m_write_tracking_enabled = false;
+  INFO_LOG_FMT(MEMMAP, "Write tracking disabled.");
+}
+
+std::optional<u32> MemoryManager::GetWriteTrackingPage(u32 address) const
+{
+  // This matches the address decoding of GetSpanForAddress.
+  address &= 0x3FFFFFFF;
+  if (address < GetRamSize())
+    return address >> m_write_tracking_page_shift;
+
+  if (m_exram && (address >> 28) == 0x1 && (address & 0x0fffffff) < GetExRamSize())
+    return m_write_tracking_ram_pages + ((address & GetExRamMask()) >> m_write_tracking_page_shift);
+
+  return std::nullopt;
+}
+
+u32 MemoryManager::GetWriteTrackingPageAddress(u32 page) const
+{
+  if (page < m_write_tracking_ram_pages)
+    return page << m_write_tracking_page_shift;
+
+  return 0x10000000 | (page - m_write_tracking_ram_pages) << m_write_tracking_page_shift;
+}
+
+u64 MemoryManager::WatchRange(u32 address, u32 size)
+{
+  if (!IsWriteTrackingEnabled() || size == 0)
+    return 0;
+
+  const std::optional<u32> first_page = GetWriteTrackingPage(address);
+  const std::optional<u32> last_page = GetWriteTrackingPage(address + size - 1);
+  if (!first_page || !last_page || *last_page < *first_page)
+    return 0;
+
+  // The stamp is reserved before the pages are checked, so any write stamp taken afterwards is
+  // newer. A page which isn't protected, or which was written since it was last protected, is
+  // protected again. A store which hits a page before that is either visible to the caller's
+  // subsequent reads, or gets a newer stamp.
+  // Stamps start at 0, which is reserved for ranges that aren't tracked.
+  std::lock_guard lock(m_write_protection_lock);
+  const u64 stamp = m_last_write_stamp.fetch_add(1) + 1;
+  for (u32 page = *first_page; page <= *last_page; ++page)
+  {
+    const u64 protect_stamp = m_page_protect_stamps[page].load();
+    if (protect_stamp == 0 || m_page_write_stamps[page].load() >= protect_stamp)
+    {
+      m_page_protect_stamps[page].store(stamp);
+      SetPageWriteProtection(page, true);
+    }
+  }
+
+  return stamp;
+}
+
+bool MemoryManager::WasRangeWritten(u32 address, u32 size, u64 stamp) const
+{
+  if (!IsWriteTrackingEnabled() || stamp == 0 || size == 0)
+    return true;
+
+  const std::optional<u32> first_page = GetWriteTrackingPage(address);
+  const std::optional<u32> last_page = GetWriteTrackingPage(address + size - 1);
+  if (!first_page || !last_page || *last_page < *first_page)
+    return true;
+
+  for (u32 page = *first_page; page <= *last_page; ++page)
+  {
+    if (m_page_write_stamps[page].load(std::memory_order_acquire) >= stamp)
+      return true;
+  }
+  return false;
+}
+
+void MemoryManager::MarkRangeWritten(u32 address, size_t size)
+{
+  if (size == 0)
+    return;
+
+  const std::optional<u32> first_page = GetWriteTrackingPage(address);
+  const std::optional<u32> last_page = GetWriteTrackingPage(address + static_cast<u32>(size) - 1);
+  if (!first_page || !last_page || *last_page < *first_page)
+    return;
+
+  const u64 stamp = m_last_write_stamp.fetch_add(1) + 1;
+  for (u32 page = *first_page; page <= *last_page; ++page)
+    MarkPageWritten(page, stamp);
+}
+
+void MemoryManager::MarkPageWritten(u32 page, u64 stamp)
+{
+  // Writers on different threads may race, so the stamp must never go backwards.
+  std::atomic<u64>& page_stamp = m_page_write_stamps[page];
+  u64 previous = page_stamp.load(std::memory_order_relaxed);
+  while (previous < stamp &&
+         !page_stamp.compare_exchange_weak(previous, stamp, std::memory_order_release))
+  {
+  }
+}
+
+void MemoryManager::SetPageWriteProtection(u32 page, bool write_protected)
+{
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  const u32 page_size = 1u << m_write_tracking_page_shift;
+  const u32 address = GetWriteTrackingPageAddress(page);
+  const auto set_protection = [&](u8* pointer) {
+    if (write_protected)
+      Common::WriteProtectMemory(pointer, page_size);
+    else
+      Common::UnWriteProtectMemory(pointer, page_size);
+  };
+
+  set_protection(m_physical_base + address);
+  for (const LogicalMemoryView& view : m_logical_mapped_entries)
+  {
+    if (address >= view.physical_address && address - view.physical_address < view.mapped_size)
+      set_protection(static_cast<u8*>(view.mapped_pointer) + (address - view.physical_address));
+  }
+}
+
+void MemoryManager::ResetWriteProtection()
+{
+  if (!IsWriteTrackingEnabled())
+    return;
+
+  std::lock_guard lock(m_write_protection_lock);
+  const u64 stamp = m_last_write_stamp.fetch_add(1) + 1;
+  for (u32 page = 0; page < m_write_tracking_pages; ++page)
+  {
+    if (m_page_protect_stamps[page].exchange(0, std::memory_order_relaxed) == 0)
+      continue;
+
+    SetPageWriteProtection(page, false);
+    MarkPageWritten(page, stamp);
+  }
+}
+
+bool MemoryManager::HandleWriteTrackingFault(uintptr_t fault_address)
+{
+  if (!IsWriteTrackingEnabled() || !IsAddressInFastmemArea(reinterpret_cast<u8*>(fault_address)))
+    return false;
+
+  // Find the RAM or EXRAM page backing the faulting host address. Faults anywhere else are for
+  // the JIT to handle.
+  const u8* host_address = reinterpret_cast<u8*>(fault_address);
+  const u8* backing = nullptr;
+  if (host_address >= m_physical_base && host_address - m_physical_base < 0x1'0000'0000)
+  {
+    const u32 physical_address = static_cast<u32>(host_address - m_physical_base);
+    if (physical_address < GetRamSize())
+      backing = m_ram + physical_address;
+    else if (m_exram && physical_address >= 0x10000000 &&
+             physical_address - 0x10000000 < GetExRamSize())
+      backing = m_exram + (physical_address - 0x10000000);
+  }
+  else if (host_address >= m_logical_base && host_address - m_logical_base < 0x1'0000'0000)
+  {
+    const u32 logical_address = static_cast<u32>(host_address - m_logical_base);
+    const u32 bat_index = logical_address >> PowerPC::BAT_INDEX_SHIFT;
+    const u8* mapping = static_cast<const u8*>(m_logical_page_mappings[bat_index]);
+    if (mapping)
+      backing = mapping + (logical_address & (PowerPC::BAT_PAGE_SIZE - 1));
+  }
+
+  std::optional<u32> page;
+  if (backing && backing >= m_ram && backing < m_ram + GetRamSize())
+    page = GetWriteTrackingPage(static_cast<u32>(backing - m_ram));
+  else if (backing && m_exram && backing >= m_exram && backing < m_exram + GetExRamSize())
+    page = GetWriteTrackingPage(0x10000000 | static_cast<u32>(backing - m_exram));
+  if (!page)
+    return false;
+
+  // This runs in a signal handler, so it must not take locks. Fastmem stores only fault on the CPU
+  // thread, which is also the only thread that remaps the logical views while the CPU is running,
+  // so the views can't change here.
+  //
+  // The page is marked as unprotected before it is unprotected, and the write stamp is only taken
+  // afterwards. A WatchRange which runs in between sees the mark and protects the page again. If
+  // it does so before the page is unprotected here, its stamp is older than the write stamp, so
+  // the range counts as written. Otherwise the page stays protected and the retried store faults
+  // again. A WatchRange which runs before the mark has reserved an older stamp than the write
+  // stamp too. RAM is only ever protected for write tracking, so the store can always be retried,
+  // even if the page was already unprotected.
+  m_page_protect_stamps[*page].store(0);
+  SetPageWriteProtection(*page, false);
+  MarkPageWritten(*page, m_last_write_stamp.fetch_add(1) + 1);
+  return true;
+}
+
 }  // namespace Memory
@@ -4,7 +4,11 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -54,6 +58,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
 };
 
 class MemoryManager
@@ -153,8 +158,41 @@ public:
 
     for (size_t i = 0; i < size / sizeof(T); i++)
       dest[i] = Common::FromBigEndian(data[i]);
+
+    NotifyWrite(address, size);
   }
 
+  // Write tracking lets caches of data derived from guest memory, like the texture cache, skip
+  // validating that data while nothing has written to the pages backing it. Every page of RAM and
+  // EXRAM has a stamp of its last write.
+  //
+  // Watched pages are write protected in the fastmem views, so JIT stores to them fault once and
+  // are recorded by HandleWriteTrackingFault. All other writes have to go through MMU, CopyToEmu,
+  // Memset or the Write functions, or call NotifyWrite after writing through a raw pointer.
+  bool IsWriteTrackingEnabled() const
+  {
+    return m_write_tracking_enabled.load(std::memory_order_relaxed);
+  }
+  // For CPU emulation modes whose stores can't be tracked. Tracking stays off until the next boot.
+  void DisableWriteTracking();
+
+  // Starts watching the physical range. Returns the stamp to pass to WasRangeWritten, or 0 if
+  // the range can't be tracked. Data read from the range after this call is at least as new as the
+  // stamp.
+  u64 WatchRange(u32 address, u32 size);
+  bool WasRangeWritten(u32 address, u32 size, u64 stamp) const;
+
+  // Must be called after the data has been written, so that readers never see a stamp which is
+  // newer than the data.
+  void NotifyWrite(u32 address, size_t size)
+  {
+    if (IsWriteTrackingEnabled())
+      MarkRangeWritten(address, size);
+  }
+
+  // Called by the fault handler. Returns true if the fault was a store to a watched page.
+  bool HandleWriteTrackingFault(uintptr_t fault_address);
+
 private:
   // Base is a pointer to the base of the memory map. Yes, some MMU tricks
   // are used to set up a full GC or Wii memory map in process memory.
@@ -254,6 +292,31 @@ private:
 
   Core::System& m_system;
 
+  // Write tracking state. Pages are the size of host pages, so they can be protected individually.
+  // The RAM pages come first, followed by the EXRAM pages.
+  std::atomic<bool> m_write_tracking_enabled = false;
+  u32 m_write_tracking_page_shift = 12;
+  u32 m_write_tracking_ram_pages = 0;
+  u32 m_write_tracking_pages = 0;
+  std::atomic<u64> m_last_write_stamp = 0;
+  std::unique_ptr<std::atomic<u64>[]> m_page_write_stamps;
+  // The stamp of the last WatchRange which write protected each page, or 0 if the page isn't
+  // protected. The fault handler resets it to 0 before unprotecting a page. A page written at or
+  // after this stamp is protected again by the next WatchRange as well. The fault handler only
+  // uses these atomics and never takes a lock.
+  std::unique_ptr<std::atomic<u64>[]> m_page_protect_stamps;
+  // Protects the fastmem views against concurrent changes outside of the fault handler.
+  std::mutex m_write_protection_lock;
+
   void InitMMIO(bool is_wii);
+
+  void InitWriteTracking();
+  std::optional<u32> GetWriteTrackingPage(u32 address) const;
+  u32 GetWriteTrackingPageAddress(u32 page) const;
+  void MarkRangeWritten(u32 address, size_t size);
+  void MarkPageWritten(u32 page, u64 stamp);
+  void SetPageWriteProtection(u32 page, bool write_protected);
+  // Unprotects all pages, marking them as written, as writes to them would go unnoticed from now.
+  void ResetWriteProtection();
 };
 }  // namespace Memory
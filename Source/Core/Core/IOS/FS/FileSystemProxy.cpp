@@ -326,8 +326,10 @@ std::optional<IPCReply> FSDevice::Read(const ReadWriteRequest& request)
   return MakeIPCReply([&](Ticks t) {
     auto& system = GetSystem();
     auto& memory = system.GetMemory();
-    return m_core.Read(request.fd, memory.GetPointerForRange(request.buffer, request.size),
-                       request.size, request.buffer, t);
+    u8* const buffer = memory.GetPointerForRange(request.buffer, request.size);
+    const s32 result = m_core.Read(request.fd, buffer, request.size, request.buffer, t);
+    memory.NotifyWrite(request.buffer, request.size);
+    return result;
   });
 }
 
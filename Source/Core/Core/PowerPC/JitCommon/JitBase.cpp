@@ -138,6 +138,12 @@ void JitBase::RefreshConfig()
   jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && (m_ppc_state.msr.DR || !any_watchpoints) &&
                EMM::IsExceptionHandlerSupported();
   jo.memcheck = m_system.IsMMUMode() || m_system.IsPauseOnPanicMode() || any_watchpoints;
+
+#ifdef _M_ARM_64
+  // Without fastmem, JitArm64 stores through the page mappings, which write tracking can't see.
+  if (!jo.fastmem)
+    m_system.GetMemory().DisableWriteTracking();
+#endif
   jo.fp_exceptions = m_enable_float_exceptions;
   jo.div_by_zero_exceptions = m_enable_div_by_zero_exceptions;
 }
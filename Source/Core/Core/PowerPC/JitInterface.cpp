@@ -204,6 +204,10 @@ std::size_t JitInterface::GetBlockCount() const
 
 bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
 {
+  // Stores to pages watched by the write tracking fault once, and are then simply retried.
+  if (m_system.GetMemory().HandleWriteTrackingFault(access_address))
+    return true;
+
   // Prevent nullptr dereference on a crash with no JIT present
   if (!m_jit)
   {
@@ -0,0 +1,161 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+#include "Common/Config/Config.h"
+#include "Common/Timer.h"
+#include "Core/Config/MainSettings.h"
+#include "VideoCommon/VideoEvents.h"
+
+static float ElapsedMs(u64 start_us, u64 end_us)
+{
+  return static_cast<float>(end_us - start_us) / 1000.0f;
+}
+
+// Nearest-rank percentiles of the samples.
+static picojson::object Summarize(std::vector<float> samples)
+{
+  picojson::object summary;
+  summary["samples"] = picojson::value(static_cast<double>(samples.size()));
+  if (samples.empty())
+    return summary;
+
+  std::ranges::sort(samples);
+  const auto percentile = [&samples](double p) {
+    const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * samples.size()));
+    return picojson::value(static_cast<double>(samples[std::max<size_t>(rank, 1) - 1]));
+  };
+
+  const double sum = std::accumulate(samples.begin(), samples.end(), 0.0);
+  summary["mean"] = picojson::value(sum / samples.size());
+  summary["p50"] = percentile(50);
+  summary["p90"] = percentile(90);
+  summary["p95"] = percentile(95);
+  summary["p99"] = percentile(99);
+  summary["max"] = picojson::value(static_cast<double>(samples.back()));
+  return summary;
+}
+
+Benchmark::Benchmark(u32 warmup_frames, u32 frames, std::function<void()> on_finished)
+    : m_warmup_frames(std::max(warmup_frames, 1u)), m_frames(frames),
+      m_on_finished(std::move(on_finished))
+{
+  m_cpu_field_ms.reserve(frames * 2);
+  m_gpu_frame_interval_ms.reserve(frames);
+  m_present_ms.reserve(frames);
+  g_stats.time_gpu_thread_parts = true;
+
+  m_vi_end_field_hook = VIEndFieldEvent::Register([this] { OnVIEndField(); }, "Benchmark");
+  m_after_frame_hook =
+      AfterFrameEvent::Register([this](Core::System&) { OnAfterFrame(); }, "Benchmark");
+  m_before_present_hook =
+      BeforePresentEvent::Register([this](PresentInfo&) { OnBeforePresent(); }, "Benchmark");
+  m_after_present_hook =
+      AfterPresentEvent::Register([this](PresentInfo&) { OnAfterPresent(); }, "Benchmark");
+}
+
+Benchmark::~Benchmark()
+{
+  g_stats.time_gpu_thread_parts = false;
+}
+
+void Benchmark::OnVIEndField()
+{
+  if (m_state.load() != State::Timing)
+  {
+    m_last_field_us = 0;
+    return;
+  }
+
+  const u64 now = Common::Timer::NowUs();
+  if (m_last_field_us != 0)
+    m_cpu_field_ms.push_back(ElapsedMs(m_last_field_us, now));
+  m_last_field_us = now;
+}
+
+void Benchmark::OnAfterFrame()
+{
+  const u64 now = Common::Timer::NowUs();
+  switch (m_state.load())
+  {
+  case State::WarmingUp:
+    // Timing starts at the end of the last warmup frame, so the first timed frame has a start.
+    if (++m_frame_count == m_warmup_frames)
+    {
+      m_frame_count = 0;
+      m_start_us = now;
+      m_last_frame_us = now;
+      m_start_part_time = g_stats.gpu_thread_part_time;
+      m_state.store(State::Timing);
+    }
+    break;
+
+  case State::Timing:
+    m_gpu_frame_interval_ms.push_back(ElapsedMs(m_last_frame_us, now));
+    m_last_frame_us = now;
+    m_end_part_time = g_stats.gpu_thread_part_time;
+    if (++m_frame_count == m_frames)
+    {
+      m_end_us = now;
+      m_state.store(State::Finished);
+      m_on_finished();
+    }
+    break;
+
+  case State::Finished:
+    break;
+  }
+}
+
+void Benchmark::OnBeforePresent()
+{
+  m_present_start_us = m_state.load() == State::Timing ? Common::Timer::NowUs() : 0;
+}
+
+void Benchmark::OnAfterPresent()
+{
+  if (m_present_start_us == 0 || m_state.load() != State::Timing)
+    return;
+
+  m_present_ms.push_back(ElapsedMs(m_present_start_us, Common::Timer::NowUs()));
+  m_present_start_us = 0;
+}
+
+picojson::value Benchmark::GetReport() const
+{
+  // If emulation stopped early, report the frames which were timed.
+  const bool finished = IsFinished();
+  const u64 end_us = finished ? m_end_us : m_last_frame_us;
+  const double seconds = m_start_us != 0 ? (end_us - m_start_us) / 1000000.0 : 0.0;
+
+  picojson::object report;
+  report["finished"] = picojson::value(finished);
+  report["warmup_frames"] = picojson::value(static_cast<double>(m_warmup_frames));
+  report["frames"] = picojson::value(static_cast<double>(m_gpu_frame_interval_ms.size()));
+  report["seconds"] = picojson::value(seconds);
+  report["fps"] = picojson::value(seconds > 0.0 ? m_gpu_frame_interval_ms.size() / seconds : 0.0);
+  report["video_backend"] = picojson::value(Config::Get(Config::MAIN_GFX_BACKEND));
+  report["dual_core"] = picojson::value(Config::Get(Config::MAIN_CPU_THREAD));
+  report["cpu_thread_field_ms"] = picojson::value(Summarize(m_cpu_field_ms));
+  report["gpu_thread_frame_interval_ms"] = picojson::value(Summarize(m_gpu_frame_interval_ms));
+  report["backend_present_ms"] = picojson::value(Summarize(m_present_ms));
+
+  // Totals over all timed frames, excluding the time spent in nested parts.
+  const auto part_ms = [this](GPUThreadPart part) {
+    const auto time = m_end_part_time[part] - m_start_part_time[part];
+    return picojson::value(std::chrono::duration<double, std::milli>(time).count());
+  };
+  picojson::object parts;
+  parts["opcode_decoding"] = part_ms(GPUThreadPart::OpcodeDecoding);
+  parts["vertex_loading"] = part_ms(GPUThreadPart::VertexLoading);
+  parts["texture_decoding"] = part_ms(GPUThreadPart::TextureDecoding);
+  parts["drawing"] = part_ms(GPUThreadPart::Drawing);
+  report["gpu_thread_part_ms"] = picojson::value(std::move(parts));
+  return picojson::value(std::move(report));
+}
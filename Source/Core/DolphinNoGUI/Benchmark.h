@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+#include "Common/HookableEvent.h"
+#include "VideoCommon/Statistics.h"
+
+// Times a fixed number of frames, for catching performance regressions without a GPU or a display.
+// Each frame is timed on the CPU thread from one end of a VI field to the next, on the GPU thread
+// as the interval from one XFB copy to the next, and in the backend from the start to the end of
+// its present.
+// The time the GPU thread spends in each GPUThreadPart is added up over all timed frames.
+class Benchmark
+{
+public:
+  // The first warmup_frames frames aren't timed, as they are slowed down by one-off work like
+  // compiling shaders. At least one frame is run before timing starts, so that the first timed
+  // frame has a start. on_finished is called on the GPU thread once all frames were timed.
+  Benchmark(u32 warmup_frames, u32 frames, std::function<void()> on_finished);
+  ~Benchmark();
+
+  bool IsFinished() const { return m_state.load() == State::Finished; }
+
+  // Must not be called before emulation has stopped.
+  picojson::value GetReport() const;
+
+private:
+  enum class State
+  {
+    WarmingUp,
+    Timing,
+    Finished,
+  };
+
+  void OnVIEndField();
+  void OnAfterFrame();
+  void OnBeforePresent();
+  void OnAfterPresent();
+
+  const u32 m_warmup_frames;
+  const u32 m_frames;
+  std::function<void()> m_on_finished;
+
+  std::atomic<State> m_state = State::WarmingUp;
+  u32 m_frame_count = 0;
+  u64 m_start_us = 0;
+  u64 m_end_us = 0;
+
+  using PartTimes = Common::EnumMap<std::chrono::nanoseconds, GPUThreadPart::Drawing>;
+  PartTimes m_start_part_time{};
+  PartTimes m_end_part_time{};
+
+  // Only touched by the thread which times them until emulation stops.
+  u64 m_last_field_us = 0;
+  u64 m_last_frame_us = 0;
+  u64 m_present_start_us = 0;
+  std::vector<float> m_cpu_field_ms;
+  std::vector<float> m_gpu_frame_interval_ms;
+  std::vector<float> m_present_ms;
+
+  Common::EventHook m_vi_end_field_hook;
+  Common::EventHook m_after_frame_hook;
+  Common::EventHook m_before_present_hook;
+  Common::EventHook m_after_present_hook;
+};
@@ -17,10 +17,14 @@
 #include <Windows.h>
 #endif
 
+#include "Common/Config/Config.h"
+#include "Common/JsonUtil.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/Host.h"
@@ -32,6 +36,8 @@
 #endif
 #include "UICommon/UICommon.h"
 
+#include "DolphinNoGUI/Benchmark.h"
+
 #include "InputCommon/GCAdapter.h"
 
 #include "VideoCommon/VideoBackendBase.h"
@@ -228,6 +234,20 @@ int main(int argc, char* argv[])
             "macos"
 #endif
       });
+  parser->add_option("--benchmark_frames")
+      .action("store")
+      .type("int")
+      .help("Run unthrottled for the given number of frames, then write a timing report and exit. "
+            "Use with the headless platform and the Null or Software video backend to benchmark "
+            "without a display.");
+  parser->add_option("--benchmark_warmup")
+      .action("store")
+      .type("int")
+      .help("Number of frames to run before the benchmark starts timing. At least one frame is "
+            "always run first.");
+  parser->add_option("--benchmark_report")
+      .action("store")
+      .help("JSON file to write the benchmark report to, instead of stdout");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -302,6 +322,26 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  std::unique_ptr<Benchmark> benchmark;
+  if (options.is_set("benchmark_frames"))
+  {
+    const int frames = options.get("benchmark_frames");
+    const int warmup_frames = options.get("benchmark_warmup");
+    if (frames <= 0 || warmup_frames < 0)
+    {
+      fprintf(stderr, "Invalid number of benchmark frames\n");
+      return 1;
+    }
+
+    // Run as fast as possible, and keep replaying FIFO logs until all frames were timed.
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    Config::SetCurrent(Config::GFX_VSYNC, false);
+    Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+
+    benchmark = std::make_unique<Benchmark>(static_cast<u32>(warmup_frames),
+                                            static_cast<u32>(frames), [] { s_platform->Stop(); });
+  }
+
   Core::AddOnStateChangedCallback([](Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -338,6 +378,28 @@ int main(int argc, char* argv[])
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
+  if (benchmark)
+  {
+    const picojson::value report = benchmark->GetReport();
+    if (options.is_set("benchmark_report"))
+    {
+      const std::string report_path = static_cast<const char*>(options.get("benchmark_report"));
+      if (!JsonToFile(report_path, report, true))
+      {
+        fprintf(stderr, "Could not write the benchmark report to %s\n", report_path.c_str());
+        return 1;
+      }
+    }
+    else
+    {
+      fprintf(stdout, "%s\n", report.serialize(true).c_str());
+    }
+
+    // Emulation stopped before all frames were timed.
+    if (!benchmark->IsFinished())
+      return 1;
+  }
+
   return 0;
 }
 
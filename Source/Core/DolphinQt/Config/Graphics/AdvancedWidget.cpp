@@ -70,6 +70,8 @@ void AdvancedWidget::CreateWidgets()
   m_show_ftimes = new ConfigBool(tr("Show Frame Times"), Config::GFX_SHOW_FTIMES, m_game_layer);
   m_show_vps = new ConfigBool(tr("Show VPS"), Config::GFX_SHOW_VPS, m_game_layer);
   m_show_vtimes = new ConfigBool(tr("Show VBlank Times"), Config::GFX_SHOW_VTIMES, m_game_layer);
+  m_show_frame_pacing =
+      new ConfigBool(tr("Show Frame Pacing"), Config::GFX_SHOW_FRAME_PACING, m_game_layer);
   m_show_graphs =
       new ConfigBool(tr("Show Performance Graphs"), Config::GFX_SHOW_GRAPHS, m_game_layer);
   m_show_speed = new ConfigBool(tr("Show % Speed"), Config::GFX_SHOW_SPEED, m_game_layer);
@@ -90,6 +92,7 @@ void AdvancedWidget::CreateWidgets()
   performance_layout->addWidget(m_perf_samp_window, 3, 1);
   performance_layout->addWidget(m_log_render_time, 4, 0);
   performance_layout->addWidget(m_show_speed_colors, 4, 1);
+  performance_layout->addWidget(m_show_frame_pacing, 5, 0);
 
   // Debugging
   auto* debugging_box = new QGroupBox(tr("Debugging"));
@@ -106,12 +109,14 @@ void AdvancedWidget::CreateWidgets()
       new ConfigBool(tr("Texture Format Overlay"), Config::GFX_TEXFMT_OVERLAY_ENABLE, m_game_layer);
   m_enable_api_validation = new ConfigBool(tr("Enable API Validation Layers"),
                                            Config::GFX_ENABLE_VALIDATION_LAYER, m_game_layer);
+  m_gpu_profiler = new ConfigBool(tr("Profile GPU Passes"), Config::GFX_GPU_PROFILER, m_game_layer);
 
   debugging_layout->addWidget(m_enable_wireframe, 0, 0);
   debugging_layout->addWidget(m_show_statistics, 0, 1);
   debugging_layout->addWidget(m_enable_format_overlay, 1, 0);
   debugging_layout->addWidget(m_show_proj_statistics, 1, 1);
   debugging_layout->addWidget(m_enable_api_validation, 2, 0);
+  debugging_layout->addWidget(m_gpu_profiler, 2, 1);
 
   // Utility
   auto* utility_box = new QGroupBox(tr("Utility"));
@@ -301,6 +306,12 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Shows the average time in ms between each rendered frame alongside "
                  "the standard deviation.<br><br><dolphin_emphasis>If unsure, leave this "
                  "unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_FRAME_PACING_DESCRIPTION[] =
+      QT_TR_NOOP("Shows the 50th, 95th and 99th percentile of the time between presented frames "
+                 "and of the latency from the end of an emulated frame until it is presented, "
+                 "over the last few thousand frames.<br><br>The recorded frames can be exported "
+                 "with Movie > Export Frame Pacing Data.<br><br><dolphin_emphasis>If unsure, "
+                 "leave this unchecked.</dolphin_emphasis>");
   static const char TR_SHOW_GRAPHS_DESCRIPTION[] =
       QT_TR_NOOP("Shows frametime graph along with statistics as a representation of "
                  "emulation performance.<br><br><dolphin_emphasis>If unsure, leave this "
@@ -341,6 +352,13 @@ void AdvancedWidget::AddDescriptions()
                  "debugging graphical issues. On the Vulkan and D3D backends, this also enables "
                  "debug symbols for the compiled shaders.<br><br><dolphin_emphasis>If unsure, "
                  "leave this unchecked.</dolphin_emphasis>");
+  static const char TR_GPU_PROFILER_DESCRIPTION[] =
+      QT_TR_NOOP("Measures how long the GPU spends on draws, EFB copies, XFB copies and "
+                 "post-processing each frame, and shows the results in a window on screen. When "
+                 "unchecked again, the timings of the last frames are written to "
+                 "User/Dump/Debug/ as a Chrome trace.<br><br>Only supported by the OpenGL and "
+                 "Vulkan backends.<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
   static const char TR_DUMP_TEXTURE_DESCRIPTION[] =
       QT_TR_NOOP("Dumps decoded game textures based on the other flags to "
                  "User/Dump/Textures/&lt;game_id&gt;/.<br><br><dolphin_emphasis>If unsure, leave "
@@ -463,6 +481,7 @@ void AdvancedWidget::AddDescriptions()
   m_show_ftimes->SetDescription(tr(TR_SHOW_FTIMES_DESCRIPTION));
   m_show_vps->SetDescription(tr(TR_SHOW_VPS_DESCRIPTION));
   m_show_vtimes->SetDescription(tr(TR_SHOW_VTIMES_DESCRIPTION));
+  m_show_frame_pacing->SetDescription(tr(TR_SHOW_FRAME_PACING_DESCRIPTION));
   m_show_graphs->SetDescription(tr(TR_SHOW_GRAPHS_DESCRIPTION));
   m_show_speed->SetDescription(tr(TR_SHOW_SPEED_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
@@ -473,6 +492,7 @@ void AdvancedWidget::AddDescriptions()
   m_show_proj_statistics->SetDescription(tr(TR_SHOW_PROJ_STATS_DESCRIPTION));
   m_enable_format_overlay->SetDescription(tr(TR_TEXTURE_FORMAT_DESCRIPTION));
   m_enable_api_validation->SetDescription(tr(TR_VALIDATION_LAYER_DESCRIPTION));
+  m_gpu_profiler->SetDescription(tr(TR_GPU_PROFILER_DESCRIPTION));
   m_perf_samp_window->SetDescription(tr(TR_PERF_SAMP_WINDOW_DESCRIPTION));
   m_dump_textures->SetDescription(tr(TR_DUMP_TEXTURE_DESCRIPTION));
   m_dump_mip_textures->SetDescription(tr(TR_DUMP_MIP_TEXTURE_DESCRIPTION));
@@ -36,10 +36,12 @@ private:
   ConfigBool* m_show_proj_statistics;
   ConfigBool* m_enable_format_overlay;
   ConfigBool* m_enable_api_validation;
+  ConfigBool* m_gpu_profiler;
   ConfigBool* m_show_fps;
   ConfigBool* m_show_ftimes;
   ConfigBool* m_show_vps;
   ConfigBool* m_show_vtimes;
+  ConfigBool* m_show_frame_pacing;
   ConfigBool* m_show_graphs;
   ConfigBool* m_show_speed;
   ConfigBool* m_show_speed_colors;
@@ -5,7 +5,9 @@
 
 #include <algorithm>
 #include <bit>
+#include <memory>
 #include <ranges>
+#include <vector>
 
 #include <QGroupBox>
 #include <QHBoxLayout>
@@ -349,7 +351,10 @@ void FIFOAnalyzer::UpdateDetails()
   const u32 end_part_nr = items[0]->data(0, PART_END_ROLE).toUInt();
 
   const AnalyzedFrameInfo& frame_info = m_fifo_player.GetAnalyzedFrameInfo(frame_nr);
-  const auto& fifo_frame = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  const std::shared_ptr<const std::vector<u8>> fifo_data =
+      m_fifo_player.GetFile()->GetFifoData(frame_nr);
+  if (!fifo_data)
+    return;
 
   const u32 object_start = frame_info.parts[start_part_nr].m_start;
   const u32 object_end = frame_info.parts[end_part_nr].m_end;
@@ -366,7 +371,7 @@ void FIFOAnalyzer::UpdateDetails()
     const u32 start_offset = object_offset;
     m_object_data_offsets.push_back(start_offset);
 
-    object_offset += OpcodeDecoder::RunCommand(&fifo_frame.fifoData[object_start + start_offset],
+    object_offset += OpcodeDecoder::RunCommand(&(*fifo_data)[object_start + start_offset],
                                                object_size - start_offset, callback);
 
     QString new_label =
@@ -432,13 +437,16 @@ void FIFOAnalyzer::BeginSearch()
   const u32 end_part_nr = items[0]->data(0, PART_END_ROLE).toUInt();
 
   const AnalyzedFrameInfo& frame_info = m_fifo_player.GetAnalyzedFrameInfo(frame_nr);
-  const FifoFrameInfo& fifo_frame = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  const std::shared_ptr<const std::vector<u8>> fifo_data =
+      m_fifo_player.GetFile()->GetFifoData(frame_nr);
+  if (!fifo_data)
+    return;
 
   const u32 object_start = frame_info.parts[start_part_nr].m_start;
   const u32 object_end = frame_info.parts[end_part_nr].m_end;
   const u32 object_size = object_end - object_start;
 
-  const u8* const object = &fifo_frame.fifoData[object_start];
+  const u8* const object = &(*fifo_data)[object_start];
 
   // TODO: Support searching for bit patterns
   for (u32 cmd_nr = 0; cmd_nr < m_object_data_offsets.size(); cmd_nr++)
@@ -764,7 +772,10 @@ void FIFOAnalyzer::UpdateDescription()
   const u32 entry_nr = m_detail_list->currentRow();
 
   const AnalyzedFrameInfo& frame_info = m_fifo_player.GetAnalyzedFrameInfo(frame_nr);
-  const FifoFrameInfo& fifo_frame = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  const std::shared_ptr<const std::vector<u8>> fifo_data =
+      m_fifo_player.GetFile()->GetFifoData(frame_nr);
+  if (!fifo_data)
+    return;
 
   const u32 object_start = frame_info.parts[start_part_nr].m_start;
   const u32 object_end = frame_info.parts[end_part_nr].m_end;
@@ -772,7 +783,7 @@ void FIFOAnalyzer::UpdateDescription()
   const u32 entry_start = m_object_data_offsets[entry_nr];
 
   auto callback = DescriptionCallback(frame_info.parts[end_part_nr].m_cpmem);
-  OpcodeDecoder::RunCommand(&fifo_frame.fifoData[object_start + entry_start],
+  OpcodeDecoder::RunCommand(&(*fifo_data)[object_start + entry_start],
                             object_size - entry_start, callback);
   m_entry_detail_browser->setText(callback.text);
 }
@@ -4,6 +4,7 @@
 #include "DolphinQt/MenuBar.h"
 
 #include <cinttypes>
+#include <ctime>
 #include <future>
 
 #include <QAction>
@@ -16,6 +17,7 @@
 #include <QSignalBlocker>
 #include <QUrl>
 
+#include <fmt/chrono.h>
 #include <fmt/format.h>
 
 #include "Common/Align.h"
@@ -23,6 +25,7 @@
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/StringUtil.h"
+#include "Common/Trace.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Boot/Boot.h"
@@ -71,6 +74,8 @@
 #include "UICommon/AutoUpdate.h"
 #include "UICommon/GameFile.h"
 
+#include "VideoCommon/PerformanceMetrics.h"
+
 QPointer<MenuBar> MenuBar::s_menu_bar;
 
 QString MenuBar::GetSignatureSelector() const
@@ -866,6 +871,51 @@ void MenuBar::AddMovieMenu()
   dump_audio->setChecked(Config::Get(Config::MAIN_DUMP_AUDIO));
   connect(dump_audio, &QAction::toggled,
           [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_DUMP_AUDIO, value); });
+
+  auto* record_trace = movie_menu->addAction(tr("Record Performance Trace"));
+  record_trace->setCheckable(true);
+  record_trace->setChecked(Common::Trace::IsRecording());
+  connect(record_trace, &QAction::toggled, this, &MenuBar::OnRecordTraceToggled);
+
+  movie_menu->addAction(tr("Export Frame Pacing Data"), this, &MenuBar::OnExportFramePacing);
+}
+
+void MenuBar::OnRecordTraceToggled(bool enabled)
+{
+  if (enabled)
+  {
+    Common::Trace::Start();
+    return;
+  }
+
+  const std::string filename =
+      fmt::format("{}Trace_{:%Y-%m-%d_%H-%M-%S}.json", File::GetUserPath(D_DUMPDEBUG_IDX),
+                  fmt::localtime(std::time(nullptr)));
+  if (!Common::Trace::Stop(filename))
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to write the trace to \"%1\".").arg(QString::fromStdString(filename)));
+  }
+}
+
+void MenuBar::OnExportFramePacing()
+{
+  const std::string filename =
+      fmt::format("{}FramePacing_{:%Y-%m-%d_%H-%M-%S}.csv", File::GetUserPath(D_DUMPDEBUG_IDX),
+                  fmt::localtime(std::time(nullptr)));
+  if (!g_perf_metrics.WriteFramePacingCSV(filename))
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+
+  ModalMessageBox::information(
+      this, tr("Frame Pacing Data"),
+      tr("The timings of the last presented frames were written to \"%1\".")
+          .arg(QString::fromStdString(filename)));
 }
 
 void MenuBar::AddJITMenu()
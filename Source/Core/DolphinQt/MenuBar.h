@@ -188,6 +188,8 @@ private:
   void OnDebugModeToggled(bool enabled);
   void OnWipeJitBlockProfilingData();
   void OnWriteJitBlockLogDump();
+  void OnRecordTraceToggled(bool enabled);
+  void OnExportFramePacing();
 
   QString GetSignatureSelector() const;
 
@@ -347,6 +347,31 @@ void DXStagingTexture::Flush()
   m_needs_flush = false;
 }
 
+bool DXStagingTexture::IsCopyComplete()
+{
+  if (!m_needs_flush || m_map_pointer)
+    return true;
+
+  // Mapping without waiting fails while the copy is still in progress. Otherwise, keep the texture
+  // mapped, as it is going to be read next.
+  D3D11_MAP map_type;
+  if (m_type == StagingTextureType::Readback)
+    map_type = D3D11_MAP_READ;
+  else if (m_type == StagingTextureType::Upload)
+    map_type = D3D11_MAP_WRITE;
+  else
+    map_type = D3D11_MAP_READ_WRITE;
+
+  D3D11_MAPPED_SUBRESOURCE sr;
+  const HRESULT hr = D3D::context->Map(m_tex.Get(), 0, map_type, D3D11_MAP_FLAG_DO_NOT_WAIT, &sr);
+  if (FAILED(hr))
+    return false;
+
+  m_map_pointer = reinterpret_cast<char*>(sr.pData);
+  m_map_stride = sr.RowPitch;
+  return true;
+}
+
 DXFramebuffer::DXFramebuffer(AbstractTexture* color_attachment, AbstractTexture* depth_attachment,
                              std::vector<AbstractTexture*> additional_color_attachments,
                              AbstractTextureFormat color_format, AbstractTextureFormat depth_format,
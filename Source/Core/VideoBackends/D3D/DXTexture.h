@@ -68,6 +68,7 @@ public:
   bool Map() override;
   void Unmap() override;
   void Flush() override;
+  bool IsCopyComplete() override;
 
   static std::unique_ptr<DXStagingTexture> Create(StagingTextureType type,
                                                   const TextureConfig& config);
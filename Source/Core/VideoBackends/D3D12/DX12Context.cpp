@@ -581,4 +581,9 @@ void DXContext::WaitForFence(u64 fence)
     index = (index + 1) % NUM_COMMAND_LISTS;
   }
 }
+
+bool DXContext::IsFenceComplete(u64 fence) const
+{
+  return m_completed_fence_value >= fence || m_fence->GetCompletedValue() >= fence;
+}
 }  // namespace DX12
@@ -117,6 +117,9 @@ public:
   // Waits for a specific fence.
   void WaitForFence(u64 fence);
 
+  // Checks whether a fence has been reached, without waiting.
+  bool IsFenceComplete(u64 fence) const;
+
   // Defers destruction of a D3D resource (associates it with the current list).
   void DeferResourceDestruction(ID3D12Resource* resource);
 
@@ -785,6 +785,13 @@ void DXStagingTexture::Flush()
     g_dx_context->WaitForFence(m_completed_fence);
 }
 
+bool DXStagingTexture::IsCopyComplete()
+{
+  // Copies in the current command list haven't even been submitted yet.
+  return !m_needs_flush || (m_completed_fence != g_dx_context->GetCurrentFenceValue() &&
+                            g_dx_context->IsFenceComplete(m_completed_fence));
+}
+
 std::unique_ptr<DXStagingTexture> DXStagingTexture::Create(StagingTextureType type,
                                                            const TextureConfig& config)
 {
@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Null/NullGfx.h"
 
+#include <algorithm>
+
 #include "VideoBackends/Null/NullBoundingBox.h"
 #include "VideoBackends/Null/NullTexture.h"
 
@@ -92,6 +94,12 @@ NullGfx::CreateNativeVertexFormat(const PortableVertexDeclaration& vtx_decl)
   return std::make_unique<NativeVertexFormat>(vtx_decl);
 }
 
+bool NullGfx::ReadTimestampQueries(u32 first, std::span<u64> results)
+{
+  std::ranges::fill(results, 0);
+  return true;
+}
+
 NullRenderer::~NullRenderer() = default;
 
 }  // namespace Null
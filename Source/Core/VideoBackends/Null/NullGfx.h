@@ -36,6 +36,10 @@ public:
                                                    const void* cache_data = nullptr,
                                                    size_t cache_data_length = 0) override;
   SurfaceInfo GetSurfaceInfo() const override { return {}; }
+
+  // Timestamps are always zero, as nothing is drawn
+  bool SupportsTimestampQueries() const override { return true; }
+  bool ReadTimestampQueries(u32 first, std::span<u64> results) override;
 };
 
 class NullRenderer final : public Renderer
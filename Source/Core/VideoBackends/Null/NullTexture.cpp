@@ -64,6 +64,11 @@ void NullStagingTexture::Flush()
   m_needs_flush = false;
 }
 
+bool NullStagingTexture::IsCopyComplete()
+{
+  return true;
+}
+
 NullFramebuffer::NullFramebuffer(AbstractTexture* color_attachment,
                                  AbstractTexture* depth_attachment,
                                  std::vector<AbstractTexture*> additional_color_attachments,
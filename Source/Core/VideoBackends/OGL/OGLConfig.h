@@ -78,6 +78,7 @@ struct VideoConfig
   EsFbFetchType SupportedFramebufferFetch;
   bool bSupportsKHRShaderSubgroup;  // basic + arithmetic + ballot
   bool bSupportsExplicitLayoutInShader;
+  bool bSupportsTimerQuery;
 
   const char* gl_vendor;
   const char* gl_renderer;
@@ -202,6 +202,11 @@ OGLGfx::~OGLGfx()
 {
   glDeleteFramebuffers(1, &m_shared_draw_framebuffer);
   glDeleteFramebuffers(1, &m_shared_read_framebuffer);
+  if (!m_timestamp_queries.empty())
+  {
+    glDeleteQueries(static_cast<GLsizei>(m_timestamp_queries.size()),
+                    m_timestamp_queries.data());
+  }
 }
 
 bool OGLGfx::IsHeadless() const
@@ -457,6 +462,40 @@ void OGLGfx::WaitForGPUIdle()
   glFinish();
 }
 
+bool OGLGfx::SupportsTimestampQueries() const
+{
+  return g_ogl_config.bSupportsTimerQuery;
+}
+
+void OGLGfx::WriteTimestampQuery(u32 index)
+{
+  // GL queries don't need to be reset, they are overwritten by the next write.
+  if (m_timestamp_queries.empty())
+  {
+    m_timestamp_queries.resize(TIMESTAMP_QUERY_COUNT);
+    glGenQueries(TIMESTAMP_QUERY_COUNT, m_timestamp_queries.data());
+  }
+
+  glQueryCounter(m_timestamp_queries[index], GL_TIMESTAMP);
+}
+
+bool OGLGfx::ReadTimestampQueries(u32 first, std::span<u64> results)
+{
+  if (m_timestamp_queries.empty() || results.empty())
+    return false;
+
+  // Queries complete in order, so the last one being available means all of them are.
+  GLuint available = GL_FALSE;
+  glGetQueryObjectuiv(m_timestamp_queries[first + results.size() - 1],
+                      GL_QUERY_RESULT_AVAILABLE, &available);
+  if (available == GL_FALSE)
+    return false;
+
+  for (size_t i = 0; i < results.size(); i++)
+    glGetQueryObjectui64v(m_timestamp_queries[first + i], GL_QUERY_RESULT, &results[i]);
+  return true;
+}
+
 void OGLGfx::CheckForSurfaceChange()
 {
   if (!g_presenter->SurfaceChangedTestAndClear())
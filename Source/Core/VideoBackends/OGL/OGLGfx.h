@@ -67,6 +67,10 @@ public:
   void WaitForGPUIdle() override;
   void OnConfigChanged(u32 bits) override;
 
+  bool SupportsTimestampQueries() const override;
+  void WriteTimestampQuery(u32 index) override;
+  bool ReadTimestampQueries(u32 first, std::span<u64> results) override;
+
   virtual void SelectLeftBuffer() override;
   virtual void SelectRightBuffer() override;
   virtual void SelectMainBuffer() override;
@@ -112,6 +116,9 @@ private:
   u32 m_shared_read_framebuffer = 0;
   u32 m_shared_draw_framebuffer = 0;
   float m_backbuffer_scale;
+
+  // Only created once the GPU profiler is used
+  std::vector<u32> m_timestamp_queries;
 };
 
 inline OGLGfx* GetOGLGfx()
@@ -625,6 +625,19 @@ void OGLStagingTexture::Flush()
   m_needs_flush = false;
 }
 
+bool OGLStagingTexture::IsCopyComplete()
+{
+  if (!m_needs_flush)
+    return true;
+
+  // Without buffer storage, the transfer only happens when mapping the buffer.
+  if (m_fence == nullptr)
+    return false;
+
+  const GLenum status = glClientWaitSync(m_fence, 0, 0);
+  return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
 bool OGLStagingTexture::Map()
 {
   if (m_map_pointer)
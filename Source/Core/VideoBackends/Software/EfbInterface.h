@@ -53,10 +53,13 @@ u32 GetDepth(u16 x, u16 y);
 
 u8* GetPixelPointer(u16 x, u16 y, bool depth);
 
-void EncodeXFB(u8* xfb_in_ram, u32 memory_stride, const MathUtil::Rectangle<int>& source_rect,
-               float y_scale, float gamma);
+// Writes the rows of the XFB dst_stride bytes apart
+void EncodeXFB(u8* xfb_in_ram, u32 dst_stride, u32 memory_stride,
+               const MathUtil::Rectangle<int>& source_rect, float y_scale, float gamma);
 
 u32 GetPerfQueryResult(PerfQueryType type);
 void ResetPerfQuery();
 void IncPerfCounterQuadCount(PerfQueryType type);
+// Adds the pixels counted by the calling thread to the perf query results
+void FlushPerfCounters();
 }  // namespace EfbInterface
@@ -4,11 +4,21 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+#include "Common/Thread.h"
 
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
@@ -25,6 +35,18 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
+// Size of the tiles which the EFB is split into when rasterizing on several threads. Each tile is
+// drawn by one thread, with the triangles in the order they were drawn in, so the result is the
+// same as when drawing on one thread. This must be a multiple of the block size.
+static constexpr int TILE_SIZE = 32;
+static constexpr int TILES_WIDE = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr int TILES_HIGH = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr u32 NUM_TILES = TILES_WIDE * TILES_HIGH;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0);
+
+// Binned triangles are drawn once there are this many, to bound the memory they take up.
+static constexpr size_t MAX_BINNED_TRIANGLES = 4096;
+
 struct SlopeContext
 {
   SlopeContext(const OutputVertexData* v0, const OutputVertexData* v1, const OutputVertexData* v2,
@@ -96,16 +118,182 @@ struct Slope
   }
 };
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// Everything needed to rasterize a triangle within a scissor rectangle.
+struct Triangle
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge constants and deltas, in 28.4 fixed point
+  s32 C1, C2, C3;
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+
+  // Bounding rectangle, clamped to the scissor rectangle
+  s32 minx, maxx, miny, maxy;
+};
 
-static Tev tev;
-static RasterBlock rasterBlock;
+// State of a thread drawing pixels.
+struct PixelContext
+{
+  Tev tev;
+  RasterBlock rasterBlock;
+  int rasterizedPixels = 0;
+};
+
+static Slope ZSlope;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+// Context of the GPU thread, followed by the worker threads.
+static std::vector<std::unique_ptr<PixelContext>> contexts;
+
+// Triangles waiting to be drawn by the workers, and the indices of the triangles in each tile.
+static std::vector<Triangle> binnedTriangles;
+static std::array<std::vector<u32>, NUM_TILES> tileBins;
+
+static std::vector<std::thread> workers;
+static std::mutex workLock;
+static std::condition_variable workCV;
+static std::condition_variable doneCV;
+static u32 workGeneration = 0;
+static bool exitWorkers = false;
+static std::atomic<u32> nextTile = NUM_TILES;
+static std::atomic<u32> tilesDone = NUM_TILES;
+
+static void RasterizeTriangle(PixelContext& ctx, const Triangle& tri,
+                              const MathUtil::Rectangle<int>& area);
+
+static MathUtil::Rectangle<int> GetTileRect(u32 tile)
+{
+  const int left = static_cast<int>(tile % TILES_WIDE) * TILE_SIZE;
+  const int top = static_cast<int>(tile / TILES_WIDE) * TILE_SIZE;
+  return MathUtil::Rectangle<int>(left, top, std::min(left + TILE_SIZE, int(EFB_WIDTH)),
+                                  std::min(top + TILE_SIZE, int(EFB_HEIGHT)));
+}
+
+static void RasterizeTiles(PixelContext& ctx)
+{
+  for (u32 tile = nextTile++; tile < NUM_TILES; tile = nextTile++)
+  {
+    const MathUtil::Rectangle<int> rect = GetTileRect(tile);
+    for (const u32 index : tileBins[tile])
+      RasterizeTriangle(ctx, binnedTriangles[index], rect);
+    EfbInterface::FlushPerfCounters();
+
+    if (++tilesDone == NUM_TILES)
+    {
+      std::lock_guard lock(workLock);
+      doneCV.notify_one();
+    }
+  }
+}
+
+static void WorkerThread(u32 index)
+{
+  Common::SetCurrentThreadName(fmt::format("SW rasterizer {}", index).c_str());
+  PixelContext& ctx = *contexts[index + 1];
+
+  std::unique_lock lock(workLock);
+  u32 generation = workGeneration;
+  while (true)
+  {
+    workCV.wait(lock, [&] { return exitWorkers || workGeneration != generation; });
+    if (exitWorkers)
+      return;
+
+    generation = workGeneration;
+    lock.unlock();
+    RasterizeTiles(ctx);
+    lock.lock();
+  }
+}
+
+static void StopWorkers()
+{
+  {
+    std::lock_guard lock(workLock);
+    exitWorkers = true;
+  }
+  workCV.notify_all();
+
+  for (std::thread& worker : workers)
+    worker.join();
+  workers.clear();
+  exitWorkers = false;
+}
+
+static void SetWorkerCount(u32 count)
+{
+  if (count == workers.size() && !contexts.empty())
+    return;
+
+  StopWorkers();
+
+  contexts.resize(count + 1);
+  for (auto& ctx : contexts)
+  {
+    if (!ctx)
+      ctx = std::make_unique<PixelContext>();
+  }
+
+  for (u32 i = 0; i < count; ++i)
+    workers.emplace_back(WorkerThread, i);
+}
+
+static void DrawBinnedTriangles()
+{
+  if (binnedTriangles.empty())
+    return;
+
+  // Waking up the workers isn't worth it when there's only one tile to draw.
+  const auto num_used_tiles =
+      std::ranges::count_if(tileBins, [](const auto& bin) { return !bin.empty(); });
+
+  tilesDone = 0;
+  nextTile = 0;
+  if (num_used_tiles > 1)
+  {
+    {
+      std::lock_guard lock(workLock);
+      workGeneration++;
+    }
+    workCV.notify_all();
+  }
+
+  RasterizeTiles(*contexts[0]);
+
+  {
+    std::unique_lock lock(workLock);
+    doneCV.wait(lock, [] { return tilesDone == NUM_TILES; });
+  }
+
+  binnedTriangles.clear();
+  for (auto& bin : tileBins)
+    bin.clear();
+}
+
+static void BinTriangle(const Triangle& tri)
+{
+  const u32 index = static_cast<u32>(binnedTriangles.size());
+  binnedTriangles.push_back(tri);
+
+  const int first_tile_x = tri.minx / TILE_SIZE;
+  const int last_tile_x = (tri.maxx - 1) / TILE_SIZE;
+  const int first_tile_y = tri.miny / TILE_SIZE;
+  const int last_tile_y = (tri.maxy - 1) / TILE_SIZE;
+  for (int tile_y = first_tile_y; tile_y <= last_tile_y; tile_y++)
+  {
+    for (int tile_x = first_tile_x; tile_x <= last_tile_x; tile_x++)
+      tileBins[tile_y * TILES_WIDE + tile_x].push_back(index);
+  }
+
+  if (binnedTriangles.size() == MAX_BINNED_TRIANGLES)
+    DrawBinnedTriangles();
+}
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
@@ -113,6 +301,40 @@ void Init()
   ZSlope = Slope();
 }
 
+void Shutdown()
+{
+  StopWorkers();
+  contexts.clear();
+  binnedTriangles.clear();
+  for (auto& bin : tileBins)
+    bin.clear();
+  Tev::ClearPipelineCache();
+}
+
+void BeginBatch()
+{
+  SetWorkerCount(g_ActiveConfig.GetSWRasterizerThreads());
+
+  const Tev::Pipeline& pipeline = Tev::GetPipeline(GetTevPipelineUid());
+  for (auto& ctx : contexts)
+    ctx->tev.SetPipeline(pipeline);
+}
+
+void EndBatch()
+{
+  DrawBinnedTriangles();
+
+  for (auto& ctx : contexts)
+  {
+    ADDSTAT(g_stats.this_frame.rasterized_pixels, ctx->rasterizedPixels);
+    ADDSTAT(g_stats.this_frame.tev_pixels_in, ctx->tev.PixelsIn);
+    ADDSTAT(g_stats.this_frame.tev_pixels_out, ctx->tev.PixelsOut);
+    ctx->rasterizedPixels = 0;
+    ctx->tev.PixelsIn = 0;
+    ctx->tev.PixelsOut = 0;
+  }
+}
+
 void ScissorChanged()
 {
   scissors = std::move(BPFunctions::ComputeScissorRects().m_result);
@@ -140,16 +362,11 @@ static inline int iround(float x)
   return t;
 }
 
-void SetTevKonstColors()
-{
-  tev.SetKonstColors();
-}
-
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(PixelContext& ctx, const Triangle& tri, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  ctx.rasterizedPixels++;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  s32 z = (s32)std::clamp<float>(tri.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
@@ -164,7 +381,9 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  Tev& tev = ctx.tev;
+  const RasterBlock& rasterBlock = ctx.rasterBlock;
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -175,7 +394,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      u16 color = (u16)ColorSlopes[i][comp].GetValue(x, y);
+      u16 color = (u16)tri.ColorSlopes[i][comp].GetValue(x, y);
 
       // clamp color value to 0
       u16 mask = ~(color >> 8);
@@ -207,7 +426,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -218,9 +438,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -258,7 +478,7 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterBlock& rasterBlock, const Triangle& tri, s32 blockX, s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
@@ -269,19 +489,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / tri.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = tri.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = tri.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = tri.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -291,7 +511,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -303,7 +524,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -320,9 +542,11 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+// Sets up the triangle for drawing within the scissor rectangle. Returns false if the triangle
+// doesn't cover any pixels in it.
+static bool SetupTriangle(const OutputVertexData* v0, const OutputVertexData* v1,
+                          const OutputVertexData* v2, const BPFunctions::ScissorRect& scissor,
+                          Triangle* tri)
 {
   // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
   // zfreeze depends on it
@@ -349,15 +573,6 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 DY23 = Y2 - Y3;
   const s32 DY31 = Y3 - Y1;
 
-  // Fixed-point deltas
-  const s32 FDX12 = DX12 * 16;
-  const s32 FDX23 = DX23 * 16;
-  const s32 FDX31 = DX31 * 16;
-
-  const s32 FDY12 = DY12 * 16;
-  const s32 FDY23 = DY23 * 16;
-  const s32 FDY31 = DY31 * 16;
-
   // Bounding rectangle
   s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
   s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
@@ -376,7 +591,9 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   maxy = std::min(maxy, scissor.rect.bottom);
 
   if (minx >= maxx || miny >= maxy)
-    return;
+    return false;
+
+  tri->ZSlope = ZSlope;
 
   // Set up the remaining slopes
   const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
@@ -384,20 +601,23 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
 
   float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
                 1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
+  tri->WSlope = Slope(w[0], w[1], w[2], ctx);
 
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    {
+      tri->ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     for (int comp = 0; comp < 3; comp++)
     {
-      TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
-                                 v2->texCoords[i][comp] * w[2], ctx);
+      tri->TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
+                                      v2->texCoords[i][comp] * w[2], ctx);
     }
   }
 
@@ -414,12 +634,57 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
     C3++;
 
+  tri->C1 = C1;
+  tri->C2 = C2;
+  tri->C3 = C3;
+  tri->DX12 = DX12;
+  tri->DX23 = DX23;
+  tri->DX31 = DX31;
+  tri->DY12 = DY12;
+  tri->DY23 = DY23;
+  tri->DY31 = DY31;
+  tri->minx = minx;
+  tri->maxx = maxx;
+  tri->miny = miny;
+  tri->maxy = maxy;
+  return true;
+}
+
+// Draws the pixels of the triangle which are within the given area, which must be aligned to
+// blocks.
+static void RasterizeTriangle(PixelContext& ctx, const Triangle& tri,
+                              const MathUtil::Rectangle<int>& area)
+{
+  const s32 C1 = tri.C1;
+  const s32 C2 = tri.C2;
+  const s32 C3 = tri.C3;
+  const s32 DX12 = tri.DX12;
+  const s32 DX23 = tri.DX23;
+  const s32 DX31 = tri.DX31;
+  const s32 DY12 = tri.DY12;
+  const s32 DY23 = tri.DY23;
+  const s32 DY31 = tri.DY31;
+
+  // Fixed-point deltas
+  const s32 FDX12 = DX12 * 16;
+  const s32 FDX23 = DX23 * 16;
+  const s32 FDX31 = DX31 * 16;
+
+  const s32 FDY12 = DY12 * 16;
+  const s32 FDY23 = DY23 * 16;
+  const s32 FDY31 = DY31 * 16;
+
+  const s32 minx = std::max(tri.minx, area.left);
+  const s32 maxx = std::min(tri.maxx, area.right);
+  const s32 miny = std::max(tri.miny, area.top);
+  const s32 maxy = std::min(tri.maxy, area.bottom);
+
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
   s32 block_miny = miny & ~(BLOCK_SIZE - 1);
 
   // Loop through blocks
-  for (s32 y = block_miny & ~(BLOCK_SIZE - 1); y < maxy; y += BLOCK_SIZE)
+  for (s32 y = block_miny; y < maxy; y += BLOCK_SIZE)
   {
     for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
     {
@@ -455,7 +720,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(ctx.rasterBlock, tri, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -465,7 +730,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(ctx, tri, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -488,7 +753,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(ctx, tri, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -511,6 +776,20 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   INCSTAT(g_stats.this_frame.num_triangles_drawn);
 
   for (const auto& scissor : scissors)
-    DrawTriangleFrontFace(v0, v1, v2, scissor);
+  {
+    Triangle tri;
+    if (!SetupTriangle(v0, v1, v2, scissor, &tri))
+      continue;
+
+    if (workers.empty())
+    {
+      RasterizeTriangle(*contexts[0], tri, MathUtil::Rectangle<int>(0, 0, EFB_WIDTH, EFB_HEIGHT));
+      EfbInterface::FlushPerfCounters();
+    }
+    else
+    {
+      BinTriangle(tri);
+    }
+  }
 }
 }  // namespace Rasterizer
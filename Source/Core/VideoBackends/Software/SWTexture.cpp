@@ -158,6 +158,12 @@ void SWStagingTexture::Flush()
   m_needs_flush = false;
 }
 
+bool SWStagingTexture::IsCopyComplete()
+{
+  // Copies are done immediately.
+  return true;
+}
+
 SWFramebuffer::SWFramebuffer(AbstractTexture* color_attachment, AbstractTexture* depth_attachment,
                              std::vector<AbstractTexture*> additional_color_attachments,
                              AbstractTextureFormat color_format, AbstractTextureFormat depth_format,
@@ -52,8 +52,7 @@ public:
   bool Map() override;
   void Unmap() override;
   void Flush() override;
-
-  void SetMapStride(size_t stride) { m_map_stride = stride; }
+  bool IsCopyComplete() override;
 
 private:
   std::vector<u8> m_data;
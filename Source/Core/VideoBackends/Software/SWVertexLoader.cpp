@@ -67,7 +67,7 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
     g_bounding_box->Flush();
 
   m_setup_unit.Init(primitive_type);
-  Rasterizer::SetTevKonstColors();
+  Rasterizer::BeginBatch();
 
   for (u32 i = 0; i < m_index_generator.GetIndexLen(); i++)
   {
@@ -91,6 +91,8 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
     INCSTAT(g_stats.this_frame.num_vertices_loaded);
   }
 
+  Rasterizer::EndBatch();
+
   INCSTAT(g_stats.this_frame.num_drawn_objects);
 }
 
@@ -115,5 +115,6 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 void VideoSoftware::Shutdown()
 {
   ShutdownShared();
+  Rasterizer::Shutdown();
 }
 }  // namespace SW
@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <map>
+#include <utility>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -18,11 +20,59 @@
 
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelShaderManager.h"
-#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
+// Pipelines are only looked up on the GPU thread between batches, so the cache needs no lock.
+static std::map<TevPipelineUid, std::unique_ptr<Tev::Pipeline>> s_pipelines;
+
+// The cache is cleared when it grows this large. Each pipeline takes a little over 1 KiB.
+static constexpr size_t MAX_CACHED_PIPELINES = 4096;
+
+static u32 PackSwapTable(const Common::EnumMap<ColorChannel, ColorChannel::Alpha>& swap)
+{
+  return u32(swap[ColorChannel::Red]) | u32(swap[ColorChannel::Green]) << 2 |
+         u32(swap[ColorChannel::Blue]) << 4 | u32(swap[ColorChannel::Alpha]) << 6;
+}
+
+TevPipelineUid GetTevPipelineUid()
+{
+  TevPipelineUid out;
+
+  tev_pipeline_uid_data* const uid_data = out.GetUidData();
+  uid_data->num_tev_stages = bpmem.genMode.numtevstages;
+  uid_data->num_ind_stages = bpmem.genMode.numindstages;
+  uid_data->num_tex_gens = bpmem.genMode.numtexgens;
+  uid_data->late_ztest = bpmem.GetEmulatedZ() == EmulatedZ::Late;
+  uid_data->ztex = bpmem.ztex2.op != ZTexOp::Disabled;
+  uid_data->fog = bpmem.fog.c_proj_fsel.fsel != FogType::Off;
+  uid_data->alpha_test = bpmem.alpha_test.hex & 0xFFFFFF;
+
+  if (bpmem.genMode.numindstages > 0)
+  {
+    uid_data->ind_orders = bpmem.tevindref.hex & 0xFFFFFF;
+    uid_data->ind_scales =
+        (bpmem.texscale[0].hex & 0xFFFF) | (bpmem.texscale[1].hex & 0xFFFF) << 16;
+  }
+
+  for (u32 i = 0; i <= bpmem.genMode.numtevstages; i++)
+  {
+    auto& stage = uid_data->stages[i];
+    const TevStageCombiner& combiner = bpmem.combiners[i];
+    stage.color_combiner = combiner.colorC.hex & 0xFFFFFF;
+    stage.konst_color = static_cast<u32>(bpmem.tevksel.GetKonstColor(i));
+    stage.indirect = bpmem.tevind[i].hex != 0;
+    stage.alpha_combiner = combiner.alphaC.hex & 0xFFFFF0;
+    stage.konst_alpha = static_cast<u32>(bpmem.tevksel.GetKonstAlpha(i));
+    stage.order = (bpmem.tevorders[i / 2].hex >> (i & 1 ? 12 : 0)) & 0x3FF;
+    stage.tex_swap = PackSwapTable(bpmem.tevksel.GetSwapTable(combiner.alphaC.tswap));
+    stage.ras_swap = PackSwapTable(bpmem.tevksel.GetSwapTable(combiner.alphaC.rswap));
+  }
+
+  return out;
+}
+
 static inline s16 Clamp255(s16 in)
 {
   return std::clamp<s16>(in, 0, 255);
@@ -33,28 +83,18 @@ static inline s16 Clamp1024(s16 in)
   return std::clamp<s16>(in, -1024, 1023);
 }
 
-void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
+void Tev::SetRasColor(const Pipeline::Stage& stage)
 {
-  switch (colorChan)
+  switch (stage.ras_chan)
   {
   case RasColorChan::Color0:
-  {
-    const u8* color = Color[0];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
-  }
-  break;
   case RasColorChan::Color1:
   {
-    const u8* color = Color[1];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
+    const u8* color = Color[stage.ras_chan == RasColorChan::Color1];
+    RasColor.r = color[stage.ras_swap[0]];
+    RasColor.g = color[stage.ras_swap[1]];
+    RasColor.b = color[stage.ras_swap[2]];
+    RasColor.a = color[stage.ras_swap[3]];
   }
   break;
   case RasColorChan::AlphaBump:
@@ -70,16 +110,15 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
   break;
   default:
   {
-    if (colorChan != RasColorChan::Zero)
-      PanicAlertFmt("Invalid ras color channel: {}", colorChan);
-
+    // Invalid channels were replaced with Zero when compiling the pipeline.
     RasColor = TevColor::All(0);
   }
   break;
   }
 }
 
-void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
+template <TevOp op, TevScale scale, TevBias bias>
+void Tev::DrawColorRegular(TevOutput dest, const InputRegType inputs[4])
 {
   for (int i = BLU_C; i <= RED_C; i++)
   {
@@ -88,24 +127,25 @@ void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const Inpu
     const u16 c = InputReg.c + (InputReg.c >> 7);
 
     s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-    temp <<= s_ScaleLShiftLUT[cc.scale];
-    temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+    temp <<= s_ScaleLShiftLUT[scale];
+    temp += (scale == TevScale::Divide2) ? 0 : (op == TevOp::Sub) ? 127 : 128;
     temp >>= 8;
-    temp = cc.op == TevOp::Sub ? -temp : temp;
+    temp = op == TevOp::Sub ? -temp : temp;
 
-    s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
-    result = result >> s_ScaleRShiftLUT[cc.scale];
+    s32 result = ((InputReg.d + s_BiasLUT[bias]) << s_ScaleLShiftLUT[scale]) + temp;
+    result = result >> s_ScaleRShiftLUT[scale];
 
-    Reg[cc.dest][i] = result;
+    Reg[dest][i] = result;
   }
 }
 
-void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
+template <TevComparison comparison, TevCompareMode mode>
+void Tev::DrawColorCompare(TevOutput dest, const InputRegType inputs[4])
 {
   for (int i = BLU_C; i <= RED_C; i++)
   {
     u32 a, b;
-    switch (cc.compare_mode)
+    switch (mode)
     {
     case TevCompareMode::R8:
       a = inputs[RED_C].a;
@@ -123,43 +163,42 @@ void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const Inpu
       break;
 
     case TevCompareMode::RGB8:
+    default:
       a = inputs[i].a;
       b = inputs[i].b;
       break;
-
-    default:
-      PanicAlertFmt("Invalid compare mode {}", cc.compare_mode);
-      continue;
     }
 
-    if (cc.comparison == TevComparison::GT)
-      Reg[cc.dest][i] = inputs[i].d + ((a > b) ? inputs[i].c : 0);
+    if (comparison == TevComparison::GT)
+      Reg[dest][i] = inputs[i].d + ((a > b) ? inputs[i].c : 0);
     else
-      Reg[cc.dest][i] = inputs[i].d + ((a == b) ? inputs[i].c : 0);
+      Reg[dest][i] = inputs[i].d + ((a == b) ? inputs[i].c : 0);
   }
 }
 
-void Tev::DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+template <TevOp op, TevScale scale, TevBias bias>
+void Tev::DrawAlphaRegular(TevOutput dest, const InputRegType inputs[4])
 {
   const InputRegType& InputReg = inputs[ALP_C];
 
   const u16 c = InputReg.c + (InputReg.c >> 7);
 
   s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-  temp <<= s_ScaleLShiftLUT[ac.scale];
-  temp += (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
-  temp = ac.op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
+  temp <<= s_ScaleLShiftLUT[scale];
+  temp += (scale == TevScale::Divide2) ? 0 : (op == TevOp::Sub) ? 127 : 128;
+  temp = op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
 
-  s32 result = ((InputReg.d + s_BiasLUT[ac.bias]) << s_ScaleLShiftLUT[ac.scale]) + temp;
-  result = result >> s_ScaleRShiftLUT[ac.scale];
+  s32 result = ((InputReg.d + s_BiasLUT[bias]) << s_ScaleLShiftLUT[scale]) + temp;
+  result = result >> s_ScaleRShiftLUT[scale];
 
-  Reg[ac.dest].a = result;
+  Reg[dest].a = result;
 }
 
-void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+template <TevComparison comparison, TevCompareMode mode>
+void Tev::DrawAlphaCompare(TevOutput dest, const InputRegType inputs[4])
 {
   u32 a, b;
-  switch (ac.compare_mode)
+  switch (mode)
   {
   case TevCompareMode::R8:
     a = inputs[RED_C].a;
@@ -177,19 +216,16 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
     break;
 
   case TevCompareMode::A8:
+  default:
     a = inputs[ALP_C].a;
     b = inputs[ALP_C].b;
     break;
-
-  default:
-    PanicAlertFmt("Invalid compare mode {}", ac.compare_mode);
-    return;
   }
 
-  if (ac.comparison == TevComparison::GT)
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
+  if (comparison == TevComparison::GT)
+    Reg[dest].a = inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
   else
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
+    Reg[dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
 }
 
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
@@ -218,12 +254,12 @@ static bool AlphaCompare(int alpha, int ref, CompareMode comp)
   }
 }
 
-static bool TevAlphaTest(int alpha)
+static bool TevAlphaTest(const AlphaTest& alpha_test, int alpha)
 {
-  const bool comp0 = AlphaCompare(alpha, bpmem.alpha_test.ref0, bpmem.alpha_test.comp0);
-  const bool comp1 = AlphaCompare(alpha, bpmem.alpha_test.ref1, bpmem.alpha_test.comp1);
+  const bool comp0 = AlphaCompare(alpha, alpha_test.ref0, alpha_test.comp0);
+  const bool comp1 = AlphaCompare(alpha, alpha_test.ref1, alpha_test.comp1);
 
-  switch (bpmem.alpha_test.logic)
+  switch (alpha_test.logic)
   {
   case AlphaTestOp::And:
     return comp0 && comp1;
@@ -234,11 +270,157 @@ static bool TevAlphaTest(int alpha)
   case AlphaTestOp::Xnor:
     return !(comp0 ^ comp1);
   default:
-    PanicAlertFmt("Invalid AlphaTestOp {}", bpmem.alpha_test.logic);
+    PanicAlertFmt("Invalid AlphaTestOp {}", alpha_test.logic);
     return true;
   }
 }
 
+std::unique_ptr<Tev::Pipeline> Tev::CompilePipeline(const TevPipelineUid& uid)
+{
+  // Indexed by the op, scale and bias of regular combiners, and by the comparison and compare mode
+  // of compare combiners.
+  static constexpr auto color_regular_funcs = []<size_t... I>(std::index_sequence<I...>) {
+    return std::array<CombinerFunc, sizeof...(I)>{
+        &Tev::DrawColorRegular<TevOp(I >> 4), TevScale((I >> 2) & 3), TevBias(I & 3)>...};
+  }(std::make_index_sequence<32>());
+  static constexpr auto color_compare_funcs = []<size_t... I>(std::index_sequence<I...>) {
+    return std::array<CombinerFunc, sizeof...(I)>{
+        &Tev::DrawColorCompare<TevComparison(I >> 2), TevCompareMode(I & 3)>...};
+  }(std::make_index_sequence<8>());
+  static constexpr auto alpha_regular_funcs = []<size_t... I>(std::index_sequence<I...>) {
+    return std::array<CombinerFunc, sizeof...(I)>{
+        &Tev::DrawAlphaRegular<TevOp(I >> 4), TevScale((I >> 2) & 3), TevBias(I & 3)>...};
+  }(std::make_index_sequence<32>());
+  static constexpr auto alpha_compare_funcs = []<size_t... I>(std::index_sequence<I...>) {
+    return std::array<CombinerFunc, sizeof...(I)>{
+        &Tev::DrawAlphaCompare<TevComparison(I >> 2), TevCompareMode(I & 3)>...};
+  }(std::make_index_sequence<8>());
+
+  const tev_pipeline_uid_data* const uid_data = uid.GetUidData();
+  auto pipeline = std::make_unique<Pipeline>();
+
+  // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
+  // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
+  // This affects the Mario portrait in Luigi's Mansion, where the developers forgot to set
+  // the number of tex gens to 2 (bug 11462).
+  const auto get_texcoord = [uid_data](u32 texcoord) -> u8 {
+    return texcoord < uid_data->num_tex_gens ? texcoord : 0;
+  };
+
+  RAS1_IREF ind_orders;
+  ind_orders.hex = uid_data->ind_orders;
+  pipeline->num_ind_stages = std::min<u32>(uid_data->num_ind_stages, 4);
+  for (u32 i = 0; i < pipeline->num_ind_stages; i++)
+  {
+    TEXSCALE texscale;
+    texscale.hex = (uid_data->ind_scales >> (i >> 1 ? 16 : 0)) & 0xFFFF;
+
+    Pipeline::IndirectStage& ind_stage = pipeline->ind_stages[i];
+    ind_stage.texmap = ind_orders.getTexMap(i);
+    ind_stage.texcoord = get_texcoord(ind_orders.getTexCoord(i));
+    ind_stage.scale_s = i & 1 ? texscale.ss1 : texscale.ss0;
+    ind_stage.scale_t = i & 1 ? texscale.ts1 : texscale.ts0;
+  }
+
+  pipeline->num_tev_stages = uid_data->num_tev_stages + 1;
+  pipeline->has_tex_gens = uid_data->num_tex_gens > 0;
+  for (u32 i = 0; i < pipeline->num_tev_stages; i++)
+  {
+    const auto& uid_stage = uid_data->stages[i];
+    TwoTevStageOrders order;
+    order.hex = uid_stage.order;
+    TevStageCombiner::ColorCombiner cc;
+    cc.hex = uid_stage.color_combiner;
+    TevStageCombiner::AlphaCombiner ac;
+    ac.hex = uid_stage.alpha_combiner;
+
+    Pipeline::Stage& stage = pipeline->stages[i];
+    stage.texmap = order.getTexMap(0);
+    stage.texcoord = get_texcoord(order.getTexCoord(0));
+    stage.sample_texture = order.getEnable(0);
+    stage.indirect = uid_stage.indirect;
+
+    for (u32 channel = 0; channel < 4; channel++)
+    {
+      stage.tex_swap[channel] = (uid_stage.tex_swap >> (2 * channel)) & 3;
+      stage.ras_swap[channel] = (uid_stage.ras_swap >> (2 * channel)) & 3;
+    }
+
+    stage.ras_chan = order.getColorChan(0);
+    if (stage.ras_chan != RasColorChan::Color0 && stage.ras_chan != RasColorChan::Color1 &&
+        stage.ras_chan != RasColorChan::AlphaBump &&
+        stage.ras_chan != RasColorChan::NormalizedAlphaBump &&
+        stage.ras_chan != RasColorChan::Zero)
+    {
+      PanicAlertFmt("Invalid ras color channel: {}", stage.ras_chan);
+      stage.ras_chan = RasColorChan::Zero;
+    }
+
+    stage.konst_color = static_cast<KonstSel>(uid_stage.konst_color);
+    stage.konst_alpha = static_cast<KonstSel>(uid_stage.konst_alpha);
+
+    stage.color_args = {cc.a, cc.b, cc.c, cc.d};
+    stage.alpha_args = {ac.a, ac.b, ac.c, ac.d};
+    stage.color_dest = cc.dest;
+    stage.alpha_dest = ac.dest;
+    stage.color_clamp = cc.clamp;
+    stage.alpha_clamp = ac.clamp;
+
+    if (cc.bias != TevBias::Compare)
+    {
+      stage.color_func =
+          color_regular_funcs[u32(cc.op.Value()) << 4 | u32(cc.scale.Value()) << 2 |
+                              u32(cc.bias.Value())];
+    }
+    else
+    {
+      stage.color_func =
+          color_compare_funcs[u32(cc.comparison.Value()) << 2 | u32(cc.compare_mode.Value())];
+    }
+
+    if (ac.bias != TevBias::Compare)
+    {
+      stage.alpha_func =
+          alpha_regular_funcs[u32(ac.op.Value()) << 4 | u32(ac.scale.Value()) << 2 |
+                              u32(ac.bias.Value())];
+    }
+    else
+    {
+      stage.alpha_func =
+          alpha_compare_funcs[u32(ac.comparison.Value()) << 2 | u32(ac.compare_mode.Value())];
+    }
+  }
+
+  AlphaTest alpha_test;
+  alpha_test.hex = uid_data->alpha_test;
+  for (int alpha = 0; alpha < 256; alpha++)
+    pipeline->alpha_test_pass[alpha] = TevAlphaTest(alpha_test, alpha);
+
+  pipeline->ztex = uid_data->ztex;
+  pipeline->fog = uid_data->fog;
+  pipeline->late_ztest = uid_data->late_ztest;
+
+  return pipeline;
+}
+
+const Tev::Pipeline& Tev::GetPipeline(const TevPipelineUid& uid)
+{
+  auto iter = s_pipelines.find(uid);
+  if (iter == s_pipelines.end())
+  {
+    if (s_pipelines.size() >= MAX_CACHED_PIPELINES)
+      s_pipelines.clear();
+
+    iter = s_pipelines.emplace(uid, CompilePipeline(uid)).first;
+  }
+  return *iter->second;
+}
+
+void Tev::ClearPipelineCache()
+{
+  s_pipelines.clear();
+}
+
 static inline s32 WrapIndirectCoord(s32 coord, IndTexWrap wrapMode)
 {
   switch (wrapMode)
@@ -391,74 +573,47 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  PixelsIn++;
 
-  auto& system = Core::System::GetInstance();
-  auto& pixel_shader_manager = system.GetPixelShaderManager();
+  const Pipeline& pipeline = *m_Pipeline;
 
   // initial color values
-  for (int i = 0; i < 4; i++)
-  {
-    Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
-    Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
-    Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
-    Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
-  }
+  Reg = m_InitialReg;
 
-  for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages; stageNum++)
+  for (u32 stageNum = 0; stageNum < pipeline.num_ind_stages; stageNum++)
   {
-    const int stageNum2 = stageNum >> 1;
-    const int stageOdd = stageNum & 1;
-
-    u32 texcoordSel = bpmem.tevindref.getTexCoord(stageNum);
-    const u32 texmap = bpmem.tevindref.getTexMap(stageNum);
-
-    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
-    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
-    // This affects the Mario portrait in Luigi's Mansion, where the developers forgot to set
-    // the number of tex gens to 2 (bug 11462).
-    if (texcoordSel >= bpmem.genMode.numtexgens)
-      texcoordSel = 0;
-
-    const TEXSCALE& texscale = bpmem.texscale[stageNum2];
-    const s32 scaleS = stageOdd ? texscale.ss1 : texscale.ss0;
-    const s32 scaleT = stageOdd ? texscale.ts1 : texscale.ts0;
-
-    TextureSampler::Sample(Uv[texcoordSel].s >> scaleS, Uv[texcoordSel].t >> scaleT,
-                           IndirectLod[stageNum], IndirectLinear[stageNum], texmap,
+    const Pipeline::IndirectStage& ind_stage = pipeline.ind_stages[stageNum];
+    const TextureCoordinateType& uv = Uv[ind_stage.texcoord];
+    TextureSampler::Sample(uv.s >> ind_stage.scale_s, uv.t >> ind_stage.scale_t,
+                           IndirectLod[stageNum], IndirectLinear[stageNum], ind_stage.texmap,
                            IndirectTex[stageNum]);
   }
 
-  for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
+  for (u32 stageNum = 0; stageNum < pipeline.num_tev_stages; stageNum++)
   {
-    const int stageNum2 = stageNum >> 1;
-    const int stageOdd = stageNum & 1;
-    const TwoTevStageOrders& order = bpmem.tevorders[stageNum2];
-
-    // stage combiners
-    const TevStageCombiner::ColorCombiner& cc = bpmem.combiners[stageNum].colorC;
-    const TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[stageNum].alphaC;
-
-    u32 texcoordSel = order.getTexCoord(stageOdd);
-    const u32 texmap = order.getTexMap(stageOdd);
-
-    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
-    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
-    if (texcoordSel >= bpmem.genMode.numtexgens)
-      texcoordSel = 0;
+    const Pipeline::Stage& stage = pipeline.stages[stageNum];
+    const TextureCoordinateType& uv = Uv[stage.texcoord];
 
-    Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
+    if (stage.indirect)
+    {
+      Indirect(stageNum, uv.s, uv.t);
+    }
+    else
+    {
+      AlphaBump = 0;
+      TexCoord = uv;
+    }
 
     // sample texture
-    if (order.getEnable(stageOdd))
+    if (stage.sample_texture)
     {
       // RGBA
       u8 texel[4];
 
-      if (bpmem.genMode.numtexgens > 0)
+      if (pipeline.has_tex_gens)
       {
         TextureSampler::Sample(TexCoord.s, TexCoord.t, TextureLod[stageNum],
-                               TextureLinear[stageNum], texmap, texel);
+                               TextureLinear[stageNum], stage.texmap, texel);
       }
       else
       {
@@ -467,85 +622,74 @@ void Tev::Draw()
         std::memset(texel, 0, 4);
       }
 
-      const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
-      TexColor.r = texel[u32(swap[ColorChannel::Red])];
-      TexColor.g = texel[u32(swap[ColorChannel::Green])];
-      TexColor.b = texel[u32(swap[ColorChannel::Blue])];
-      TexColor.a = texel[u32(swap[ColorChannel::Alpha])];
+      TexColor.r = texel[stage.tex_swap[0]];
+      TexColor.g = texel[stage.tex_swap[1]];
+      TexColor.b = texel[stage.tex_swap[2]];
+      TexColor.a = texel[stage.tex_swap[3]];
     }
 
-    // set konst for this stage
-    const auto kc = bpmem.tevksel.GetKonstColor(stageNum);
-    const auto ka = bpmem.tevksel.GetKonstAlpha(stageNum);
-    StageKonst.r = m_KonstLUT[kc].r;
-    StageKonst.g = m_KonstLUT[kc].g;
-    StageKonst.b = m_KonstLUT[kc].b;
-    StageKonst.a = m_KonstLUT[ka].a;
-
-    // set color
-    SetRasColor(order.getColorChan(stageOdd), ac.rswap);
+    StageKonst = m_StageKonst[stageNum];
+    SetRasColor(stage);
 
     // combine inputs
+    const auto& [ca, cb, cc, cd] = stage.color_args;
+    const auto& [aa, ab, ac, ad] = stage.alpha_args;
     InputRegType inputs[4];
-    inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
-    inputs[BLU_C].b = m_ColorInputLUT[cc.b].b;
-    inputs[BLU_C].c = m_ColorInputLUT[cc.c].b;
-    inputs[BLU_C].d = m_ColorInputLUT[cc.d].b;
-    inputs[GRN_C].a = m_ColorInputLUT[cc.a].g;
-    inputs[GRN_C].b = m_ColorInputLUT[cc.b].g;
-    inputs[GRN_C].c = m_ColorInputLUT[cc.c].g;
-    inputs[GRN_C].d = m_ColorInputLUT[cc.d].g;
-    inputs[RED_C].a = m_ColorInputLUT[cc.a].r;
-    inputs[RED_C].b = m_ColorInputLUT[cc.b].r;
-    inputs[RED_C].c = m_ColorInputLUT[cc.c].r;
-    inputs[RED_C].d = m_ColorInputLUT[cc.d].r;
-    inputs[ALP_C].a = m_AlphaInputLUT[ac.a].a;
-    inputs[ALP_C].b = m_AlphaInputLUT[ac.b].a;
-    inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
-    inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
-
-    if (cc.bias != TevBias::Compare)
-      DrawColorRegular(cc, inputs);
-    else
-      DrawColorCompare(cc, inputs);
-
-    if (cc.clamp)
+    inputs[BLU_C].a = m_ColorInputLUT[ca].b;
+    inputs[BLU_C].b = m_ColorInputLUT[cb].b;
+    inputs[BLU_C].c = m_ColorInputLUT[cc].b;
+    inputs[BLU_C].d = m_ColorInputLUT[cd].b;
+    inputs[GRN_C].a = m_ColorInputLUT[ca].g;
+    inputs[GRN_C].b = m_ColorInputLUT[cb].g;
+    inputs[GRN_C].c = m_ColorInputLUT[cc].g;
+    inputs[GRN_C].d = m_ColorInputLUT[cd].g;
+    inputs[RED_C].a = m_ColorInputLUT[ca].r;
+    inputs[RED_C].b = m_ColorInputLUT[cb].r;
+    inputs[RED_C].c = m_ColorInputLUT[cc].r;
+    inputs[RED_C].d = m_ColorInputLUT[cd].r;
+    inputs[ALP_C].a = m_AlphaInputLUT[aa].a;
+    inputs[ALP_C].b = m_AlphaInputLUT[ab].a;
+    inputs[ALP_C].c = m_AlphaInputLUT[ac].a;
+    inputs[ALP_C].d = m_AlphaInputLUT[ad].a;
+
+    (this->*stage.color_func)(stage.color_dest, inputs);
+
+    TevColor& color_dest = Reg[stage.color_dest];
+    if (stage.color_clamp)
     {
-      Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
+      color_dest.r = Clamp255(color_dest.r);
+      color_dest.g = Clamp255(color_dest.g);
+      color_dest.b = Clamp255(color_dest.b);
     }
     else
     {
-      Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
+      color_dest.r = Clamp1024(color_dest.r);
+      color_dest.g = Clamp1024(color_dest.g);
+      color_dest.b = Clamp1024(color_dest.b);
     }
 
-    if (ac.bias != TevBias::Compare)
-      DrawAlphaRegular(ac, inputs);
-    else
-      DrawAlphaCompare(ac, inputs);
+    (this->*stage.alpha_func)(stage.alpha_dest, inputs);
 
-    if (ac.clamp)
-      Reg[ac.dest].a = Clamp255(Reg[ac.dest].a);
+    TevColor& alpha_dest = Reg[stage.alpha_dest];
+    if (stage.alpha_clamp)
+      alpha_dest.a = Clamp255(alpha_dest.a);
     else
-      Reg[ac.dest].a = Clamp1024(Reg[ac.dest].a);
+      alpha_dest.a = Clamp1024(alpha_dest.a);
   }
 
   // convert to 8 bits per component
   // the results of the last tev stage are put onto the screen,
   // regardless of the used destination register - TODO: Verify!
-  const auto& color_index = bpmem.combiners[bpmem.genMode.numtevstages].colorC.dest;
-  const auto& alpha_index = bpmem.combiners[bpmem.genMode.numtevstages].alphaC.dest;
-  u8 output[4] = {(u8)Reg[alpha_index].a, (u8)Reg[color_index].b, (u8)Reg[color_index].g,
-                  (u8)Reg[color_index].r};
+  const Pipeline::Stage& last_stage = pipeline.stages[pipeline.num_tev_stages - 1];
+  const TevColor& color_out = Reg[last_stage.color_dest];
+  u8 output[4] = {(u8)Reg[last_stage.alpha_dest].a, (u8)color_out.b, (u8)color_out.g,
+                  (u8)color_out.r};
 
-  if (!TevAlphaTest(output[ALP_C]))
+  if (!pipeline.alpha_test_pass[output[ALP_C]])
     return;
 
   // z texture
-  if (bpmem.ztex2.op != ZTexOp::Disabled)
+  if (pipeline.ztex)
   {
     u32 ztex = bpmem.ztex1.bias;
     switch (bpmem.ztex2.type)
@@ -570,7 +714,7 @@ void Tev::Draw()
   }
 
   // fog
-  if (bpmem.fog.c_proj_fsel.fsel != FogType::Off)
+  if (pipeline.fog)
   {
     float ze;
 
@@ -657,7 +801,7 @@ void Tev::Draw()
     output[BLU_C] = (output[BLU_C] * invFog + fogInt * bpmem.fog.color.b) >> 8;
   }
 
-  if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
+  if (pipeline.late_ztest)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
     EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
@@ -673,22 +817,39 @@ void Tev::Draw()
   BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
                       static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
+  PixelsOut++;
   EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
 
-void Tev::SetKonstColors()
+void Tev::SetPipeline(const Pipeline& pipeline)
 {
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
 
   for (int i = 0; i < 4; i++)
   {
+    m_InitialReg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
+    m_InitialReg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
+    m_InitialReg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
+    m_InitialReg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
+
     KonstantColors[i].r = pixel_shader_manager.constants.kcolors[i][0];
     KonstantColors[i].g = pixel_shader_manager.constants.kcolors[i][1];
     KonstantColors[i].b = pixel_shader_manager.constants.kcolors[i][2];
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
+
+  // The konst selection of each stage only changes between batches, so look it up once.
+  for (u32 i = 0; i < pipeline.num_tev_stages; i++)
+  {
+    const Pipeline::Stage& stage = pipeline.stages[i];
+    m_StageKonst[i].r = m_KonstLUT[stage.konst_color].r;
+    m_StageKonst[i].g = m_KonstLUT[stage.konst_color].g;
+    m_StageKonst[i].b = m_KonstLUT[stage.konst_color].b;
+    m_StageKonst[i].a = m_KonstLUT[stage.konst_alpha].a;
+  }
+
+  m_Pipeline = &pipeline;
 }
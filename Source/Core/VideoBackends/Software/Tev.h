@@ -4,9 +4,55 @@
 #pragma once
 
 #include <array>
+#include <memory>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/ShaderGenCommon.h"
+
+// The render state which decides what Tev::Draw does with each pixel. Like the pixel shader UIDs of
+// the hardware backends, it only holds the state of the stages in use. The values which the
+// pipeline doesn't branch on, such as the register colors, are loaded for each batch instead.
+struct tev_pipeline_uid_data
+{
+  u32 num_tev_stages : 4;
+  u32 num_ind_stages : 3;
+  u32 num_tex_gens : 4;
+  u32 late_ztest : 1;
+  u32 ztex : 1;
+  u32 fog : 1;
+  u32 pad0 : 18;
+
+  u32 alpha_test : 24;
+  u32 pad1 : 8;
+
+  u32 ind_orders : 24;
+  u32 pad2 : 8;
+  u32 ind_scales;
+
+  struct
+  {
+    u32 color_combiner : 24;
+    u32 konst_color : 5;
+    u32 indirect : 1;
+    u32 pad0 : 2;
+
+    // Without the swap table IDs, as the swap tables themselves are stored below.
+    u32 alpha_combiner : 24;
+    u32 konst_alpha : 5;
+    u32 pad1 : 3;
+
+    u32 order : 10;
+    u32 tex_swap : 8;
+    u32 ras_swap : 8;
+    u32 pad2 : 6;
+  } stages[16];
+};
+
+using TevPipelineUid = ShaderUid<tev_pipeline_uid_data>;
+
+TevPipelineUid GetTevPipelineUid();
 
 class Tev
 {
@@ -203,15 +249,85 @@ class Tev
     INDIRECT = 32
   };
 
-  void SetRasColor(RasColorChan colorChan, u32 swaptable);
+  using CombinerFunc = void (Tev::*)(TevOutput dest, const InputRegType inputs[4]);
 
-  void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
-  void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
+public:
+  // The render state compiled into the steps Draw takes for each pixel, so that pixels don't
+  // decode bpmem again. Pipelines are cached by their UID and shared by all rasterizer threads.
+  struct Pipeline
+  {
+    struct IndirectStage
+    {
+      u8 texmap;
+      u8 texcoord;
+      u8 scale_s;
+      u8 scale_t;
+    };
+
+    struct Stage
+    {
+      u8 texmap;
+      u8 texcoord;
+      bool sample_texture;
+      bool indirect;
+
+      // Channels of the texel and the rasterized color which go to red, green, blue and alpha.
+      std::array<u8, 4> tex_swap;
+      std::array<u8, 4> ras_swap;
+      RasColorChan ras_chan;
+
+      KonstSel konst_color;
+      KonstSel konst_alpha;
+
+      std::array<TevColorArg, 4> color_args;
+      std::array<TevAlphaArg, 4> alpha_args;
+      TevOutput color_dest;
+      TevOutput alpha_dest;
+      bool color_clamp;
+      bool alpha_clamp;
+      CombinerFunc color_func;
+      CombinerFunc alpha_func;
+    };
+
+    u32 num_ind_stages;
+    std::array<IndirectStage, 4> ind_stages;
+    u32 num_tev_stages;
+    std::array<Stage, 16> stages;
+    bool has_tex_gens;
+
+    // Whether each output alpha passes the alpha test.
+    std::array<bool, 256> alpha_test_pass;
+
+    bool ztex;
+    bool fog;
+    bool late_ztest;
+  };
+
+  // Returns the pipeline for the UID, compiling it if it isn't cached yet. Must not be called while
+  // another thread is drawing with a pipeline.
+  static const Pipeline& GetPipeline(const TevPipelineUid& uid);
+  static void ClearPipelineCache();
+
+private:
+  static std::unique_ptr<Pipeline> CompilePipeline(const TevPipelineUid& uid);
+
+  void SetRasColor(const Pipeline::Stage& stage);
+
+  template <TevOp op, TevScale scale, TevBias bias>
+  void DrawColorRegular(TevOutput dest, const InputRegType inputs[4]);
+  template <TevComparison comparison, TevCompareMode mode>
+  void DrawColorCompare(TevOutput dest, const InputRegType inputs[4]);
+  template <TevOp op, TevScale scale, TevBias bias>
+  void DrawAlphaRegular(TevOutput dest, const InputRegType inputs[4]);
+  template <TevComparison comparison, TevCompareMode mode>
+  void DrawAlphaCompare(TevOutput dest, const InputRegType inputs[4]);
 
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
+  const Pipeline* m_Pipeline = nullptr;
+  Common::EnumMap<TevColor, TevOutput::Color2> m_InitialReg;
+  std::array<TevColor, 16> m_StageKonst;
+
 public:
   s32 Position[3]{};
   u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
@@ -221,6 +337,10 @@ public:
   s32 TextureLod[16]{};
   bool TextureLinear[16]{};
 
+  // Counted here rather than in the statistics, as each rasterizer thread has its own Tev.
+  int PixelsIn = 0;
+  int PixelsOut = 0;
+
   enum
   {
     ALP_C,
@@ -229,6 +349,7 @@ public:
     RED_C
   };
 
-  void SetKonstColors();
+  // Draws the following pixels with the pipeline, and loads the register and konst colors for it.
+  void SetPipeline(const Pipeline& pipeline);
   void Draw();
 };
@@ -10,14 +10,14 @@ namespace SW
 class TextureCache : public TextureCacheBase
 {
 protected:
-  void CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
-               u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
+  void CopyEFB(AbstractStagingTexture* dst, u32 dst_row, const EFBCopyParams& params,
+               u32 native_width, u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
                const MathUtil::Rectangle<int>& src_rect, bool scale_by_half, bool linear_filter,
                float y_scale, float gamma, bool clamp_top, bool clamp_bottom,
                const std::array<u32, 3>& filter_coefficients) override
   {
-    TextureEncoder::Encode(dst, params, native_width, bytes_per_row, num_blocks_y, memory_stride,
-                           src_rect, scale_by_half, y_scale, gamma);
+    TextureEncoder::Encode(dst, dst_row, params, native_width, bytes_per_row, num_blocks_y,
+                           memory_stride, src_rect, scale_by_half, y_scale, gamma);
   }
   void CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_copy,
                            const MathUtil::Rectangle<int>& src_rect, bool scale_by_half,
@@ -215,8 +215,7 @@ static void SetBlockDimensions(int blkWidthLog2, int blkHeightLog2, u16* sBlkCou
   *tBlkSize = 1 << blkHeightLog2;
 }
 
-static void SetSpans(int sBlkSize, int tBlkSize, s32* tSpan, s32* sBlkSpan, s32* tBlkSpan,
-                     s32* writeStride)
+static void SetSpans(int sBlkSize, int tBlkSize, s32* tSpan, s32* sBlkSpan, s32* tBlkSpan)
 {
   // width is 1 less than the number of pixels of width
   u32 width = bpmem.copyTexSrcWH.x >> bpmem.triggerEFBCopy.half_scale;
@@ -230,8 +229,6 @@ static void SetSpans(int sBlkSize, int tBlkSize, s32* tSpan, s32* sBlkSpan, s32*
       ((-640 * tBlkSize) + sBlkSize) * readStride;  // bytes to advance src pointer after each block
   *tBlkSpan = ((640 * tBlkSize) - alignedWidth) *
               readStride;  // bytes to advance src pointer after each row of blocks
-
-  *writeStride = bpmem.copyDestStride << 5;
 }
 
 #define ENCODE_LOOP_BLOCKS                                                                         \
@@ -265,10 +262,10 @@ static void SetSpans(int sBlkSize, int tBlkSize, s32* tSpan, s32* sBlkSpan, s32*
   dstBlockStart += writeStride;                                                                    \
   }
 
-static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
+static void EncodeRGBA6(u8* dst, s32 writeStride, const u8* src, EFBCopyFormat format, bool yuv)
 {
   u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
-  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  s32 tSpan, sBlkSpan, tBlkSpan;
   u8 r, g, b, a;
   u32 readStride = 3;
   u8* dstBlockStart = dst;
@@ -277,7 +274,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   {
   case EFBCopyFormat::R4:
     SetBlockDimensions(3, 3, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     sBlkSize /= 2;
     if (yuv)
     {
@@ -314,7 +311,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::R8_0x1:
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -339,7 +336,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RA4:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -364,7 +361,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -391,7 +388,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RGB565:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u32 srcColor = *(u32*)src;
@@ -407,7 +404,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RGB5A3:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u32 srcColor = *(u32*)src;
@@ -430,7 +427,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       RGBA_to_RGBA8(src, &dst[1], &dst[32], &dst[33], &dst[0]);
@@ -442,7 +439,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::A8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u32 srcColor = *(u32*)src;
@@ -454,7 +451,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::G8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u32 srcColor = *(u32*)src;
@@ -466,7 +463,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::B8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u32 srcColor = *(u32*)src;
@@ -478,7 +475,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RG8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u32 srcColor = *(u32*)src;
@@ -491,7 +488,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::GB8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u32 srcColor = *(u32*)src;
@@ -508,10 +505,11 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   }
 }
 
-static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
+static void EncodeRGBA6halfscale(u8* dst, s32 writeStride, const u8* src, EFBCopyFormat format,
+                                 bool yuv)
 {
   u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
-  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  s32 tSpan, sBlkSpan, tBlkSpan;
   u8 r, g, b, a;
   u32 readStride = 6;
   u8* dstBlockStart = dst;
@@ -520,7 +518,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
   {
   case EFBCopyFormat::R4:
     SetBlockDimensions(3, 3, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     sBlkSize /= 2;
     if (yuv)
     {
@@ -557,7 +555,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
   case EFBCopyFormat::R8_0x1:
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -582,7 +580,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::RA4:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -607,7 +605,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::RA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -634,7 +632,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::RGB565:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGBA_to_RGB8(src, &r, &g, &b);
@@ -649,7 +647,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::RGB5A3:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGBA_to_RGBA8(src, &r, &g, &b, &a);
@@ -669,7 +667,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGBA_to_RGBA8(src, &dst[1], &dst[32], &dst[33], &dst[0]);
@@ -681,7 +679,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::A8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGBA_to_x8(src, &a, 0);
@@ -693,7 +691,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::G8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGBA_to_x8(src, &g, 12);
@@ -705,7 +703,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::B8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGBA_to_x8(src, &b, 6);
@@ -717,7 +715,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::RG8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGBA_to_xx8(src, &r, &g, 18, 12);
@@ -730,7 +728,7 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
 
   case EFBCopyFormat::GB8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGBA_to_xx8(src, &g, &b, 12, 6);
@@ -747,10 +745,10 @@ static void EncodeRGBA6halfscale(u8* dst, const u8* src, EFBCopyFormat format, b
   }
 }
 
-static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
+static void EncodeRGB8(u8* dst, s32 writeStride, const u8* src, EFBCopyFormat format, bool yuv)
 {
   u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
-  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  s32 tSpan, sBlkSpan, tBlkSpan;
   u32 readStride = 3;
   u8* dstBlockStart = dst;
 
@@ -758,7 +756,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   {
   case EFBCopyFormat::R4:
     SetBlockDimensions(3, 3, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     sBlkSize /= 2;
     if (yuv)
     {
@@ -792,7 +790,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::R8_0x1:
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -815,7 +813,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RA4:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -838,7 +836,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -864,7 +862,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RGB565:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u16 val = ((src[2] << 8) & 0xf800) | ((src[1] << 3) & 0x07e0) | ((src[0] >> 3) & 0x001f);
@@ -877,7 +875,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RGB5A3:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       u16 val =
@@ -891,7 +889,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       dst[0] = 0xff;
@@ -906,14 +904,14 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::A8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS { *dst++ = 0xff; }
     ENCODE_LOOP_SPANS
     break;
 
   case EFBCopyFormat::G8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[1];
@@ -924,7 +922,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::B8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[0];
@@ -935,7 +933,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::RG8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       // FIXME: is this backwards?
@@ -948,7 +946,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::GB8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[0];
@@ -964,10 +962,11 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   }
 }
 
-static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
+static void EncodeRGB8halfscale(u8* dst, s32 writeStride, const u8* src, EFBCopyFormat format,
+                                bool yuv)
 {
   u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
-  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  s32 tSpan, sBlkSpan, tBlkSpan;
   u8 r, g, b;
   u32 readStride = 6;
   u8* dstBlockStart = dst;
@@ -976,7 +975,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
   {
   case EFBCopyFormat::R4:
     SetBlockDimensions(3, 3, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     sBlkSize /= 2;
     if (yuv)
     {
@@ -1014,7 +1013,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
   case EFBCopyFormat::R8_0x1:
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -1039,7 +1038,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::RA4:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -1064,7 +1063,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::RA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -1091,7 +1090,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::RGB565:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_RGB8(src, &r, &g, &b);
@@ -1105,7 +1104,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::RGB5A3:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_RGB8(src, &r, &g, &b);
@@ -1119,7 +1118,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_RGB8(src, &r, &g, &b);
@@ -1135,14 +1134,14 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::A8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS { *dst++ = 0xff; }
     ENCODE_LOOP_SPANS
     break;
 
   case EFBCopyFormat::G8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_x8(src, &g, 1);
@@ -1154,7 +1153,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::B8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_x8(src, &b, 0);
@@ -1166,7 +1165,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::RG8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_xx8(src, &r, &g, 2, 1);
@@ -1179,7 +1178,7 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
 
   case EFBCopyFormat::GB8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_xx8(src, &g, &b, 1, 0);
@@ -1196,10 +1195,10 @@ static void EncodeRGB8halfscale(u8* dst, const u8* src, EFBCopyFormat format, bo
   }
 }
 
-static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
+static void EncodeZ24(u8* dst, s32 writeStride, const u8* src, EFBCopyFormat format)
 {
   u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
-  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  s32 tSpan, sBlkSpan, tBlkSpan;
   u32 readStride = 3;
   u8* dstBlockStart = dst;
 
@@ -1208,7 +1207,7 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
   case EFBCopyFormat::R8_0x1:
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[2];
@@ -1221,7 +1220,7 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       dst[0] = 0xff;
@@ -1236,7 +1235,7 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::R4:
     SetBlockDimensions(3, 3, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     sBlkSize /= 2;
     ENCODE_LOOP_BLOCKS
     {
@@ -1253,7 +1252,7 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::G8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[1];
@@ -1264,7 +1263,7 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::B8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[0];
@@ -1275,7 +1274,7 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::RG8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       // FIXME: should these be reversed?
@@ -1288,7 +1287,7 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::GB8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[0];
@@ -1304,10 +1303,10 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
   }
 }
 
-static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
+static void EncodeZ24halfscale(u8* dst, s32 writeStride, const u8* src, EFBCopyFormat format)
 {
   u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
-  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  s32 tSpan, sBlkSpan, tBlkSpan;
   u32 readStride = 6;
   u8 r, g, b;
   u8* dstBlockStart = dst;
@@ -1317,7 +1316,7 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
   case EFBCopyFormat::R8_0x1:
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_x8(src, &b, 2);
@@ -1331,7 +1330,7 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_RGB8(src, &dst[33], &dst[32], &dst[1]);
@@ -1344,7 +1343,7 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::R4:  // Z4
     SetBlockDimensions(3, 3, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     sBlkSize /= 2;
     ENCODE_LOOP_BLOCKS
     {
@@ -1363,7 +1362,7 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::G8:  // Z8M
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_x8(src, &g, 1);
@@ -1375,7 +1374,7 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::B8:  // Z8L
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_x8(src, &r, 0);
@@ -1387,7 +1386,7 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::RG8:  // RG8
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_xx8(src, &r, &g, 0, 1);
@@ -1400,7 +1399,7 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
 
   case EFBCopyFormat::GB8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan);
     ENCODE_LOOP_BLOCKS
     {
       BoxfilterRGB_to_xx8(src, &g, &b, 1, 2);
@@ -1420,27 +1419,27 @@ static void EncodeZ24halfscale(u8* dst, const u8* src, EFBCopyFormat format)
 
 namespace
 {
-void EncodeEfbCopy(u8* dst, const EFBCopyParams& params, u32 native_width, u32 bytes_per_row,
-                   u32 num_blocks_y, u32 memory_stride, const MathUtil::Rectangle<int>& src_rect,
-                   bool scale_by_half)
+void EncodeEfbCopy(u8* dst, u32 dst_stride, const EFBCopyParams& params,
+                   const MathUtil::Rectangle<int>& src_rect, bool scale_by_half)
 {
   const u8* src = EfbInterface::GetPixelPointer(src_rect.left, src_rect.top, params.depth);
+  const s32 stride = static_cast<s32>(dst_stride);
 
   if (scale_by_half)
   {
     switch (params.efb_format)
     {
     case PixelFormat::RGBA6_Z24:
-      EncodeRGBA6halfscale(dst, src, params.copy_format, params.yuv);
+      EncodeRGBA6halfscale(dst, stride, src, params.copy_format, params.yuv);
       break;
     case PixelFormat::RGB8_Z24:
-      EncodeRGB8halfscale(dst, src, params.copy_format, params.yuv);
+      EncodeRGB8halfscale(dst, stride, src, params.copy_format, params.yuv);
       break;
     case PixelFormat::RGB565_Z16:
-      EncodeRGB8halfscale(dst, src, params.copy_format, params.yuv);
+      EncodeRGB8halfscale(dst, stride, src, params.copy_format, params.yuv);
       break;
     case PixelFormat::Z24:
-      EncodeZ24halfscale(dst, src, params.copy_format);
+      EncodeZ24halfscale(dst, stride, src, params.copy_format);
       break;
     default:
       break;
@@ -1451,16 +1450,16 @@ void EncodeEfbCopy(u8* dst, const EFBCopyParams& params, u32 native_width, u32 b
     switch (params.efb_format)
     {
     case PixelFormat::RGBA6_Z24:
-      EncodeRGBA6(dst, src, params.copy_format, params.yuv);
+      EncodeRGBA6(dst, stride, src, params.copy_format, params.yuv);
       break;
     case PixelFormat::RGB8_Z24:
-      EncodeRGB8(dst, src, params.copy_format, params.yuv);
+      EncodeRGB8(dst, stride, src, params.copy_format, params.yuv);
       break;
     case PixelFormat::RGB565_Z16:
-      EncodeRGB8(dst, src, params.copy_format, params.yuv);
+      EncodeRGB8(dst, stride, src, params.copy_format, params.yuv);
       break;
     case PixelFormat::Z24:
-      EncodeZ24(dst, src, params.copy_format);
+      EncodeZ24(dst, stride, src, params.copy_format);
       break;
     default:
       break;
@@ -1469,27 +1468,21 @@ void EncodeEfbCopy(u8* dst, const EFBCopyParams& params, u32 native_width, u32 b
 }
 }  // namespace
 
-void Encode(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
-            u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
+void Encode(AbstractStagingTexture* dst, u32 dst_row, const EFBCopyParams& params,
+            u32 native_width, u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
             const MathUtil::Rectangle<int>& src_rect, bool scale_by_half, float y_scale,
             float gamma)
 {
-  // HACK: Override the memory stride for this staging texture with new copy stride.
-  // This is required because the texture encoder assumes that we're writing directly to memory,
-  // and each row is tightly packed with no padding, whereas our encoding abstract texture has
-  // a width of 2560. When we copy the texture back later on, it'll use the tightly packed stride.
-  ASSERT(memory_stride <= (dst->GetConfig().width * dst->GetTexelSize()));
-  static_cast<SW::SWStagingTexture*>(dst)->SetMapStride(memory_stride);
+  // The copy is encoded straight to the requested rows of the staging texture. Its rows are 2560
+  // texels apart rather than memory_stride bytes, which is accounted for when it's read back.
+  const u32 dst_stride = static_cast<u32>(dst->GetMappedStride());
+  ASSERT(memory_stride <= dst_stride && bytes_per_row <= memory_stride &&
+         dst_row + num_blocks_y <= dst->GetHeight());
+  u8* dst_ptr = reinterpret_cast<u8*>(dst->GetMappedPointer()) + dst_row * dst_stride;
 
   if (params.copy_format == EFBCopyFormat::XFB)
-  {
-    EfbInterface::EncodeXFB(reinterpret_cast<u8*>(dst->GetMappedPointer()), native_width, src_rect,
-                            y_scale, gamma);
-  }
+    EfbInterface::EncodeXFB(dst_ptr, dst_stride, native_width, src_rect, y_scale, gamma);
   else
-  {
-    EncodeEfbCopy(reinterpret_cast<u8*>(dst->GetMappedPointer()), params, native_width,
-                  bytes_per_row, num_blocks_y, memory_stride, src_rect, scale_by_half);
-  }
+    EncodeEfbCopy(dst_ptr, dst_stride, params, src_rect, scale_by_half);
 }
 }  // namespace TextureEncoder
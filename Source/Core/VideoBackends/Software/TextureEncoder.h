@@ -9,8 +9,8 @@
 
 namespace TextureEncoder
 {
-void Encode(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
-            u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
+void Encode(AbstractStagingTexture* dst, u32 dst_row, const EFBCopyParams& params,
+            u32 native_width, u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
             const MathUtil::Rectangle<int>& src_rect, bool scale_by_half, float y_scale,
             float gamma);
 }
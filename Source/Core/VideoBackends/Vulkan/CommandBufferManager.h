@@ -84,6 +84,10 @@ public:
   // Also invokes callbacks for completion.
   void WaitForFenceCounter(u64 fence_counter);
 
+  // Checks whether a fence has been completed, without waiting. Invokes the callbacks for
+  // completion if it has.
+  bool IsFenceCounterComplete(u64 fence_counter);
+
   void SubmitCommandBuffer(bool submit_on_worker_thread, bool wait_for_completion,
                            bool advance_to_next_frame = false,
                            VkSwapchainKHR present_swap_chain = VK_NULL_HANDLE,
@@ -5,12 +5,12 @@
 
 #include <algorithm>
 #include <array>
+#include <string_view>
 #include <type_traits>
 
 #include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
 #include "Common/FileUtil.h"
-#include "Common/LinearDiskCache.h"
 #include "Common/MsgHandler.h"
 
 #include "Core/ConfigManager.h"
@@ -507,26 +507,12 @@ void ObjectCache::DestroyRenderPassCache()
   m_render_pass_cache.clear();
 }
 
-class PipelineCacheReadCallback : public Common::LinearDiskCacheReader<u32, u8>
-{
-public:
-  PipelineCacheReadCallback(std::vector<u8>* data) : m_data(data) {}
-  void Read(const u32& key, const u8* value, u32 value_size) override
-  {
-    m_data->resize(value_size);
-    if (value_size > 0)
-      memcpy(m_data->data(), value, value_size);
-  }
+// We write a single key of 1, with the entire pipeline cache data.
+constexpr u32 PIPELINE_CACHE_DISK_KEY = 1;
 
-private:
-  std::vector<u8>* m_data;
-};
-
-class PipelineCacheReadIgnoreCallback : public Common::LinearDiskCacheReader<u32, u8>
-{
-public:
-  void Read(const u32& key, const u8* value, u32 value_size) override {}
-};
+// The driver validates the blob itself (see ValidatePipelineCache), so unlike the shader caches,
+// the file does not need to be discarded when Dolphin's version changes.
+constexpr std::string_view PIPELINE_CACHE_DISK_VERSION = "VkPipelineCache";
 
 bool ObjectCache::CreatePipelineCache()
 {
@@ -558,16 +544,17 @@ bool ObjectCache::LoadPipelineCache()
   // we delete the old one, by which time the game's unique ID is already cleared.
   m_pipeline_cache_filename = GetDiskShaderCacheFileName(APIType::Vulkan, "Pipeline", false, true);
 
+  // The disk cache is kept open until the pipeline cache is saved, so that compacting it can
+  // happen in the background while the game runs.
   std::vector<u8> disk_data;
-  Common::LinearDiskCache<u32, u8> disk_cache;
-  PipelineCacheReadCallback read_callback(&disk_data);
-  if (disk_cache.OpenAndRead(m_pipeline_cache_filename, read_callback) != 1)
-    disk_data.clear();
+  m_pipeline_disk_cache.Open(m_pipeline_cache_filename, PIPELINE_CACHE_DISK_VERSION);
+  m_pipeline_disk_cache.Lookup(PIPELINE_CACHE_DISK_KEY, [&](const u8* value, u32 value_size) {
+    disk_data.assign(value, value + value_size);
+  });
 
   if (!disk_data.empty() && !ValidatePipelineCache(disk_data.data(), disk_data.size()))
   {
-    // Don't use this data. In fact, we should delete it to prevent it from being used next time.
-    File::Delete(m_pipeline_cache_filename);
+    // Don't use this data. It is replaced with the new pipeline cache when that is saved.
     return CreatePipelineCache();
   }
 
@@ -679,17 +666,11 @@ void ObjectCache::SavePipelineCache()
     return;
   }
 
-  // Delete the old cache and re-create.
-  File::Delete(m_pipeline_cache_filename);
-
-  // We write a single key of 1, with the entire pipeline cache data.
-  // Not ideal, but our disk cache class does not support just writing a single blob
-  // of data without specifying a key.
-  Common::LinearDiskCache<u32, u8> disk_cache;
-  PipelineCacheReadIgnoreCallback callback;
-  disk_cache.OpenAndRead(m_pipeline_cache_filename, callback);
-  disk_cache.Append(1, data.data(), static_cast<u32>(data.size()));
-  disk_cache.Close();
+  // Appending replaces the previously saved data.
+  if (!m_pipeline_disk_cache.IsOpen())
+    m_pipeline_disk_cache.Open(m_pipeline_cache_filename, PIPELINE_CACHE_DISK_VERSION);
+  m_pipeline_disk_cache.Append(PIPELINE_CACHE_DISK_KEY, data.data(), static_cast<u32>(data.size()));
+  m_pipeline_disk_cache.Close();
 }
 
 void ObjectCache::ReloadPipelineCache()
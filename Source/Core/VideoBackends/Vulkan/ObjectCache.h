@@ -12,7 +12,7 @@
 #include <unordered_map>
 
 #include "Common/CommonTypes.h"
-#include "Common/LinearDiskCache.h"
+#include "Common/IndexedDiskCache.h"
 
 #include "VideoBackends/Vulkan/Constants.h"
 
@@ -108,6 +108,7 @@ private:
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
   std::string m_pipeline_cache_filename;
+  Common::IndexedDiskCache<u32, u8> m_pipeline_disk_cache;
 };
 
 extern std::unique_ptr<ObjectCache> g_object_cache;
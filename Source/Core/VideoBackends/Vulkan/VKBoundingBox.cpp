@@ -38,6 +38,41 @@ bool VKBoundingBox::Initialize()
 }
 
 std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+{
+  CopyToReadbackBuffer();
+
+  // Wait until these commands complete.
+  VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
+
+  // Cache is now valid.
+  m_readback_buffer->InvalidateCPUCache();
+
+  // Read out the values and return
+  std::vector<BBoxType> values(length);
+  m_readback_buffer->Read(index * sizeof(BBoxType), values.data(), length * sizeof(BBoxType),
+                          false);
+  return values;
+}
+
+void VKBoundingBox::StartAsyncRead()
+{
+  CopyToReadbackBuffer();
+  m_async_read_fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+}
+
+std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> VKBoundingBox::TryFinishAsyncRead()
+{
+  // The copy completes along with the command buffer it was recorded into, which is submitted
+  // at the latest when the frame ends.
+  if (!g_command_buffer_mgr->IsFenceCounterComplete(m_async_read_fence_counter))
+    return std::nullopt;
+
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  m_readback_buffer->Read(0, values.data(), BUFFER_SIZE, true);
+  return values;
+}
+
+void VKBoundingBox::CopyToReadbackBuffer()
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -63,18 +98,6 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
   m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-  // Wait until these commands complete.
-  VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
-
-  // Cache is now valid.
-  m_readback_buffer->InvalidateCPUCache();
-
-  // Read out the values and return
-  std::vector<BBoxType> values(length);
-  m_readback_buffer->Read(index * sizeof(BBoxType), values.data(), length * sizeof(BBoxType),
-                          false);
-  return values;
 }
 
 void VKBoundingBox::Write(u32 index, std::span<const BBoxType> values)
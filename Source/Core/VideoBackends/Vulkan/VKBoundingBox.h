@@ -5,6 +5,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "Common/CommonTypes.h"
@@ -28,9 +29,14 @@ protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
 
+  bool SupportsAsyncReadback() const override { return true; }
+  void StartAsyncRead() override;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> TryFinishAsyncRead() override;
+
 private:
   bool CreateGPUBuffer();
   bool CreateReadbackBuffer();
+  void CopyToReadbackBuffer();
 
   VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
   VmaAllocation m_gpu_allocation = VK_NULL_HANDLE;
@@ -38,6 +44,7 @@ private:
   static constexpr size_t BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
 
   std::unique_ptr<StagingBuffer> m_readback_buffer;
+  u64 m_async_read_fence_counter = 0;
 };
 
 }  // namespace Vulkan
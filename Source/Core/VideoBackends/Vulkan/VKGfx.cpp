@@ -45,7 +45,11 @@ VKGfx::VKGfx(std::unique_ptr<SwapChain> swap_chain, float backbuffer_scale)
   ExecuteCommandBuffer(true, false);
 }
 
-VKGfx::~VKGfx() = default;
+VKGfx::~VKGfx()
+{
+  if (m_timestamp_query_pool != VK_NULL_HANDLE)
+    vkDestroyQueryPool(g_vulkan_context->GetDevice(), m_timestamp_query_pool, nullptr);
+}
 
 bool VKGfx::IsHeadless() const
 {
@@ -221,6 +225,83 @@ void VKGfx::WaitForGPUIdle()
   ExecuteCommandBuffer(false, true);
 }
 
+bool VKGfx::SupportsTimestampQueries() const
+{
+  return g_vulkan_context->SupportsTimestampQueries();
+}
+
+void VKGfx::ResetTimestampQueries(u32 first, u32 count)
+{
+  if (m_timestamp_query_pool == VK_NULL_HANDLE)
+  {
+    VkQueryPoolCreateInfo info = {
+        VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,  // VkStructureType                  sType
+        nullptr,                                   // const void*                      pNext
+        0,                                         // VkQueryPoolCreateFlags           flags
+        VK_QUERY_TYPE_TIMESTAMP,                   // VkQueryType                      queryType
+        TIMESTAMP_QUERY_COUNT,                     // uint32_t                         queryCount
+        0  // VkQueryPipelineStatisticFlags    pipelineStatistics;
+    };
+
+    VkResult res = vkCreateQueryPool(g_vulkan_context->GetDevice(), &info, nullptr,
+                                     &m_timestamp_query_pool);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkCreateQueryPool failed: ");
+      m_timestamp_query_pool = VK_NULL_HANDLE;
+      return;
+    }
+
+    m_timestamp_query_fences.resize(TIMESTAMP_QUERY_COUNT);
+  }
+
+  std::fill_n(m_timestamp_query_fences.begin() + first, count, 0);
+
+  // Can't be done within a render pass.
+  StateTracker::GetInstance()->EndRenderPass();
+  vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_timestamp_query_pool,
+                      first, count);
+}
+
+void VKGfx::WriteTimestampQuery(u32 index)
+{
+  if (m_timestamp_query_pool == VK_NULL_HANDLE)
+    return;
+
+  vkCmdWriteTimestamp(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_timestamp_query_pool, index);
+  m_timestamp_query_fences[index] = g_command_buffer_mgr->GetCurrentFenceCounter();
+}
+
+bool VKGfx::ReadTimestampQueries(u32 first, std::span<u64> results)
+{
+  if (m_timestamp_query_pool == VK_NULL_HANDLE || results.empty())
+    return false;
+
+  // Queries are written in order, so the command buffer which wrote the last one completed the
+  // reset and the other writes as well.
+  const u64 fence_counter = m_timestamp_query_fences[first + results.size() - 1];
+  if (fence_counter == 0 || !g_command_buffer_mgr->IsFenceCounterComplete(fence_counter))
+    return false;
+
+  VkResult res = vkGetQueryPoolResults(
+      g_vulkan_context->GetDevice(), m_timestamp_query_pool, first,
+      static_cast<u32>(results.size()), results.size_bytes(), results.data(), sizeof(u64),
+      VK_QUERY_RESULT_64_BIT);
+  if (res == VK_NOT_READY)
+    return false;
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+    return false;
+  }
+
+  const double period = g_vulkan_context->GetTimestampPeriod();
+  for (u64& result : results)
+    result = static_cast<u64>(result * period);
+  return true;
+}
+
 bool VKGfx::BindBackbuffer(const ClearColor& clear_color)
 {
   StateTracker::GetInstance()->EndRenderPass();
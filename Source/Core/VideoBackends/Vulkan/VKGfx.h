@@ -6,6 +6,7 @@
 #include <array>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
@@ -53,6 +54,11 @@ public:
 
   void Flush() override;
   void WaitForGPUIdle() override;
+
+  bool SupportsTimestampQueries() const override;
+  void ResetTimestampQueries(u32 first, u32 count) override;
+  void WriteTimestampQuery(u32 index) override;
+  bool ReadTimestampQueries(u32 first, std::span<u64> results) override;
   void OnConfigChanged(u32 bits) override;
 
   void ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_enable, bool alpha_enable,
@@ -97,6 +103,13 @@ private:
   std::unique_ptr<SwapChain> m_swap_chain;
   float m_backbuffer_scale;
 
+  // Only created once the GPU profiler is used
+  VkQueryPool m_timestamp_query_pool = VK_NULL_HANDLE;
+  // Fence counter of the command buffer which wrote each query, or 0 if it wasn't written since
+  // it was reset. Results are only read once that command buffer completed, as results from
+  // before the reset would still be returned until the reset has executed.
+  std::vector<u64> m_timestamp_query_fences;
+
   // Keep a copy of sampler states to avoid cache lookups every draw
   std::array<SamplerState, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> m_sampler_states = {};
 };
@@ -1009,6 +1009,11 @@ void VKStagingTexture::Flush()
   m_needs_flush = false;
 }
 
+bool VKStagingTexture::IsCopyComplete()
+{
+  return !m_needs_flush || g_command_buffer_mgr->IsFenceCounterComplete(m_flush_fence_counter);
+}
+
 VKFramebuffer::VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attachment,
                              std::vector<AbstractTexture*> additional_color_attachments, u32 width,
                              u32 height, u32 layers, u32 samples, VkFramebuffer fb,
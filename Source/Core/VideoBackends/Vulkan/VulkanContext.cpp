@@ -89,6 +89,7 @@ VulkanContext::PhysicalDeviceInfo::PhysicalDeviceInfo(VkPhysicalDevice device)
   framebufferDepthSampleCounts = properties.limits.framebufferDepthSampleCounts;
   memcpy(pointSizeRange, properties.limits.pointSizeRange, sizeof(pointSizeRange));
   maxSamplerAnisotropy = properties.limits.maxSamplerAnisotropy;
+  timestampPeriod = properties.limits.timestampPeriod;
 
   dualSrcBlend = features.dualSrcBlend != VK_FALSE;
   geometryShader = features.geometryShader != VK_FALSE;
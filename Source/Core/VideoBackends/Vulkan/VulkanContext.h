@@ -38,6 +38,7 @@ public:
     VkSampleCountFlags framebufferDepthSampleCounts;
     float pointSizeRange[2];
     float maxSamplerAnisotropy;
+    float timestampPeriod;
     u32 subgroupSize = 1;
     VkDriverId driverID = static_cast<VkDriverId>(0);
     bool dualSrcBlend;
@@ -106,6 +107,10 @@ public:
   // Support bits
   bool SupportsAnisotropicFiltering() const { return m_device_info.samplerAnisotropy; }
   bool SupportsPreciseOcclusionQueries() const { return m_device_info.occlusionQueryPrecise; }
+  bool SupportsTimestampQueries() const
+  {
+    return m_graphics_queue_properties.timestampValidBits != 0;
+  }
   u32 GetShaderSubgroupSize() const { return m_device_info.subgroupSize; }
   bool SupportsShaderSubgroupOperations() const { return m_device_info.shaderSubgroupOperations; }
 
@@ -116,6 +121,8 @@ public:
   }
   VkDeviceSize GetBufferImageGranularity() const { return m_device_info.bufferImageGranularity; }
   float GetMaxSamplerAnisotropy() const { return m_device_info.maxSamplerAnisotropy; }
+  // Nanoseconds per timestamp query tick
+  float GetTimestampPeriod() const { return m_device_info.timestampPeriod; }
 
   // Returns true if the specified extension is supported and enabled.
   bool SupportsDeviceExtension(const char* name) const;
@@ -10,6 +10,7 @@
 
 #include <array>
 #include <memory>
+#include <span>
 #include <vector>
 
 class AbstractFramebuffer;
@@ -146,6 +147,17 @@ public:
   virtual void Flush() {}
   virtual void WaitForGPUIdle() {}
 
+  // Timestamp queries, used by the GPU profiler. Each query records the time at which the GPU
+  // finished all of the commands issued before it. Queries are indexed from 0 to
+  // TIMESTAMP_QUERY_COUNT - 1, and must be reset before they are written again.
+  static constexpr u32 TIMESTAMP_QUERY_COUNT = 32768;
+  virtual bool SupportsTimestampQueries() const { return false; }
+  virtual void ResetTimestampQueries(u32 first, u32 count) {}
+  virtual void WriteTimestampQuery(u32 index) {}
+  // Reads the times of consecutive queries in nanoseconds, without waiting for the GPU.
+  // Returns false if the GPU hasn't finished writing all of them since they were last reset.
+  virtual bool ReadTimestampQueries(u32 first, std::span<u64> results) { return false; }
+
   // For opengl's glDrawBuffer
   virtual void SelectLeftBuffer() {}
   virtual void SelectRightBuffer() {}
@@ -67,6 +67,10 @@ public:
   // call to CopyFromTexture()/CopyToTexture() and the Flush() call.
   virtual void Flush() = 0;
 
+  // Returns true if the last copy has completed, so that Flush() won't wait for the GPU. Never
+  // submits or waits for GPU work itself.
+  virtual bool IsCopyComplete() { return !m_needs_flush; }
+
   // Reads the specified rectangle from the staging texture to out_ptr, with the specified stride
   // (length in bytes of each row). CopyFromTexture must be called first. The contents of any
   // texels outside of the rectangle used for CopyFromTexture is undefined.
@@ -3,7 +3,16 @@
 
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 
+#include <algorithm>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/Config/Config.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Thread.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "VideoCommon/Assets/CustomAssetLibrary.h"
 
 namespace VideoCommon
@@ -12,11 +21,21 @@ void CustomAssetLoader::Init()
 {
   m_asset_monitor_thread_shutdown.Clear();
 
-  const size_t sys_mem = Common::MemPhysical();
-  const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
-  // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
-  m_max_memory_available =
-      (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+  // Without a configured budget, one based on the system memory is used
+  const int memory_budget_mb = Config::Get(Config::GFX_CUSTOM_TEXTURE_MEMORY_BUDGET_MB);
+  if (memory_budget_mb > 0)
+  {
+    m_max_memory_available = static_cast<size_t>(memory_budget_mb) * 1024 * 1024;
+  }
+  else
+  {
+    const size_t sys_mem = Common::MemPhysical();
+    const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
+    // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other
+    // cases
+    m_max_memory_available =
+        (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+  }
 
   m_asset_monitor_thread = std::thread([this]() {
     Common::SetCurrentThreadName("Asset monitor");
@@ -32,51 +51,188 @@ void CustomAssetLoader::Init()
       std::lock_guard lk(m_asset_load_lock);
       for (auto& [asset_id, asset_to_monitor] : m_assets_to_monitor)
       {
-        if (auto ptr = asset_to_monitor.lock())
+        if (auto ptr = asset_to_monitor.lock(); ptr && !m_assets_being_loaded.contains(ptr.get()))
         {
           const auto write_time = ptr->GetLastWriteTime();
           if (write_time > ptr->GetLastLoadedTime())
           {
+            const std::size_t previous_memory_size = ptr->GetByteSizeInMemory();
             (void)ptr->Load();
+            m_total_bytes_loaded += ptr->GetByteSizeInMemory() - previous_memory_size;
           }
         }
       }
     }
   });
 
-  m_asset_load_thread.Reset("Custom Asset Loader", [this](std::weak_ptr<CustomAsset> asset) {
-    if (auto ptr = asset.lock())
-    {
-      if (m_memory_exceeded)
-        return;
-
-      if (ptr->Load())
-      {
-        std::lock_guard lk(m_asset_load_lock);
-        const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
-        m_total_bytes_loaded += asset_memory_size;
-        m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
-        if (m_total_bytes_loaded > m_max_memory_available)
-        {
-          ERROR_LOG_FMT(VIDEO,
-                        "Asset memory exceeded with asset '{}', future assets won't load until "
-                        "memory is available.",
-                        ptr->GetAssetId());
-          m_memory_exceeded = true;
-        }
-      }
-    }
-  });
+  m_load_threads_exit = false;
+  const u32 num_load_threads = static_cast<u32>(std::clamp(cpu_info.num_cores / 2, 1, 4));
+  for (u32 i = 0; i < num_load_threads; ++i)
+    m_load_threads.emplace_back(&CustomAssetLoader::LoadThread, this, i);
 }
 
 void CustomAssetLoader ::Shutdown()
 {
-  m_asset_load_thread.Shutdown(true);
+  {
+    std::lock_guard lk(m_load_queue_lock);
+    m_load_threads_exit = true;
+  }
+  m_load_queue_cv.notify_all();
+  m_loads_done_cv.notify_all();
+  for (std::thread& thread : m_load_threads)
+    thread.join();
+  m_load_threads.clear();
+  for (auto& queue : m_load_queues)
+    queue.clear();
 
   m_asset_monitor_thread_shutdown.Set();
   m_asset_monitor_thread.join();
   m_assets_to_monitor.clear();
+  m_streamed_textures.clear();
   m_total_bytes_loaded = 0;
+  m_textures_unloaded = 0;
+  m_memory_exceeded = false;
+}
+
+void CustomAssetLoader::QueueLoad(LoadRequest request, LoadPriority priority)
+{
+  {
+    std::lock_guard lk(m_load_queue_lock);
+    m_load_queues[static_cast<size_t>(priority)].push_back(std::move(request));
+  }
+  m_load_queue_cv.notify_one();
+}
+
+bool CustomAssetLoader::AreLoadQueuesEmpty() const
+{
+  return std::ranges::all_of(m_load_queues, [](const auto& queue) { return queue.empty(); });
+}
+
+void CustomAssetLoader::WaitForLoads()
+{
+  std::unique_lock lk(m_load_queue_lock);
+  m_loads_done_cv.wait(
+      lk, [&] { return m_load_threads_exit || (m_active_loads == 0 && AreLoadQueuesEmpty()); });
+}
+
+void CustomAssetLoader::LoadThread(u32 index)
+{
+  Common::SetCurrentThreadName(fmt::format("Custom Asset Loader {}", index).c_str());
+
+  std::unique_lock lk(m_load_queue_lock);
+  while (true)
+  {
+    m_load_queue_cv.wait(lk, [&] { return m_load_threads_exit || !AreLoadQueuesEmpty(); });
+    if (m_load_threads_exit)
+      return;
+
+    // Take the oldest request with the highest priority
+    const auto queue = std::ranges::find_if(m_load_queues.rbegin(), m_load_queues.rend(),
+                                            [](const auto& q) { return !q.empty(); });
+    const auto priority =
+        static_cast<LoadPriority>(std::distance(queue, m_load_queues.rend()) - 1);
+    LoadRequest request = std::move(queue->front());
+    queue->pop_front();
+
+    ++m_active_loads;
+    lk.unlock();
+    LoadAsset(request, priority);
+    lk.lock();
+
+    if (--m_active_loads == 0 && AreLoadQueuesEmpty())
+      m_loads_done_cv.notify_all();
+  }
+}
+
+void CustomAssetLoader::LoadAsset(const LoadRequest& request, LoadPriority priority)
+{
+  auto ptr = request.asset.lock();
+  if (!ptr)
+    return;
+
+  const auto finish_streamed_load = [&](bool failed) {
+    if (!request.streamed)
+      return;
+    if (auto iter = m_streamed_textures.find(ptr->GetAssetId()); iter != m_streamed_textures.end())
+    {
+      iter->second.queued = false;
+      iter->second.failed = failed;
+    }
+  };
+
+  std::size_t previous_memory_size;
+  {
+    std::lock_guard lk(m_asset_load_lock);
+    // Streamed textures make space for themselves by unloading others, except for prefetches,
+    // which are loaded once they are used if there isn't any space left
+    const bool skip = request.streamed ?
+                          priority == LoadPriority::Prefetch &&
+                              m_total_bytes_loaded >= m_max_memory_available :
+                          m_memory_exceeded.load();
+    // The texture may also have been loaded by 'LoadGameTexture()' in the meantime, or still be
+    // loading on another thread
+    if (skip || (request.streamed && ptr->GetByteSizeInMemory() != 0) ||
+        !m_assets_being_loaded.insert(ptr.get()).second)
+    {
+      finish_streamed_load(false);
+      return;
+    }
+    previous_memory_size = ptr->GetByteSizeInMemory();
+  }
+
+  const bool loaded = ptr->Load();
+
+  std::lock_guard lk(m_asset_load_lock);
+  m_assets_being_loaded.erase(ptr.get());
+  finish_streamed_load(!loaded);
+  if (!loaded)
+    return;
+
+  // Nothing else unloads or reloads the asset while it is being loaded, so this is the only change
+  // to its size since it was last accounted for
+  m_total_bytes_loaded += ptr->GetByteSizeInMemory() - previous_memory_size;
+  m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
+  UnloadStreamedTextures(ptr.get());
+  if (m_total_bytes_loaded > m_max_memory_available && !m_memory_exceeded)
+  {
+    ERROR_LOG_FMT(VIDEO,
+                  "Asset memory exceeded with asset '{}', future assets won't load until "
+                  "memory is available.",
+                  ptr->GetAssetId());
+    m_memory_exceeded = true;
+  }
+}
+
+void CustomAssetLoader::UnloadStreamedTextures(const CustomAsset* keep)
+{
+  if (m_total_bytes_loaded <= m_max_memory_available)
+    return;
+
+  std::vector<std::pair<u64, std::shared_ptr<GameTextureAsset>>> candidates;
+  for (const auto& [asset_id, streamed] : m_streamed_textures)
+  {
+    auto ptr = streamed.asset.lock();
+    if (ptr && ptr.get() != keep && !m_assets_being_loaded.contains(ptr.get()) &&
+        ptr->GetByteSizeInMemory() != 0)
+      candidates.emplace_back(streamed.last_used, std::move(ptr));
+  }
+  std::ranges::sort(candidates, {}, &decltype(candidates)::value_type::first);
+
+  for (const auto& [last_used, ptr] : candidates)
+  {
+    m_total_bytes_loaded -= ptr->GetByteSizeInMemory();
+    m_assets_to_monitor.erase(ptr->GetAssetId());
+    ptr->Unload();
+    ++m_textures_unloaded;
+    if (m_total_bytes_loaded <= m_max_memory_available)
+      break;
+  }
+
+  if (m_memory_exceeded && m_total_bytes_loaded <= m_max_memory_available)
+  {
+    INFO_LOG_FMT(VIDEO, "Asset memory went below limit, new assets can begin loading.");
+    m_memory_exceeded = false;
+  }
 }
 
 std::shared_ptr<GameTextureAsset>
@@ -105,4 +261,33 @@ std::shared_ptr<MeshAsset> CustomAssetLoader::LoadMesh(const CustomAssetLibrary:
 {
   return LoadOrCreateAsset<MeshAsset>(asset_id, m_meshes, std::move(library));
 }
+
+std::shared_ptr<GameTextureAsset>
+CustomAssetLoader::StreamGameTexture(const CustomAssetLibrary::AssetID& asset_id,
+                                     std::shared_ptr<CustomAssetLibrary> library,
+                                     LoadPriority priority)
+{
+  bool created = false;
+  auto ptr = GetOrCreateAsset(asset_id, m_game_textures, std::move(library), &created);
+
+  std::lock_guard lk(m_asset_load_lock);
+  StreamedTexture& streamed = m_streamed_textures[asset_id];
+  streamed.asset = ptr;
+  // Prefetching a texture doesn't count as using it
+  if (priority != LoadPriority::Prefetch || created)
+    streamed.last_used = ++m_use_counter;
+
+  if (!streamed.queued && !streamed.failed && ptr->GetByteSizeInMemory() == 0)
+  {
+    streamed.queued = true;
+    QueueLoad(LoadRequest{ptr, true}, priority);
+  }
+  return ptr;
+}
+
+CustomAssetLoader::StreamingStats CustomAssetLoader::GetStreamingStats()
+{
+  std::lock_guard lk(m_asset_load_lock);
+  return StreamingStats{m_total_bytes_loaded, m_max_memory_available, m_textures_unloaded};
+}
 }  // namespace VideoCommon
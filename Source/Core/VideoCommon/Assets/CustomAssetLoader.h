@@ -3,15 +3,20 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
+#include <vector>
 
+#include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
-#include "Common/WorkQueueThread.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/MaterialAsset.h"
 #include "VideoCommon/Assets/MeshAsset.h"
@@ -25,6 +30,22 @@ namespace VideoCommon
 class CustomAssetLoader
 {
 public:
+  enum class LoadPriority
+  {
+    // Only loaded while the memory budget isn't exceeded
+    Prefetch,
+    Normal,
+    // Loaded before everything else, for small stand-ins of textures which are still loading
+    Preview,
+  };
+
+  struct StreamingStats
+  {
+    std::size_t bytes_loaded = 0;
+    std::size_t memory_budget = 0;
+    u64 textures_unloaded = 0;
+  };
+
   CustomAssetLoader() = default;
   ~CustomAssetLoader() = default;
   CustomAssetLoader(const CustomAssetLoader&) = delete;
@@ -52,13 +73,53 @@ public:
   std::shared_ptr<MeshAsset> LoadMesh(const CustomAssetLibrary::AssetID& asset_id,
                                       std::shared_ptr<CustomAssetLibrary> library);
 
+  // Like 'LoadGameTexture()', except that the data of streamed textures is unloaded again when
+  // the memory budget is exceeded, starting with the texture which was requested the longest time
+  // ago. Requesting a texture again marks it as used, and loads it again if it was unloaded
+  std::shared_ptr<GameTextureAsset> StreamGameTexture(const CustomAssetLibrary::AssetID& asset_id,
+                                                      std::shared_ptr<CustomAssetLibrary> library,
+                                                      LoadPriority priority = LoadPriority::Normal);
+
+  StreamingStats GetStreamingStats();
+
+  // Blocks until all queued loads have finished, or the loader is shut down
+  void WaitForLoads();
+
 private:
+  struct LoadRequest
+  {
+    std::weak_ptr<CustomAsset> asset;
+    bool streamed = false;
+  };
+
+  struct StreamedTexture
+  {
+    std::weak_ptr<GameTextureAsset> asset;
+    // The value of 'm_use_counter' when the texture was last requested
+    u64 last_used = 0;
+    bool queued = false;
+    bool failed = false;
+  };
+
   // TODO C++20: use a 'derived_from' concept against 'CustomAsset' when available
   template <typename AssetType>
   std::shared_ptr<AssetType>
   LoadOrCreateAsset(const CustomAssetLibrary::AssetID& asset_id,
                     std::map<CustomAssetLibrary::AssetID, std::weak_ptr<AssetType>>& asset_map,
                     std::shared_ptr<CustomAssetLibrary> library)
+  {
+    bool created = false;
+    auto ptr = GetOrCreateAsset(asset_id, asset_map, std::move(library), &created);
+    if (created)
+      QueueLoad(LoadRequest{ptr, false}, LoadPriority::Normal);
+    return ptr;
+  }
+
+  template <typename AssetType>
+  std::shared_ptr<AssetType>
+  GetOrCreateAsset(const CustomAssetLibrary::AssetID& asset_id,
+                   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<AssetType>>& asset_map,
+                   std::shared_ptr<CustomAssetLibrary> library, bool* created)
   {
     auto [it, inserted] = asset_map.try_emplace(asset_id);
     if (!inserted)
@@ -72,6 +133,11 @@ private:
         std::lock_guard lk(m_asset_load_lock);
         m_total_bytes_loaded -= a->GetByteSizeInMemory();
         m_assets_to_monitor.erase(a->GetAssetId());
+        if (auto iter = m_streamed_textures.find(a->GetAssetId());
+            iter != m_streamed_textures.end() && iter->second.asset.expired())
+        {
+          m_streamed_textures.erase(iter);
+        }
         if (m_max_memory_available >= m_total_bytes_loaded && m_memory_exceeded)
         {
           INFO_LOG_FMT(VIDEO, "Asset memory went below limit, new assets can begin loading.");
@@ -81,10 +147,20 @@ private:
       delete a;
     });
     it->second = ptr;
-    m_asset_load_thread.Push(it->second);
+    *created = true;
     return ptr;
   }
 
+  void QueueLoad(LoadRequest request, LoadPriority priority);
+  // Must be called with 'm_load_queue_lock' held
+  bool AreLoadQueuesEmpty() const;
+  void LoadThread(u32 index);
+  void LoadAsset(const LoadRequest& request, LoadPriority priority);
+
+  // Unloads streamed textures other than 'keep' until the memory budget isn't exceeded anymore.
+  // Must be called with 'm_asset_load_lock' held
+  void UnloadStreamedTextures(const CustomAsset* keep);
+
   static constexpr auto TIME_BETWEEN_ASSET_MONITOR_CHECKS = std::chrono::milliseconds{500};
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<GameTextureAsset>> m_game_textures;
@@ -100,9 +176,26 @@ private:
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<CustomAsset>> m_assets_to_monitor;
 
+  std::map<CustomAssetLibrary::AssetID, StreamedTexture> m_streamed_textures;
+  // Assets which a load thread is loading outside of 'm_asset_load_lock'. Their size is only
+  // accounted for once the load finishes, so nothing else may load or unload them in the meantime
+  std::set<const CustomAsset*> m_assets_being_loaded;
+  u64 m_use_counter = 0;
+  u64 m_textures_unloaded = 0;
+
   // Use a recursive mutex to handle the scenario where an asset goes out of scope while
   // iterating over the assets to monitor which calls the lock above in 'LoadOrCreateAsset'
   std::recursive_mutex m_asset_load_lock;
-  Common::WorkQueueThread<std::weak_ptr<CustomAsset>> m_asset_load_thread;
+
+  // Decoding PNGs is slow, so assets are loaded on several threads. The queues are indexed by
+  // priority
+  std::vector<std::thread> m_load_threads;
+  std::mutex m_load_queue_lock;
+  std::condition_variable m_load_queue_cv;
+  std::array<std::deque<LoadRequest>, 3> m_load_queues;
+  bool m_load_threads_exit = false;
+  // Notified whenever the queues are empty and no thread is loading anymore
+  std::condition_variable m_loads_done_cv;
+  u32 m_active_loads = 0;
 };
 }  // namespace VideoCommon
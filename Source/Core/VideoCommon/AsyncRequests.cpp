@@ -157,7 +157,8 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 
   case Event::SWAP_EVENT:
     g_presenter->ViSwap(e.swap_event.xfbAddr, e.swap_event.fbWidth, e.swap_event.fbStride,
-                        e.swap_event.fbHeight, e.time);
+                        e.swap_event.fbHeight, e.time,
+                        TimePoint(DT(e.swap_event.output_time)));
     break;
 
   case Event::BBOX_READ:
@@ -55,6 +55,8 @@ public:
         u32 fbWidth;
         u32 fbStride;
         u32 fbHeight;
+        // Real time when the VI output the frame, as Clock ticks
+        DT::rep output_time;
       } swap_event;
 
       struct
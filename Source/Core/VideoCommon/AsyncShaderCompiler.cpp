@@ -3,6 +3,7 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <iterator>
 #include <thread>
 
 #include "Common/Assert.h"
@@ -56,10 +57,21 @@ void AsyncShaderCompiler::RetrieveWorkItems()
   }
 }
 
-bool AsyncShaderCompiler::HasPendingWork()
+bool AsyncShaderCompiler::HasPendingWork(u32 max_priority)
 {
   std::lock_guard<std::mutex> guard(m_pending_work_lock);
-  return !m_pending_work.empty() || m_busy_workers.load() != 0;
+  return (!m_pending_work.empty() && m_pending_work.begin()->first <= max_priority) ||
+         (!m_busy_work_priorities.empty() && *m_busy_work_priorities.begin() <= max_priority);
+}
+
+size_t AsyncShaderCompiler::CountPendingWork(u32 max_priority) const
+{
+  const auto count_up_to = [max_priority](const auto& container) {
+    return static_cast<size_t>(
+        std::distance(container.begin(), container.upper_bound(max_priority)));
+  };
+
+  return count_up_to(m_pending_work) + count_up_to(m_busy_work_priorities);
 }
 
 bool AsyncShaderCompiler::HasCompletedWork()
@@ -69,9 +81,9 @@ bool AsyncShaderCompiler::HasCompletedWork()
 }
 
 bool AsyncShaderCompiler::WaitUntilCompletion(
-    const std::function<void(size_t, size_t)>& progress_callback)
+    const std::function<void(size_t, size_t)>& progress_callback, u32 max_priority)
 {
-  if (!HasPendingWork())
+  if (!HasPendingWork(max_priority))
     return true;
 
   // Wait a second before opening a progress dialog.
@@ -81,7 +93,7 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   for (u32 i = 0; i < (1000 / CHECK_INTERVAL_MS); i++)
   {
     std::this_thread::sleep_for(std::chrono::milliseconds(CHECK_INTERVAL));
-    if (!HasPendingWork())
+    if (!HasPendingWork(max_priority))
       return true;
   }
 
@@ -91,7 +103,7 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
     // Safe to hold both locks here, since nowhere else does.
     std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
     std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-    total_items = m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
+    total_items = m_completed_work.size() + CountPendingWork(max_priority) + 1;
   }
 
   // Update progress while the compiles complete.
@@ -103,9 +115,9 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
     size_t remaining_items;
     {
       std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
-      if (m_pending_work.empty() && !m_busy_workers.load())
+      remaining_items = CountPendingWork(max_priority);
+      if (remaining_items == 0)
         break;
-      remaining_items = m_pending_work.size();
     }
 
     progress_callback(total_items - remaining_items, total_items);
@@ -219,12 +231,15 @@ void AsyncShaderCompiler::WorkerThreadRun()
   std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
   while (!m_exit_flag.IsSet())
   {
-    m_worker_thread_wake.wait(pending_lock);
+    // Work may have been left in the queue by a previous set of worker threads, e.g. after
+    // switching from the precompiling thread count, so only sleep when there is nothing to do.
+    m_worker_thread_wake.wait(pending_lock,
+                              [this] { return !m_pending_work.empty() || m_exit_flag.IsSet(); });
 
     while (!m_pending_work.empty() && !m_exit_flag.IsSet())
     {
-      m_busy_workers++;
       auto iter = m_pending_work.begin();
+      const auto busy_iter = m_busy_work_priorities.insert(iter->first);
       WorkItemPtr item(std::move(iter->second));
       m_pending_work.erase(iter);
       pending_lock.unlock();
@@ -236,7 +251,7 @@ void AsyncShaderCompiler::WorkerThreadRun()
       }
 
       pending_lock.lock();
-      m_busy_workers--;
+      m_busy_work_priorities.erase(busy_iter);
     }
   }
 }
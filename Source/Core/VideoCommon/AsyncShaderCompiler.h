@@ -7,9 +7,11 @@
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -46,12 +48,17 @@ public:
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
   void RetrieveWorkItems();
-  bool HasPendingWork();
+
+  // Returns true if any work item with a priority value of at most max_priority is queued or
+  // currently being compiled.
+  bool HasPendingWork(u32 max_priority = std::numeric_limits<u32>::max());
   bool HasCompletedWork();
 
   // Calls progress_callback periodically, with completed_items, and total_items.
-  // Returns false if interrupted.
-  bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback);
+  // Only work items with a priority value of at most max_priority are waited for, the remaining
+  // items continue to be compiled in the background. Returns false if interrupted.
+  bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback,
+                           u32 max_priority = std::numeric_limits<u32>::max());
 
   // Needed because of calling virtual methods in shutdown procedure.
   bool StartWorkerThreads(u32 num_worker_threads);
@@ -68,6 +75,10 @@ private:
   void WorkerThreadEntryPoint(void* param);
   void WorkerThreadRun();
 
+  // Number of queued and in-progress work items at or below max_priority.
+  // m_pending_work_lock must be held by the caller.
+  size_t CountPendingWork(u32 max_priority) const;
+
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
 
@@ -79,7 +90,9 @@ private:
   std::multimap<u32, WorkItemPtr> m_pending_work;
   std::mutex m_pending_work_lock;
   std::condition_variable m_worker_thread_wake;
-  std::atomic_size_t m_busy_workers{0};
+
+  // Priorities of the work items currently being compiled by the worker threads.
+  std::multiset<u32> m_busy_work_priorities;
 
   std::deque<WorkItemPtr> m_completed_work;
   std::mutex m_completed_work_lock;
@@ -599,6 +599,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
           auto& system = Core::System::GetInstance();
           auto& memory = system.GetMemory();
           memory.CopyFromEmu(s_tex_mem.data() + tmem_addr_even, src_addr, bytes_read);
+          g_texture_cache->OnTmemPreload(tmem_addr_even, bytes_read);
         }
       }
       else  // RGBA8 tiles (and CI14, but that might just be stupid libogc!)
@@ -9,6 +9,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 
 #include <algorithm>
@@ -33,6 +34,9 @@ void BoundingBox::Flush()
     return;
 
   m_is_valid = false;
+  m_is_speculative = false;
+  if (m_async_read_pending)
+    ++m_draws_since_async_read;
 
   if (std::ranges::none_of(m_dirty, std::identity{}))
     return;
@@ -60,16 +64,84 @@ void BoundingBox::Readback()
   if (!g_ActiveConfig.backend_info.bSupportsBBox)
     return;
 
-  auto read_values = Read(0, NUM_BBOX_VALUES);
+  INCSTAT(g_stats.this_frame.num_bbox_readback_stalls);
 
+  // This overwrites the results of any asynchronous read, which would be outdated anyways
+  m_async_read_pending = false;
+  m_speculated_values.reset();
+
+  const auto read_values = Read(0, NUM_BBOX_VALUES);
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  std::ranges::copy(read_values, values.begin());
+  SetReadValues(values);
+  m_last_read_values = values;
+}
+
+void BoundingBox::ReadbackAsync()
+{
+  if (m_async_read_pending)
+  {
+    if (const auto read_values = TryFinishAsyncRead())
+    {
+      m_async_read_pending = false;
+      m_last_read_values = *read_values;
+
+      if (m_speculated_values)
+      {
+        if (*m_speculated_values == *read_values)
+          INCSTAT(g_stats.this_frame.num_bbox_speculation_hits);
+        else
+          INCSTAT(g_stats.this_frame.num_bbox_speculation_misses);
+        m_speculated_values.reset();
+      }
+
+      if (m_draws_since_async_read == 0)
+      {
+        INCSTAT(g_stats.this_frame.num_bbox_reads_exact);
+        SetReadValues(*read_values);
+        return;
+      }
+    }
+  }
+
+  // The GPU hasn't caught up yet. Guess with the last values that were read back, which games
+  // that check the bounding box every frame usually get again, or failing that the estimate.
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  if (m_last_read_values)
+    values = *m_last_read_values;
+  else if (m_has_estimate)
+    values = m_estimate;
+  else
+  {
+    Readback();
+    return;
+  }
+
+  INCSTAT(g_stats.this_frame.num_bbox_reads_speculated);
+
+  if (!m_async_read_pending)
+  {
+    StartAsyncRead();
+    m_async_read_pending = true;
+    m_draws_since_async_read = 0;
+    m_speculated_values = values;
+  }
+
+  SetReadValues(values);
+  m_is_speculative = true;
+}
+
+void BoundingBox::SetReadValues(const std::array<BBoxType, NUM_BBOX_VALUES>& values)
+{
   // Preserve dirty values, that way we don't need to sync.
   for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
   {
     if (!m_dirty[i])
-      m_values[i] = read_values[i];
+      m_values[i] = values[i];
   }
 
   m_is_valid = true;
+  m_is_speculative = false;
 }
 
 u16 BoundingBox::Get(u32 index)
@@ -80,7 +152,12 @@ u16 BoundingBox::Get(u32 index)
     return m_bounding_box_fallback[index];
 
   if (!m_is_valid)
-    Readback();
+  {
+    if (g_ActiveConfig.bBBoxAsyncReadback && SupportsAsyncReadback())
+      ReadbackAsync();
+    else
+      Readback();
+  }
 
   return static_cast<u16>(m_values[index]);
 }
@@ -95,13 +172,25 @@ void BoundingBox::Set(u32 index, u16 value)
     return;
   }
 
-  if (m_is_valid && m_values[index] == value)
+  // The estimate restarts from the values the game resets the registers to
+  m_estimate[index] = value;
+  m_has_estimate = true;
+
+  if (m_is_valid && !m_is_speculative && m_values[index] == value)
     return;
 
   m_values[index] = value;
   m_dirty[index] = true;
 }
 
+void BoundingBox::ExtendEstimate(const MathUtil::Rectangle<int>& rect)
+{
+  m_estimate[0] = std::min(m_estimate[0], rect.left);
+  m_estimate[1] = std::max(m_estimate[1], rect.right);
+  m_estimate[2] = std::min(m_estimate[2], rect.top);
+  m_estimate[3] = std::max(m_estimate[3], rect.bottom);
+}
+
 // FIXME: This may not work correctly if we're in the middle of a draw.
 // We should probably ensure that state saves only happen on frame boundaries.
 // Nonetheless, it has been designed to be as safe as possible.
@@ -113,6 +202,15 @@ void BoundingBox::DoState(PointerWrap& p)
   p.DoArray(m_dirty);
   p.Do(m_is_valid);
 
+  if (p.IsReadMode())
+  {
+    m_is_speculative = false;
+    m_async_read_pending = false;
+    m_speculated_values.reset();
+    m_last_read_values.reset();
+    m_has_estimate = false;
+  }
+
   // We handle saving the backend values specially rather than using Readback() and Flush() so that
   // we don't mess up the current cache state
   std::vector<BBoxType> backend_values(NUM_BBOX_VALUES);
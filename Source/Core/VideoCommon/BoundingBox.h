@@ -5,10 +5,12 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <span>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
 
 class PixelShaderManager;
 class PointerWrap;
@@ -31,6 +33,12 @@ public:
   u16 Get(u32 index);
   void Set(u32 index, u16 value);
 
+  // Grows the CPU-side estimate of the current values to include the given EFB rectangle.
+  // Only used for speculation when asynchronous readback is enabled.
+  void ExtendEstimate(const MathUtil::Rectangle<int>& rect);
+  // The estimate is only used until the first values have been read back.
+  bool NeedsEstimate() const { return !m_last_read_values.has_value(); }
+
   void DoState(PointerWrap& p);
 
   // Initialize, Read, and Write are only safe to call if the backend supports bounding box,
@@ -41,8 +49,20 @@ protected:
   virtual std::vector<BBoxType> Read(u32 index, u32 length) = 0;
   virtual void Write(u32 index, std::span<const BBoxType> values) = 0;
 
+  // Asynchronous readback, for backends which can copy the values without waiting for the GPU.
+  // Only one read is in flight at a time. TryFinishAsyncRead returns nothing until the values
+  // from the last StartAsyncRead are available.
+  virtual bool SupportsAsyncReadback() const { return false; }
+  virtual void StartAsyncRead() {}
+  virtual std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> TryFinishAsyncRead()
+  {
+    return std::nullopt;
+  }
+
 private:
   void Readback();
+  void ReadbackAsync();
+  void SetReadValues(const std::array<BBoxType, NUM_BBOX_VALUES>& values);
 
   bool m_is_active = false;
 
@@ -50,6 +70,21 @@ private:
   std::array<bool, NUM_BBOX_VALUES> m_dirty = {};
   bool m_is_valid = true;
 
+  // Set while m_values holds guessed values, which must not be used to skip writes
+  bool m_is_speculative = false;
+
+  // State of the asynchronous readback. Results are exact as long as nothing has been drawn
+  // since the read was started.
+  bool m_async_read_pending = false;
+  u32 m_draws_since_async_read = 0;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> m_speculated_values;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> m_last_read_values;
+
+  // Conservative estimate from the screen bounds of the vertices drawn since the values were
+  // last set, used when no earlier readback is available
+  std::array<BBoxType, NUM_BBOX_VALUES> m_estimate = {};
+  bool m_has_estimate = false;
+
   // Nintendo's SDK seems to write "default" bounding box values before every draw (1023 0 1023 0
   // are the only values encountered so far, which happen to be the extents allowed by the BP
   // registers) to reset the registers for comparison in the pixel engine, and presumably to detect
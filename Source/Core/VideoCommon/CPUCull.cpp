@@ -3,6 +3,9 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -12,6 +15,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStateManager.h"
@@ -142,6 +146,66 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
 {
   ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
              "CPUCull should not be called on lines or points");
+
+  static constexpr Common::EnumMap<CullMode, CullMode::All> cullmode_invert = {
+      CullMode::None, CullMode::Front, CullMode::Back, CullMode::All};
+
+  CullMode cullmode = bpmem.genMode.cullmode;
+  if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
+    cullmode = cullmode_invert[cullmode];
+  const TransformedVertex* vertices = TransformVertices(loader, src, count);
+  const CullFunction cull = m_cull_table[primitive][cullmode];
+  return cull(vertices, count);
+}
+
+MathUtil::Rectangle<int> CPUCull::GetScreenBounds(VertexLoaderBase* loader,
+                                                  OpcodeDecoder::Primitive primitive,
+                                                  const u8* src, u32 count)
+{
+  const MathUtil::Rectangle<int> efb_rect(0, 0, EFB_WIDTH - 1, EFB_HEIGHT - 1);
+  const TransformedVertex* vertices = TransformVertices(loader, src, count);
+
+  float left = std::numeric_limits<float>::max();
+  float right = std::numeric_limits<float>::lowest();
+  float top = std::numeric_limits<float>::max();
+  float bottom = std::numeric_limits<float>::lowest();
+  for (u32 i = 0; i < count; i++)
+  {
+    const TransformedVertex& vertex = vertices[i];
+    // Clipping against the near plane could put the primitive anywhere on screen
+    if (!(vertex.w > 0.0f))
+      return efb_rect;
+
+    // Same as the viewport transform in videosoftware Clipper.cpp:PerspectiveDivide
+    const float x = vertex.x / vertex.w * xfmem.viewport.wd + xfmem.viewport.xOrig;
+    const float y = vertex.y / vertex.w * xfmem.viewport.ht + xfmem.viewport.yOrig;
+    left = std::min(left, x);
+    right = std::max(right, x);
+    top = std::min(top, y);
+    bottom = std::max(bottom, y);
+  }
+
+  // Lines and points are widened around their vertices (sizes are in 1/6th pixels)
+  float padding = 1.0f;
+  if (primitive == OpcodeDecoder::Primitive::GX_DRAW_POINTS)
+    padding += bpmem.lineptwidth.pointsize / 12.0f;
+  else if (primitive >= OpcodeDecoder::Primitive::GX_DRAW_LINES)
+    padding += bpmem.lineptwidth.linesize / 12.0f;
+
+  const float x_offset = bpmem.scissorOffset.x * 2;
+  const float y_offset = bpmem.scissorOffset.y * 2;
+  const auto to_efb = [](float value, int max) {
+    return static_cast<int>(std::clamp(value, 0.0f, static_cast<float>(max)));
+  };
+  return MathUtil::Rectangle<int>(to_efb(left - padding - x_offset, efb_rect.right),
+                                  to_efb(top - padding - y_offset, efb_rect.bottom),
+                                  to_efb(right + padding - x_offset, efb_rect.right),
+                                  to_efb(bottom + padding - y_offset, efb_rect.bottom));
+}
+
+const CPUCull::TransformedVertex* CPUCull::TransformVertices(VertexLoaderBase* loader,
+                                                             const u8* src, u32 count)
+{
   const u32 stride = loader->m_native_vtx_decl.stride;
   const bool posHas3Elems = loader->m_native_vtx_decl.position.components >= 3;
   const bool perVertexPosMtx = loader->m_native_vtx_decl.posmtx.enable;
@@ -157,16 +221,9 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   auto& system = Core::System::GetInstance();
   system.GetVertexShaderManager().SetProjectionMatrix(system.GetXFStateManager());
 
-  static constexpr Common::EnumMap<CullMode, CullMode::All> cullmode_invert = {
-      CullMode::None, CullMode::Front, CullMode::Back, CullMode::All};
-
-  CullMode cullmode = bpmem.genMode.cullmode;
-  if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
-    cullmode = cullmode_invert[cullmode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
   transform(m_transform_buffer.get(), src, stride, count);
-  const CullFunction cull = m_cull_table[primitive][cullmode];
-  return cull(m_transform_buffer.get(), count);
+  return m_transform_buffer.get();
 }
 
 template <typename T>
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "Common/MathUtil.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -14,6 +15,11 @@ public:
   void Init();
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
+  // Returns the EFB rectangle covered by the vertices, for estimating the bounding box.
+  // Vertices behind the camera make this cover the whole EFB.
+  MathUtil::Rectangle<int> GetScreenBounds(VertexLoaderBase* loader,
+                                           OpcodeDecoder::Primitive primitive, const u8* src,
+                                           u32 count);
 
   struct alignas(16) TransformedVertex
   {
@@ -24,6 +30,8 @@ public:
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
 
 private:
+  const TransformedVertex* TransformVertices(VertexLoaderBase* loader, const u8* src, u32 count);
+
   template <typename T>
   struct BufferDeleter
   {
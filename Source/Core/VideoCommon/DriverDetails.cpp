@@ -5,6 +5,7 @@
 
 #include <map>
 
+#include "Common/Hash.h"
 #include "Common/Logging/LogManager.h"
 #include "Core/DolphinAnalytics.h"
 
@@ -222,6 +223,30 @@ bool HasBug(Bug bug)
   return it->second.m_hasbug;
 }
 
+u32 GetFingerprint()
+{
+  u32 crc = Common::StartCRC32();
+  const auto update = [&crc](const auto& value) {
+    crc = Common::UpdateCRC32(crc, reinterpret_cast<const u8*>(&value), sizeof(value));
+  };
+
+  update(m_api);
+  update(m_vendor);
+  update(m_driver);
+  update(m_family);
+  update(m_version);
+  crc = Common::UpdateCRC32(crc, reinterpret_cast<const u8*>(m_name.data()), m_name.size());
+
+  // Bugs can be overridden, and change the generated shaders.
+  for (const auto& [bug, info] : m_bugs)
+  {
+    update(bug);
+    update(info.m_hasbug);
+  }
+
+  return crc;
+}
+
 #ifdef __clang__
 // Make sure we handle all these switch cases
 #pragma clang diagnostic error "-Wswitch"
@@ -355,4 +355,8 @@ bool HasBug(Bug bug);
 
 // Overrides the current state of a bug
 void OverrideBug(Bug bug, bool new_value);
+
+// Returns a hash of the current driver and its bugs, which identifies the driver for the purpose
+// of reusing shaders generated and compiled for it.
+u32 GetFingerprint();
 }  // namespace DriverDetails
@@ -13,6 +13,7 @@
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Trace.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -292,6 +293,8 @@ void FifoManager::RunGpuLoop()
 
   m_gpu_mainloop.Run(
       [this] {
+        TRACE_SCOPE("RunGpuLoop");
+
         // Run events from the CPU thread.
         AsyncRequests::GetInstance()->PullEvents();
 
@@ -158,6 +158,61 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+void ConvertFrame(FrameDumpContext* context, const FrameData& frame, AVPixelFormat src_pix_fmt)
+{
+#if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 4, 100)
+  // The conversion is split into slices which are converted on a thread each. Only the newer API
+  // of libswscale is threaded.
+  if (!context->sws)
+  {
+    context->sws = sws_alloc_context();
+    if (!context->sws)
+      return;
+
+    av_opt_set_int(context->sws, "srcw", frame.width, 0);
+    av_opt_set_int(context->sws, "srch", frame.height, 0);
+    av_opt_set_pixel_fmt(context->sws, "src_format", src_pix_fmt, 0);
+    av_opt_set_int(context->sws, "dstw", context->width, 0);
+    av_opt_set_int(context->sws, "dsth", context->height, 0);
+    av_opt_set_pixel_fmt(context->sws, "dst_format", context->codec->pix_fmt, 0);
+    av_opt_set_int(context->sws, "sws_flags", SWS_BICUBIC, 0);
+    av_opt_set_int(context->sws, "threads", 0, 0);
+    if (sws_init_context(context->sws, nullptr, nullptr) < 0)
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Could not initialize the {}x{} color conversion", frame.width,
+                    frame.height);
+      sws_freeContext(context->sws);
+      context->sws = nullptr;
+      return;
+    }
+  }
+
+  // libswscale references the source frame, which would copy it if it wasn't reference counted.
+  // The frame data stays valid until this returns, so it is wrapped without taking ownership.
+  context->src_frame->buf[0] =
+      av_buffer_create(const_cast<u8*>(frame.data), frame.stride * frame.height,
+                       [](void*, u8*) {}, nullptr, AV_BUFFER_FLAG_READONLY);
+  if (!context->src_frame->buf[0])
+    return;
+
+  if (const int error = sws_scale_frame(context->sws, context->scaled_frame, context->src_frame);
+      error < 0)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Error while converting video: {}", AVErrorString(error));
+  }
+  av_buffer_unref(&context->src_frame->buf[0]);
+#else
+  context->sws = sws_getCachedContext(context->sws, frame.width, frame.height, src_pix_fmt,
+                                      context->width, context->height, context->codec->pix_fmt,
+                                      SWS_BICUBIC, nullptr, nullptr, nullptr);
+  if (context->sws)
+  {
+    sws_scale(context->sws, context->src_frame->data, context->src_frame->linesize, 0,
+              frame.height, context->scaled_frame->data, context->scaled_frame->linesize);
+  }
+#endif
+}
+
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -265,6 +320,11 @@ bool FFMpegFrameDump::CreateVideoFile()
   m_context->codec->gop_size = 1;
   m_context->codec->level = 1;
 
+  // Let the encoder pick a thread count for the CPU. Frame threading delays the output by a few
+  // frames, which is flushed when the dump stops.
+  m_context->codec->thread_count = 0;
+  m_context->codec->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
   AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
 
   const std::string& pixel_format_string = g_Config.sDumpPixelFormat;
@@ -298,6 +358,7 @@ bool FFMpegFrameDump::CreateVideoFile()
     ERROR_LOG_FMT(FRAMEDUMP, "Could not open codec");
     return false;
   }
+  INFO_LOG_FMT(FRAMEDUMP, "Encoding with {} thread(s)", m_context->codec->thread_count);
 
   m_context->src_frame = av_frame_alloc();
   m_context->scaled_frame = av_frame_alloc();
@@ -384,16 +445,16 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   m_context->src_frame->width = m_context->width;
   m_context->src_frame->height = m_context->height;
 
-  // Convert image from RGBA to desired pixel format.
-  m_context->sws = sws_getCachedContext(
-      m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
-  if (m_context->sws)
+  // The encoder may still hold a reference to the previous frame when it is threaded.
+  if (const int error = av_frame_make_writable(m_context->scaled_frame))
   {
-    sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
-              frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not make frame writable: {}", AVErrorString(error));
+    return;
   }
 
+  // Convert image from RGBA to desired pixel format.
+  ConvertFrame(m_context.get(), frame, pix_fmt);
+
   m_context->last_pts = pts;
   m_context->scaled_frame->pts = pts;
 
@@ -3,6 +3,10 @@
 
 #include "VideoCommon/FrameDumper.h"
 
+#include <utility>
+
+#include <fmt/format.h>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/Image.h"
@@ -21,6 +25,10 @@
 // The video encoder needs the image to be a multiple of x samples.
 static constexpr int VIDEO_ENCODER_LCM = 4;
 
+// Number of frames which can be queued for the dump thread before the video thread waits for it.
+// Each one holds a readback texture at the dump resolution.
+static constexpr size_t MAX_QUEUED_FRAMES = 4;
+
 static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
 {
   return Common::ConvertRGBAToRGBAndSavePNG(file_name, frame.data, frame.width, frame.height,
@@ -106,6 +114,19 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
     return true;
 
   rbtex.reset();
+
+  // Reuse a texture of a dumped frame. Textures of another size are released.
+  while (!m_frame_dump_free_textures.empty())
+  {
+    std::unique_ptr<AbstractStagingTexture> texture = std::move(m_frame_dump_free_textures.back());
+    m_frame_dump_free_textures.pop_back();
+    if (texture->GetWidth() == target_width && texture->GetHeight() == target_height)
+    {
+      rbtex = std::move(texture);
+      return true;
+    }
+  }
+
   rbtex = g_gfx->CreateStagingTexture(StagingTextureType::Readback,
                                       TextureConfig(target_width, target_height, 1, 1, 1,
                                                     AbstractTextureFormat::RGBA8, 0,
@@ -121,25 +142,37 @@ void FrameDumper::FlushFrameDump()
   if (!m_frame_dump_needs_flush)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
+  ReclaimDumpedFrames();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  // Wait for the dump thread if it is behind by the whole queue.
+  if (m_frame_dump_queued_textures.size() >= MAX_QUEUED_FRAMES)
+  {
+    const auto stall_start = std::chrono::steady_clock::now();
+    while (m_frame_dump_queued_textures.size() >= MAX_QUEUED_FRAMES)
+    {
+      m_frame_dump_done.Wait();
+      ReclaimDumpedFrames();
+    }
+    m_frame_dump_stats.frames_stalled++;
+    m_frame_dump_stats.stall_time += std::chrono::steady_clock::now() - stall_start;
+  }
 
   // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
+  std::unique_ptr<AbstractStagingTexture> texture = std::move(m_frame_dump_readback_texture);
+  texture->Flush();
+  if (texture->Map())
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    DumpFrameData(std::move(texture));
   }
   else
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    m_frame_dump_stats.frames_dropped++;
+    m_frame_dump_free_textures.push_back(std::move(texture));
   }
 
   m_frame_dump_needs_flush = false;
+  ShowFrameDumpStats(false);
 
   // Shutdown frame dumping if it is no longer active.
   if (!IsFrameDumping())
@@ -154,7 +187,7 @@ void FrameDumper::ShutdownFrameDumping()
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
+  // Ensure previous frames have been encoded.
   FinishFrameData();
 
   // Wake thread up, and wait for it to exit.
@@ -166,35 +199,83 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_texture.reset();
 
   m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  m_frame_dump_free_textures.clear();
+
+  ShowFrameDumpStats(true);
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(std::unique_ptr<AbstractStagingTexture> texture)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  const FrameData frame{reinterpret_cast<const u8*>(texture->GetMappedPointer()),
+                        static_cast<int>(texture->GetConfig().width),
+                        static_cast<int>(texture->GetConfig().height),
+                        static_cast<int>(texture->GetMappedStride()), m_last_frame_state};
+  {
+    std::lock_guard lk(m_frame_dump_queue_lock);
+    m_frame_dump_queue.push_back(frame);
+  }
+  m_frame_dump_queued_textures.push_back(std::move(texture));
 
   if (!m_frame_dump_thread_running.IsSet())
   {
     if (m_frame_dump_thread.joinable())
       m_frame_dump_thread.join();
+    m_frame_dump_stats = {};
+    m_reported_frame_dump_stats = {};
     m_frame_dump_thread_running.Set();
     m_frame_dump_thread = std::thread(&FrameDumper::FrameDumpThreadFunc, this);
   }
 
   // Wake worker thread up.
   m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
+}
+
+void FrameDumper::ReclaimDumpedFrames()
+{
+  const u64 frames_dumped = m_frames_dumped.load(std::memory_order_acquire);
+  for (; m_frames_reclaimed < frames_dumped; ++m_frames_reclaimed)
+  {
+    std::unique_ptr<AbstractStagingTexture> texture =
+        std::move(m_frame_dump_queued_textures.front());
+    m_frame_dump_queued_textures.pop_front();
+    texture->Unmap();
+    m_frame_dump_free_textures.push_back(std::move(texture));
+  }
 }
 
 void FrameDumper::FinishFrameData()
 {
-  if (!m_frame_dump_frame_running)
-    return;
+  ReclaimDumpedFrames();
+  while (!m_frame_dump_queued_textures.empty())
+  {
+    m_frame_dump_done.Wait();
+    ReclaimDumpedFrames();
+  }
+}
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+void FrameDumper::ShowFrameDumpStats(bool force)
+{
+  // Only frames which had to wait or were lost are reported, at most once a second.
+  const auto now = std::chrono::steady_clock::now();
+  if (m_frame_dump_stats.frames_stalled == m_reported_frame_dump_stats.frames_stalled &&
+      m_frame_dump_stats.frames_dropped == m_reported_frame_dump_stats.frames_dropped)
+  {
+    return;
+  }
+  if (!force && now - m_last_frame_dump_stats_report < std::chrono::seconds(1))
+    return;
 
-  m_frame_dump_output_texture->Unmap();
+  OSD::AddTypedMessage(
+      OSD::MessageType::FrameDumpStats,
+      fmt::format("Frame dump: {} frame(s) waited for the encoder ({} ms), {} frame(s) dropped",
+                  m_frame_dump_stats.frames_stalled,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                      m_frame_dump_stats.stall_time)
+                      .count(),
+                  m_frame_dump_stats.frames_dropped),
+      OSD::Duration::NORMAL);
+  m_reported_frame_dump_stats = m_frame_dump_stats;
+  m_last_frame_dump_stats_report = now;
 }
 
 void FrameDumper::FrameDumpThreadFunc()
@@ -220,46 +301,57 @@ void FrameDumper::FrameDumpThreadFunc()
     if (!m_frame_dump_thread_running.IsSet())
       break;
 
-    auto frame = m_frame_dump_data;
-
-    // Save screenshot
-    if (m_screenshot_request.TestAndClear())
+    while (true)
     {
-      std::lock_guard<std::mutex> lk(m_screenshot_lock);
-
-      if (DumpFrameToPNG(frame, m_screenshot_name))
-        OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
-
-      // Reset settings
-      m_screenshot_name.clear();
-      m_screenshot_completed.Set();
-    }
+      FrameData frame;
+      {
+        std::lock_guard lk(m_frame_dump_queue_lock);
+        if (m_frame_dump_queue.empty())
+          break;
+        frame = m_frame_dump_queue.front();
+        m_frame_dump_queue.pop_front();
+      }
 
-    if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
-    {
-      if (!frame_dump_started)
+      // Save screenshot
+      if (m_screenshot_request.TestAndClear())
       {
-        if (dump_to_ffmpeg)
-          frame_dump_started = StartFrameDumpToFFMPEG(frame);
-        else
-          frame_dump_started = StartFrameDumpToImage(frame);
+        std::lock_guard<std::mutex> lk(m_screenshot_lock);
 
-        // Stop frame dumping if we fail to start.
-        if (!frame_dump_started)
-          Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+        if (DumpFrameToPNG(frame, m_screenshot_name))
+          OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+
+        // Reset settings
+        m_screenshot_name.clear();
+        m_screenshot_completed.Set();
       }
 
-      // If we failed to start frame dumping, don't write a frame.
-      if (frame_dump_started)
+      if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
       {
-        if (dump_to_ffmpeg)
-          DumpFrameToFFMPEG(frame);
-        else
-          DumpFrameToImage(frame);
+        if (!frame_dump_started)
+        {
+          if (dump_to_ffmpeg)
+            frame_dump_started = StartFrameDumpToFFMPEG(frame);
+          else
+            frame_dump_started = StartFrameDumpToImage(frame);
+
+          // Stop frame dumping if we fail to start.
+          if (!frame_dump_started)
+            Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+        }
+
+        // If we failed to start frame dumping, don't write a frame.
+        if (frame_dump_started)
+        {
+          if (dump_to_ffmpeg)
+            DumpFrameToFFMPEG(frame);
+          else
+            DumpFrameToImage(frame);
+        }
       }
-    }
 
-    m_frame_dump_done.Set();
+      m_frames_dumped.fetch_add(1, std::memory_order_release);
+      m_frame_dump_done.Set();
+    }
   }
 
   if (frame_dump_started)
@@ -3,6 +3,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -55,12 +64,17 @@ private:
   // Checks that the frame dump readback texture exists and is the correct size.
   bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
 
-  // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  // Asynchronously encodes the frame in the specified mapped texture to the frame dump.
+  void DumpFrameData(std::unique_ptr<AbstractStagingTexture> texture);
+
+  // Unmaps the textures of the frames the dumping thread is done with, so they can be reused.
+  void ReclaimDumpedFrames();
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
 
+  void ShowFrameDumpStats(bool force);
+
   std::thread m_frame_dump_thread;
   Common::Flag m_frame_dump_thread_running;
 
@@ -73,20 +87,36 @@ private:
   // Holds emulation state during the last swap when dumping.
   FrameState m_last_frame_state;
 
-  // Communication of frame between video and dump threads.
-  FrameData m_frame_dump_data;
+  // Communication of frames between video and dump threads. The dump thread processes them in
+  // order and counts the frames it is done with.
+  std::mutex m_frame_dump_queue_lock;
+  std::deque<FrameData> m_frame_dump_queue;
+  std::atomic<u64> m_frames_dumped = 0;
 
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
+  // Frames are read back into a ring of staging textures. The video thread only waits for the
+  // dump thread when the textures of all queued frames are still mapped.
   std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
+  // Mapped textures of the frames queued for the dump thread, oldest first.
+  std::deque<std::unique_ptr<AbstractStagingTexture>> m_frame_dump_queued_textures;
+  std::vector<std::unique_ptr<AbstractStagingTexture>> m_frame_dump_free_textures;
+  u64 m_frames_reclaimed = 0;
   // Set when readback texture holds a frame that needs to be dumped.
   bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+
+  // Reported in the OSD while dumping, and reset when the dump thread starts.
+  struct FrameDumpStats
+  {
+    u32 frames_stalled = 0;
+    std::chrono::nanoseconds stall_time{};
+    u32 frames_dropped = 0;
+  };
+  FrameDumpStats m_frame_dump_stats;
+  FrameDumpStats m_reported_frame_dump_stats;
+  std::chrono::steady_clock::time_point m_last_frame_dump_stats_report;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
@@ -0,0 +1,124 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FramePacing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+
+namespace
+{
+// Nearest-rank percentiles. Reorders the values.
+FramePacingTracker::Percentiles GetPercentiles(std::vector<DT>& values)
+{
+  if (values.empty())
+    return {};
+
+  const auto get_rank = [&values](double percentile) {
+    const auto rank = static_cast<size_t>(std::ceil(percentile * values.size()));
+    return values.begin() + (std::max<size_t>(rank, 1) - 1);
+  };
+
+  // Each nth_element partitions the range, so the lower percentiles only need to look at the
+  // values below the previous one.
+  FramePacingTracker::Percentiles result;
+  const auto p99 = get_rank(0.99);
+  std::nth_element(values.begin(), p99, values.end());
+  result.p99 = *p99;
+  const auto p95 = get_rank(0.95);
+  std::nth_element(values.begin(), p95, p99);
+  result.p95 = *p95;
+  const auto p50 = get_rank(0.50);
+  std::nth_element(values.begin(), p50, p95);
+  result.p50 = *p50;
+  return result;
+}
+}  // namespace
+
+void FramePacingTracker::Reset()
+{
+  std::lock_guard lk(m_mutex);
+  m_num_frames = 0;
+}
+
+void FramePacingTracker::AddFrame(const FrameTiming& timing)
+{
+  std::lock_guard lk(m_mutex);
+  m_frames[m_num_frames % MAX_FRAMES] = timing;
+  m_num_frames++;
+}
+
+FramePacingTracker::Summary FramePacingTracker::GetSummary() const
+{
+  std::vector<DT> frame_times;
+  std::vector<DT> latencies;
+  {
+    std::lock_guard lk(m_mutex);
+    const u64 first_frame = m_num_frames - std::min<u64>(m_num_frames, MAX_FRAMES);
+    frame_times.reserve(m_num_frames - first_frame);
+    latencies.reserve(m_num_frames - first_frame);
+    for (u64 i = first_frame; i < m_num_frames; i++)
+    {
+      const FrameTiming& frame = m_frames[i % MAX_FRAMES];
+      latencies.push_back(frame.present_return - frame.cpu_finish);
+      if (i != first_frame)
+        frame_times.push_back(frame.present_return - m_frames[(i - 1) % MAX_FRAMES].present_return);
+    }
+  }
+
+  Summary summary;
+  summary.num_frames = latencies.size();
+  summary.frame_time = GetPercentiles(frame_times);
+  summary.latency = GetPercentiles(latencies);
+  return summary;
+}
+
+bool FramePacingTracker::WriteCSV(const std::string& path) const
+{
+  // Copy the frames out first so that presenting isn't held up by the file writes
+  std::vector<FrameTiming> frames;
+  u64 first_frame;
+  {
+    std::lock_guard lk(m_mutex);
+    first_frame = m_num_frames - std::min<u64>(m_num_frames, MAX_FRAMES);
+    frames.reserve(m_num_frames - first_frame);
+    for (u64 i = first_frame; i < m_num_frames; i++)
+      frames.push_back(m_frames[i % MAX_FRAMES]);
+  }
+
+  if (!File::CreateFullPath(path))
+    return false;
+
+  File::IOFile file(path, "w");
+  if (!file)
+    return false;
+
+  file.WriteString("frame,emulated_time_ms,cpu_finish_ms,gpu_submit_ms,present_call_ms,"
+                   "present_return_ms,frame_time_ms,latency_ms\n");
+
+  const auto to_ms = [](DT dt) { return DT_ms(dt).count(); };
+  for (size_t i = 0; i < frames.size(); i++)
+  {
+    const FrameTiming& frame = frames[i];
+    const FrameTiming& first = frames.front();
+    const TimePoint start = first.cpu_finish;
+    const std::string frame_time =
+        i != 0 ? fmt::format("{:.3f}", to_ms(frame.present_return - frames[i - 1].present_return)) :
+                 std::string();
+
+    file.WriteString(fmt::format("{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{},{:.3f}\n",
+                                 first_frame + i, to_ms(frame.emulated_time - first.emulated_time),
+                                 to_ms(frame.cpu_finish - start), to_ms(frame.gpu_submit - start),
+                                 to_ms(frame.present_call - start),
+                                 to_ms(frame.present_return - start), frame_time,
+                                 to_ms(frame.present_return - frame.cpu_finish)));
+  }
+
+  return file.IsGood();
+}
@@ -0,0 +1,58 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// When a frame passed each stage on its way from the emulated video interface to the screen.
+struct FrameTiming
+{
+  // Emulated time of the VI field that output the frame
+  DT emulated_time{};
+  // The CPU thread handed the frame to the video backend
+  TimePoint cpu_finish{};
+  // The video thread started presenting the frame
+  TimePoint gpu_submit{};
+  TimePoint present_call{};
+  TimePoint present_return{};
+};
+
+// Keeps the timings of the last few thousand presented frames for analysing frame pacing and
+// latency. Latency is measured from the end of the emulated frame to the return of the present.
+class FramePacingTracker
+{
+public:
+  struct Percentiles
+  {
+    DT p50{};
+    DT p95{};
+    DT p99{};
+  };
+
+  struct Summary
+  {
+    Percentiles frame_time;
+    Percentiles latency;
+    size_t num_frames = 0;
+  };
+
+  void Reset();
+  void AddFrame(const FrameTiming& timing);
+
+  Summary GetSummary() const;
+  // Writes one row per recorded frame. Times are in milliseconds relative to the first frame.
+  bool WriteCSV(const std::string& path) const;
+
+private:
+  static constexpr size_t MAX_FRAMES = 1 << 12;
+
+  mutable std::mutex m_mutex;
+  std::array<FrameTiming, MAX_FRAMES> m_frames{};
+  // Total number of frames added since the last reset
+  u64 m_num_frames = 0;
+};
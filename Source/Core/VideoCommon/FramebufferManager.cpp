@@ -3,8 +3,10 @@
 
 #include "VideoCommon/FramebufferManager.h"
 
+#include <chrono>
 #include <fmt/format.h>
 #include <memory>
+#include <utility>
 
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
@@ -22,6 +24,7 @@
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -476,26 +479,54 @@ MathUtil::Rectangle<int> FramebufferManager::GetEFBCacheTileRect(u32 tile_index)
       std::min(start_y + m_efb_cache_tile_size, static_cast<u32>(EFB_HEIGHT)));
 }
 
-u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
+AbstractStagingTexture* FramebufferManager::GetPeekReadbackTexture(bool depth, u32 x, u32 y)
 {
-  // The y coordinate here assumes upper-left origin, but the readback texture is lower-left in GL.
-  if (g_ActiveConfig.backend_info.bUsesLowerLeftOrigin)
-    y = EFB_HEIGHT - 1 - y;
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  const auto start = std::chrono::steady_clock::now();
+  bool waited = false;
+
+  if (!data.prefetch_tiles.empty())
+    waited = SwapInPrefetchedTiles(data);
 
   u32 tile_index;
-  if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
-    PopulateEFBCache(false, tile_index);
+  if (IsEFBCacheTilePresent(depth, x, y, &tile_index))
+  {
+    INCSTAT(g_stats.this_frame.num_efb_peek_cache_hits);
+  }
+  else
+  {
+    INCSTAT(g_stats.this_frame.num_efb_peek_cache_misses);
+    PopulateEFBCache(depth, tile_index);
+    waited = true;
+  }
+
+  data.tiles[tile_index].frame_access_mask |= 1;
 
-  m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
+  if (data.needs_flush)
+  {
+    waited |= !data.readback_texture->IsCopyComplete();
+    data.readback_texture->Flush();
+    data.needs_flush = false;
+  }
 
-  if (m_efb_color_cache.needs_flush)
+  if (waited)
   {
-    m_efb_color_cache.readback_texture->Flush();
-    m_efb_color_cache.needs_flush = false;
+    const auto stall_time = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    ADDSTAT(g_stats.this_frame.efb_peek_stall_us, static_cast<int>(stall_time.count()));
   }
 
+  return data.readback_texture.get();
+}
+
+u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
+{
+  // The y coordinate here assumes upper-left origin, but the readback texture is lower-left in GL.
+  if (g_ActiveConfig.backend_info.bUsesLowerLeftOrigin)
+    y = EFB_HEIGHT - 1 - y;
+
   u32 value;
-  m_efb_color_cache.readback_texture->ReadTexel(x, y, &value);
+  GetPeekReadbackTexture(false, x, y)->ReadTexel(x, y, &value);
   return value;
 }
 
@@ -505,20 +536,8 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
   if (g_ActiveConfig.backend_info.bUsesLowerLeftOrigin)
     y = EFB_HEIGHT - 1 - y;
 
-  u32 tile_index;
-  if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
-    PopulateEFBCache(true, tile_index);
-
-  m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
-
-  if (m_efb_depth_cache.needs_flush)
-  {
-    m_efb_depth_cache.readback_texture->Flush();
-    m_efb_depth_cache.needs_flush = false;
-  }
-
   float value;
-  m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
+  GetPeekReadbackTexture(true, x, y)->ReadTexel(x, y, &value);
   return value;
 }
 
@@ -568,6 +587,17 @@ void FramebufferManager::RefreshPeekCache()
 
 void FramebufferManager::InvalidatePeekCache(bool forced)
 {
+  // With double buffering, peeks read the EFB as of the end of the last frame, and the cache is
+  // only replaced or dropped at the end of each frame.
+  if (!forced && g_ActiveConfig.bEFBAccessDoubleBuffer)
+    return;
+
+  if (forced)
+  {
+    m_efb_color_cache.prefetch_tiles.clear();
+    m_efb_depth_cache.prefetch_tiles.clear();
+  }
+
   if (forced || m_efb_color_cache.out_of_date)
   {
     if (m_efb_color_cache.has_active_tiles)
@@ -607,12 +637,83 @@ void FramebufferManager::FlagPeekCacheAsOutOfDate()
   if (m_efb_depth_cache.has_active_tiles)
     m_efb_depth_cache.out_of_date = true;
 
-  if (!g_ActiveConfig.bEFBAccessDeferInvalidation)
+  if (!g_ActiveConfig.bEFBAccessDeferInvalidation && !g_ActiveConfig.bEFBAccessDoubleBuffer)
     InvalidatePeekCache();
 }
 
+bool FramebufferManager::SwapInPrefetchedTiles(EFBCacheData& data)
+{
+  // The copies were submitted at the end of the last frame, so they have usually finished by now.
+  const bool waited = !data.prefetch_texture->IsCopyComplete();
+  data.prefetch_texture->Flush();
+  std::swap(data.readback_texture, data.prefetch_texture);
+
+  for (EFBCacheTile& tile : data.tiles)
+    tile.present = false;
+  for (const u32 tile_index : data.prefetch_tiles)
+    data.tiles[tile_index].present = true;
+  data.prefetch_tiles.clear();
+
+  data.has_active_tiles = true;
+  data.out_of_date = false;
+  data.needs_refresh = false;
+  data.needs_flush = false;
+  return waited;
+}
+
+void FramebufferManager::PrefetchPeekedTiles()
+{
+  // Titles which peek the EFB, e.g. for lens flare occlusion tests, usually peek the same tiles
+  // every frame, so copy the tiles peeked in this frame now, while the EFB still holds the whole
+  // frame. The copies run while the next frame is emulated.
+  bool flush_command_buffer = false;
+  for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
+  {
+    if (m_efb_color_cache.tiles[i].frame_access_mask & 1)
+    {
+      CopyEFBCacheTile(false, i, m_efb_color_cache.prefetch_texture.get());
+      m_efb_color_cache.prefetch_tiles.push_back(i);
+      INCSTAT(g_stats.this_frame.num_efb_peek_tiles_prefetched);
+      flush_command_buffer = true;
+    }
+    if (m_efb_depth_cache.tiles[i].frame_access_mask & 1)
+    {
+      CopyEFBCacheTile(true, i, m_efb_depth_cache.prefetch_texture.get());
+      m_efb_depth_cache.prefetch_tiles.push_back(i);
+      INCSTAT(g_stats.this_frame.num_efb_peek_tiles_prefetched);
+      flush_command_buffer = true;
+    }
+  }
+
+  if (flush_command_buffer)
+  {
+    g_gfx->Flush();
+  }
+}
+
 void FramebufferManager::EndOfFrame()
 {
+  // Tiles prefetched in the last frame which weren't peeked since are two frames old by now.
+  m_efb_color_cache.prefetch_tiles.clear();
+  m_efb_depth_cache.prefetch_tiles.clear();
+  if (g_ActiveConfig.bEFBAccessDoubleBuffer)
+  {
+    PrefetchPeekedTiles();
+
+    // The prefetched tiles replace the cache on the next peek. Without any, the tiles in the cache
+    // are older than the frame that just ended, so they have to be read back again.
+    for (EFBCacheData* data : {&m_efb_color_cache, &m_efb_depth_cache})
+    {
+      if (!data->prefetch_tiles.empty() || !data->has_active_tiles)
+        continue;
+
+      for (EFBCacheTile& tile : data->tiles)
+        tile.present = false;
+      data->has_active_tiles = false;
+      data->out_of_date = false;
+    }
+  }
+
   for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
   {
     m_efb_color_cache.tiles[i].frame_access_mask <<= 1;
@@ -750,6 +851,13 @@ bool FramebufferManager::CreateReadbackFramebuffer()
   if (!m_efb_color_cache.readback_texture || !m_efb_depth_cache.readback_texture)
     return false;
 
+  m_efb_color_cache.prefetch_texture = g_gfx->CreateStagingTexture(
+      StagingTextureType::Mutable, m_efb_color_cache.readback_texture->GetConfig());
+  m_efb_depth_cache.prefetch_texture = g_gfx->CreateStagingTexture(
+      StagingTextureType::Mutable, m_efb_depth_cache.readback_texture->GetConfig());
+  if (!m_efb_color_cache.prefetch_texture || !m_efb_depth_cache.prefetch_texture)
+    return false;
+
   u32 total_tiles = 1;
   if (IsUsingTiledEFBCache())
   {
@@ -775,6 +883,8 @@ void FramebufferManager::DestroyReadbackFramebuffer()
 {
   auto DestroyCache = [](EFBCacheData& data) {
     data.readback_texture.reset();
+    data.prefetch_texture.reset();
+    data.prefetch_tiles.clear();
     data.framebuffer.reset();
     data.texture.reset();
     data.needs_refresh = false;
@@ -785,6 +895,26 @@ void FramebufferManager::DestroyReadbackFramebuffer()
 }
 
 void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async)
+{
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  CopyEFBCacheTile(depth, tile_index, data.readback_texture.get());
+
+  // Wait until the copy is complete.
+  if (!async)
+  {
+    data.readback_texture->Flush();
+    data.needs_flush = false;
+  }
+  else
+  {
+    data.needs_flush = true;
+  }
+  data.has_active_tiles = true;
+  data.out_of_date = false;
+  data.tiles[tile_index].present = true;
+}
+
+void FramebufferManager::CopyEFBCacheTile(bool depth, u32 tile_index, AbstractStagingTexture* dst)
 {
   FlushEFBPokes();
   g_vertex_manager->OnCPUEFBAccess();
@@ -831,30 +961,16 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
 
     // Copy from EFB or copy texture to staging texture.
     // No need to call FinishedRendering() here because CopyFromTexture() transitions.
-    data.readback_texture->CopyFromTexture(
-        data.texture.get(), MathUtil::Rectangle<int>(0, 0, rect.GetWidth(), rect.GetHeight()), 0, 0,
-        rect);
+    dst->CopyFromTexture(data.texture.get(),
+                         MathUtil::Rectangle<int>(0, 0, rect.GetWidth(), rect.GetHeight()), 0, 0,
+                         rect);
 
     g_gfx->EndUtilityDrawing();
   }
   else
   {
-    data.readback_texture->CopyFromTexture(src_texture, rect, 0, 0, rect);
+    dst->CopyFromTexture(src_texture, rect, 0, 0, rect);
   }
-
-  // Wait until the copy is complete.
-  if (!async)
-  {
-    data.readback_texture->Flush();
-    data.needs_flush = false;
-  }
-  else
-  {
-    data.needs_flush = true;
-  }
-  data.has_active_tiles = true;
-  data.out_of_date = false;
-  data.tiles[tile_index].present = true;
 }
 
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool color_enable,
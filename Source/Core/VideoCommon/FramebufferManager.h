@@ -154,6 +154,12 @@ protected:
     std::unique_ptr<AbstractStagingTexture> readback_texture;
     std::unique_ptr<AbstractPipeline> copy_pipeline;
     std::vector<EFBCacheTile> tiles;
+
+    // With double buffering, the tiles peeked in a frame are copied here at the end of the frame,
+    // and this is swapped with readback_texture on the first peek of the next frame.
+    std::unique_ptr<AbstractStagingTexture> prefetch_texture;
+    std::vector<u32> prefetch_tiles;
+
     bool out_of_date;
     bool has_active_tiles;
     bool needs_refresh;
@@ -182,6 +188,10 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void CopyEFBCacheTile(bool depth, u32 tile_index, AbstractStagingTexture* dst);
+  AbstractStagingTexture* GetPeekReadbackTexture(bool depth, u32 x, u32 y);
+  bool SwapInPrefetchedTiles(EFBCacheData& data);
+  void PrefetchPeekedTiles();
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
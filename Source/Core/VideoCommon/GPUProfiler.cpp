@@ -0,0 +1,314 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/GPUProfiler.h"
+
+#include <algorithm>
+#include <ctime>
+#include <utility>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+#include <imgui.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Core/ConfigManager.h"
+
+#include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/VideoConfig.h"
+
+GPUProfiler g_gpu_profiler;
+
+namespace
+{
+constexpr std::array<const char*, GPUProfiler::NUM_PASSES> PASS_NAMES = {
+    "Draw",
+    "EFB copy",
+    "XFB copy",
+    "Post-processing",
+};
+}  // namespace
+
+u32 GPUProfiler::BeginPass(Pass pass)
+{
+  QueryFrame& frame = m_query_frames[m_current_query_frame];
+  if (frame.num_queries + 2 > QUERIES_PER_FRAME)
+  {
+    m_dropped_events++;
+    return INVALID_EVENT;
+  }
+
+  const u32 begin_query = m_current_query_frame * QUERIES_PER_FRAME + frame.num_queries++;
+  g_gfx->WriteTimestampQuery(begin_query);
+  frame.events.push_back({pass, begin_query, INVALID_EVENT});
+  return static_cast<u32>(frame.events.size() - 1);
+}
+
+void GPUProfiler::EndPass(u32 event)
+{
+  if (event == INVALID_EVENT)
+    return;
+
+  // Passes which begin inside of another pass can use up the queries of the frame before the outer
+  // pass ends, in which case the outer pass is left out of the results.
+  QueryFrame& frame = m_query_frames[m_current_query_frame];
+  if (event >= frame.events.size() || frame.num_queries == QUERIES_PER_FRAME)
+  {
+    m_dropped_events++;
+    return;
+  }
+
+  const u32 end_query = m_current_query_frame * QUERIES_PER_FRAME + frame.num_queries++;
+  g_gfx->WriteTimestampQuery(end_query);
+  frame.events[event].end_query = end_query;
+}
+
+void GPUProfiler::EndFrame()
+{
+  const bool enable = g_ActiveConfig.bGPUProfiler && g_gfx->SupportsTimestampQueries();
+  if (!m_active)
+  {
+    if (enable)
+      Start();
+    return;
+  }
+
+  // The commands of the current frame haven't been submitted yet, so only earlier frames can have
+  // finished.
+  ReadResults();
+  m_query_frames[m_current_query_frame].pending = true;
+
+  if (!enable)
+  {
+    Stop();
+    return;
+  }
+
+  m_current_query_frame = (m_current_query_frame + 1) % NUM_QUERY_FRAMES;
+  BeginQueryFrame();
+}
+
+void GPUProfiler::Shutdown()
+{
+  if (!m_active)
+    return;
+
+  m_query_frames[m_current_query_frame].pending = true;
+  Stop();
+}
+
+void GPUProfiler::Start()
+{
+  m_active = true;
+  m_trace_frames.clear();
+  m_last_frame_totals = {};
+  m_dropped_events = 0;
+  m_dropped_frames = 0;
+  for (QueryFrame& frame : m_query_frames)
+    frame.pending = false;
+
+  m_current_query_frame = 0;
+  BeginQueryFrame();
+  OSD::AddMessage("GPU profiling started");
+}
+
+void GPUProfiler::Stop()
+{
+  // Collect everything that is still in flight
+  g_gfx->WaitForGPUIdle();
+  ReadResults();
+  m_active = false;
+
+  if (m_trace_frames.empty())
+    return;
+
+  const std::time_t time = std::time(nullptr);
+  const std::string path =
+      fmt::format("{}GPUProfile_{}_{:%Y-%m-%d_%H-%M-%S}.json", File::GetUserPath(D_DUMPDEBUG_IDX),
+                  SConfig::GetInstance().GetGameID(), fmt::localtime(time));
+  if (WriteTrace(path))
+    OSD::AddMessage(fmt::format("GPU profile saved to {}", path));
+  else
+    OSD::AddMessage(fmt::format("Failed to save GPU profile to {}", path), OSD::Duration::NORMAL,
+                    OSD::Color::RED);
+
+  if (m_dropped_events != 0 || m_dropped_frames != 0)
+  {
+    WARN_LOG_FMT(VIDEO, "GPU profile is missing {} passes and {} frames", m_dropped_events,
+                 m_dropped_frames);
+  }
+
+  m_trace_frames.clear();
+}
+
+void GPUProfiler::BeginQueryFrame()
+{
+  static_assert(NUM_QUERY_FRAMES * QUERIES_PER_FRAME <= AbstractGfx::TIMESTAMP_QUERY_COUNT);
+
+  QueryFrame& frame = m_query_frames[m_current_query_frame];
+
+  // The results of this slot weren't available before it came around again
+  if (frame.pending)
+    m_dropped_frames++;
+
+  frame.frame_number = m_frame_number++;
+  frame.num_queries = 0;
+  frame.pending = false;
+  frame.events.clear();
+  g_gfx->ResetTimestampQueries(m_current_query_frame * QUERIES_PER_FRAME, QUERIES_PER_FRAME);
+}
+
+void GPUProfiler::ReadResults()
+{
+  // Oldest first, stopping at the first frame the GPU hasn't finished, so that the trace stays in
+  // order
+  for (u32 i = 1; i <= NUM_QUERY_FRAMES; i++)
+  {
+    QueryFrame& frame = m_query_frames[(m_current_query_frame + i) % NUM_QUERY_FRAMES];
+    if (!frame.pending)
+      continue;
+    if (!ReadFrameResults(frame))
+      break;
+    frame.pending = false;
+  }
+}
+
+bool GPUProfiler::ReadFrameResults(QueryFrame& frame)
+{
+  if (frame.num_queries == 0)
+    return true;
+
+  const u32 first_query = frame.events.front().begin_query;
+  m_query_results.resize(frame.num_queries);
+  if (!g_gfx->ReadTimestampQueries(first_query, m_query_results))
+    return false;
+
+  FrameResult result;
+  result.frame_number = frame.frame_number;
+  result.events.reserve(frame.events.size());
+
+  FrameTotals totals;
+  u64 frame_begin = std::numeric_limits<u64>::max();
+  u64 frame_end = 0;
+  for (const PendingEvent& event : frame.events)
+  {
+    if (event.end_query == INVALID_EVENT)
+      continue;
+
+    const u64 begin_ns = m_query_results[event.begin_query - first_query];
+    const u64 end_ns = std::max(begin_ns, m_query_results[event.end_query - first_query]);
+    result.events.push_back({event.pass, begin_ns, end_ns});
+
+    totals.pass_ns[static_cast<u32>(event.pass)] += end_ns - begin_ns;
+    totals.pass_count[static_cast<u32>(event.pass)]++;
+    frame_begin = std::min(frame_begin, begin_ns);
+    frame_end = std::max(frame_end, end_ns);
+  }
+  if (!result.events.empty())
+    totals.frame_ns = frame_end - frame_begin;
+  m_last_frame_totals = totals;
+
+  m_trace_frames.push_back(std::move(result));
+  if (m_trace_frames.size() > MAX_TRACE_FRAMES)
+    m_trace_frames.pop_front();
+  return true;
+}
+
+bool GPUProfiler::WriteTrace(const std::string& path) const
+{
+  if (!File::CreateFullPath(path))
+    return false;
+
+  File::IOFile file(path, "w");
+  if (!file)
+    return false;
+
+  // Timestamps only have a meaning relative to each other, so the trace starts at zero
+  u64 base_ns = std::numeric_limits<u64>::max();
+  for (const FrameResult& frame : m_trace_frames)
+  {
+    for (const TimedEvent& event : frame.events)
+      base_ns = std::min(base_ns, event.begin_ns);
+  }
+
+  // Chrome trace times are in microseconds. Frames and passes are shown as separate threads.
+  const auto write_event = [&](const char* name, const char* category, u32 tid, u64 begin_ns,
+                               u64 end_ns, u64 frame_number) {
+    file.WriteString(fmt::format(
+        ",\n{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},"
+        "\"dur\":{:.3f},\"args\":{{\"frame\":{}}}}}",
+        name, category, tid, (begin_ns - base_ns) / 1000.0, (end_ns - begin_ns) / 1000.0,
+        frame_number));
+  };
+
+  file.WriteString("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                   "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"GPU\"}}"
+                   ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+                   "\"args\":{\"name\":\"Frames\"}}"
+                   ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,"
+                   "\"args\":{\"name\":\"Passes\"}}");
+
+  for (const FrameResult& frame : m_trace_frames)
+  {
+    if (frame.events.empty())
+      continue;
+
+    u64 frame_begin = std::numeric_limits<u64>::max();
+    u64 frame_end = 0;
+    for (const TimedEvent& event : frame.events)
+    {
+      write_event(PASS_NAMES[static_cast<u32>(event.pass)], "pass", 2, event.begin_ns,
+                  event.end_ns, frame.frame_number);
+      frame_begin = std::min(frame_begin, event.begin_ns);
+      frame_end = std::max(frame_end, event.end_ns);
+    }
+
+    write_event("Frame", "frame", 1, frame_begin, frame_end, frame.frame_number);
+  }
+
+  file.WriteString("\n]}\n");
+  return file.IsGood();
+}
+
+void GPUProfiler::Display() const
+{
+  if (!m_active)
+    return;
+
+  const float scale = ImGui::GetIO().DisplayFramebufferScale.x;
+  ImGui::SetNextWindowPos(ImVec2(10.0f * scale, 420.0f * scale), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSizeConstraints(ImVec2(275.0f * scale, 150.0f * scale),
+                                      ImGui::GetIO().DisplaySize);
+  if (!ImGui::Begin("GPU Profiler", nullptr, ImGuiWindowFlags_NoNavInputs))
+  {
+    ImGui::End();
+    return;
+  }
+
+  ImGui::Columns(2, "GPU Profiler", true);
+
+  const auto draw_statistic = [](const char* name, const char* format, auto&&... args) {
+    ImGui::TextUnformatted(name);
+    ImGui::NextColumn();
+    ImGui::Text(format, std::forward<decltype(args)>(args)...);
+    ImGui::NextColumn();
+  };
+
+  const FrameTotals& totals = m_last_frame_totals;
+  for (u32 i = 0; i < NUM_PASSES; i++)
+  {
+    draw_statistic(PASS_NAMES[i], "%.3f ms (%u)", totals.pass_ns[i] / 1000000.0,
+                   totals.pass_count[i]);
+  }
+  draw_statistic("Frame", "%.3f ms", totals.frame_ns / 1000000.0);
+  draw_statistic("Dropped passes", "%u", m_dropped_events);
+  draw_statistic("Dropped frames", "%u", m_dropped_frames);
+
+  ImGui::Columns(1);
+
+  ImGui::End();
+}
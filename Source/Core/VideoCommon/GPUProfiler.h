@@ -0,0 +1,132 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <deque>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Measures how long the GPU spends on each pass of a frame with timestamp queries. The totals of
+// the last frame are shown on screen, and the passes of recent frames are written to a Chrome
+// trace file (viewable with chrome://tracing or Perfetto) when profiling stops.
+class GPUProfiler
+{
+public:
+  enum class Pass : u8
+  {
+    Draw,
+    EFBCopy,
+    XFBCopy,
+    PostProcessing,
+  };
+  static constexpr u32 NUM_PASSES = 4;
+
+  // Times the GPU commands issued during the lifetime of the object.
+  class ScopedPass
+  {
+  public:
+    explicit ScopedPass(Pass pass);
+    ~ScopedPass();
+
+    ScopedPass(const ScopedPass&) = delete;
+    ScopedPass& operator=(const ScopedPass&) = delete;
+
+  private:
+    u32 m_event;
+  };
+
+  // Called on the GPU thread once per presented frame. Collects the results of earlier frames,
+  // and starts or stops profiling when the setting changes.
+  void EndFrame();
+
+  // Stops profiling, writing out the trace. Must be called before the backend shuts down.
+  void Shutdown();
+
+  // Shows the totals of the last frame
+  void Display() const;
+
+private:
+  static constexpr u32 INVALID_EVENT = std::numeric_limits<u32>::max();
+
+  // Query results are read a few frames later, so that the GPU is never waited on.
+  static constexpr u32 NUM_QUERY_FRAMES = 4;
+  static constexpr u32 QUERIES_PER_FRAME = 8192;
+  // Only the passes of the last few seconds are kept for the trace.
+  static constexpr size_t MAX_TRACE_FRAMES = 600;
+
+  struct PendingEvent
+  {
+    Pass pass;
+    u32 begin_query;
+    // INVALID_EVENT until the pass ends, or if there was no query left to end it with.
+    u32 end_query;
+  };
+
+  struct QueryFrame
+  {
+    u64 frame_number = 0;
+    u32 num_queries = 0;
+    bool pending = false;
+    std::vector<PendingEvent> events;
+  };
+
+  struct TimedEvent
+  {
+    Pass pass;
+    u64 begin_ns;
+    u64 end_ns;
+  };
+
+  struct FrameResult
+  {
+    u64 frame_number = 0;
+    std::vector<TimedEvent> events;
+  };
+
+  struct FrameTotals
+  {
+    std::array<u64, NUM_PASSES> pass_ns{};
+    std::array<u32, NUM_PASSES> pass_count{};
+    u64 frame_ns = 0;
+  };
+
+  u32 BeginPass(Pass pass);
+  void EndPass(u32 event);
+
+  void Start();
+  void Stop();
+  void BeginQueryFrame();
+  void ReadResults();
+  bool ReadFrameResults(QueryFrame& frame);
+  bool WriteTrace(const std::string& path) const;
+
+  bool m_active = false;
+
+  std::array<QueryFrame, NUM_QUERY_FRAMES> m_query_frames;
+  u32 m_current_query_frame = 0;
+  u64 m_frame_number = 0;
+
+  std::deque<FrameResult> m_trace_frames;
+  std::vector<u64> m_query_results;
+  FrameTotals m_last_frame_totals;
+  u32 m_dropped_events = 0;
+  u32 m_dropped_frames = 0;
+};
+
+extern GPUProfiler g_gpu_profiler;
+
+inline GPUProfiler::ScopedPass::ScopedPass(Pass pass)
+    : m_event(g_gpu_profiler.m_active ? g_gpu_profiler.BeginPass(pass) : INVALID_EVENT)
+{
+}
+
+inline GPUProfiler::ScopedPass::~ScopedPass()
+{
+  if (m_event != INVALID_EVENT)
+    g_gpu_profiler.EndPass(m_event);
+}
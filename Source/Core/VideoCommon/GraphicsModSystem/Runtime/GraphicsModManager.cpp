@@ -3,10 +3,13 @@
 
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 
+#include <chrono>
 #include <string>
 #include <string_view>
 #include <variant>
 
+#include <xxhash.h>
+
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/VariantUtil.h"
@@ -18,11 +21,15 @@
 #include "VideoCommon/GraphicsModSystem/Config/GraphicsModAsset.h"
 #include "VideoCommon/GraphicsModSystem/Config/GraphicsModGroup.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionFactory.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureInfo.h"
 #include "VideoCommon/VideoConfig.h"
 
 std::unique_ptr<GraphicsModManager> g_graphics_mod_manager;
 
+// Set in the IDs of texture names which no mod targets, which are never interned.
+static constexpr u64 UNTARGETED_TEXTURE_ID_BIT = u64{1} << 63;
+
 class GraphicsModManager::DecoratedAction final : public GraphicsModAction
 {
 public:
@@ -102,86 +109,79 @@ bool GraphicsModManager::Initialize()
   return true;
 }
 
-const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
+u64 GraphicsModManager::GetTextureID(std::string_view texture_name) const
 {
-  if (const auto it = m_projection_target_to_actions.find(projection_type);
-      it != m_projection_target_to_actions.end())
-  {
+  if (const auto it = m_texture_ids.find(texture_name); it != m_texture_ids.end())
     return it->second;
-  }
 
-  return m_default;
+  return XXH64(texture_name.data(), texture_name.size(), 0) | UNTARGETED_TEXTURE_ID_BIT;
 }
 
+u64 GraphicsModManager::InternTextureName(const std::string& texture_name)
+{
+  return m_texture_ids.try_emplace(texture_name, m_texture_ids.size()).first->second;
+}
+
+template <typename Map>
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
-                                                const std::string& texture_name) const
+GraphicsModManager::FindActions(const Map& map, const typename Map::key_type& key)
 {
-  const auto lookup = fmt::format("{}_{}", texture_name, static_cast<int>(projection_type));
-  if (const auto it = m_projection_texture_target_to_actions.find(lookup);
-      it != m_projection_texture_target_to_actions.end())
+  INCSTAT(g_stats.this_frame.num_graphics_mod_lookups);
+
+  // Timing a lookup costs about as much as the lookup itself, so it's only done while the
+  // statistics are shown
+  using Clock = std::chrono::steady_clock;
+  const bool timed = g_ActiveConfig.bOverlayStats;
+  const Clock::time_point start = timed ? Clock::now() : Clock::time_point{};
+  const auto it = map.find(key);
+  if (timed)
   {
-    return it->second;
+    ADDSTAT(g_stats.this_frame.graphics_mod_lookup_ns,
+            static_cast<int>(std::chrono::nanoseconds(Clock::now() - start).count()));
   }
 
-  return m_default;
+  return it != map.end() ? it->second : m_default;
 }
 
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
+GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
 {
-  if (const auto it = m_draw_started_target_to_actions.find(texture_name);
-      it != m_draw_started_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_projection_target_to_actions, projection_type);
 }
 
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
+GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
+                                                u64 texture_id) const
 {
-  if (const auto it = m_load_texture_target_to_actions.find(texture_name);
-      it != m_load_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
+  return FindActions(m_projection_texture_target_to_actions[projection_type], texture_id);
+}
 
-  return m_default;
+const std::vector<GraphicsModAction*>&
+GraphicsModManager::GetDrawStartedActions(u64 texture_id) const
+{
+  return FindActions(m_draw_started_target_to_actions, texture_id);
 }
 
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureCreateActions(const std::string& texture_name) const
+GraphicsModManager::GetTextureLoadActions(u64 texture_id) const
 {
-  if (const auto it = m_create_texture_target_to_actions.find(texture_name);
-      it != m_create_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
+  return FindActions(m_load_texture_target_to_actions, texture_id);
+}
 
-  return m_default;
+const std::vector<GraphicsModAction*>&
+GraphicsModManager::GetTextureCreateActions(u64 texture_id) const
+{
+  return FindActions(m_create_texture_target_to_actions, texture_id);
 }
 
 const std::vector<GraphicsModAction*>& GraphicsModManager::GetEFBActions(const FBInfo& efb) const
 {
-  if (const auto it = m_efb_target_to_actions.find(efb); it != m_efb_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_efb_target_to_actions, efb);
 }
 
 const std::vector<GraphicsModAction*>& GraphicsModManager::GetXFBActions(const FBInfo& xfb) const
 {
-  if (const auto it = m_efb_target_to_actions.find(xfb); it != m_efb_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_xfb_target_to_actions, xfb);
 }
 
 void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
@@ -261,15 +261,16 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
         std::visit(
             overloaded{
                 [&](const DrawStartedTextureTarget& the_target) {
-                  m_draw_started_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  const u64 texture_id = InternTextureName(the_target.m_texture_info_string);
+                  m_draw_started_target_to_actions[texture_id].push_back(m_actions.back().get());
                 },
                 [&](const LoadTextureTarget& the_target) {
-                  m_load_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  const u64 texture_id = InternTextureName(the_target.m_texture_info_string);
+                  m_load_texture_target_to_actions[texture_id].push_back(m_actions.back().get());
                 },
                 [&](const CreateTextureTarget& the_target) {
-                  m_create_texture_target_to_actions[the_target.m_texture_info_string].push_back(
+                  const u64 texture_id = InternTextureName(the_target.m_texture_info_string);
+                  m_create_texture_target_to_actions[texture_id].push_back(
                       m_actions.back().get());
                 },
                 [&](const EFBTarget& the_target) {
@@ -289,10 +290,9 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
                 [&](const ProjectionTarget& the_target) {
                   if (the_target.m_texture_info_string)
                   {
-                    const auto lookup = fmt::format("{}_{}", *the_target.m_texture_info_string,
-                                                    static_cast<int>(the_target.m_projection_type));
-                    m_projection_texture_target_to_actions[lookup].push_back(
-                        m_actions.back().get());
+                    const u64 texture_id = InternTextureName(*the_target.m_texture_info_string);
+                    m_projection_texture_target_to_actions[the_target.m_projection_type][texture_id]
+                        .push_back(m_actions.back().get());
                   }
                   else
                   {
@@ -360,8 +360,10 @@ void GraphicsModManager::Reset()
 {
   m_actions.clear();
   m_groups.clear();
+  m_texture_ids.clear();
   m_projection_target_to_actions.clear();
-  m_projection_texture_target_to_actions.clear();
+  for (auto& projection_texture_target_to_actions : m_projection_texture_target_to_actions)
+    projection_texture_target_to_actions.clear();
   m_draw_started_target_to_actions.clear();
   m_load_texture_target_to_actions.clear();
   m_create_texture_target_to_actions.clear();
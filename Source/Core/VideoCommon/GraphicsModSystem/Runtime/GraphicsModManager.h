@@ -4,12 +4,16 @@
 #pragma once
 
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModAction.h"
 #include "VideoCommon/TextureInfo.h"
@@ -22,16 +26,20 @@ class GraphicsModManager
 public:
   bool Initialize();
 
+  // Actions are looked up by the ID of the texture name instead of the name itself, so that draws
+  // don't have to build and hash name strings. The names which mods target are interned to dense
+  // IDs when the mods are loaded. Other names get a hash with the top bit set, which can't match
+  // any of those IDs, but still tells different textures apart. Texture cache entries look up the
+  // ID of their name once when they are created. The texture cache is invalidated whenever the
+  // mods are loaded again, so the IDs of its entries are never stale.
+  u64 GetTextureID(std::string_view texture_name) const;
+
   const std::vector<GraphicsModAction*>& GetProjectionActions(ProjectionType projection_type) const;
-  const std::vector<GraphicsModAction*>&
-  GetProjectionTextureActions(ProjectionType projection_type,
-                              const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetDrawStartedActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureLoadActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureCreateActions(const std::string& texture_name) const;
+  const std::vector<GraphicsModAction*>& GetProjectionTextureActions(ProjectionType projection_type,
+                                                                     u64 texture_id) const;
+  const std::vector<GraphicsModAction*>& GetDrawStartedActions(u64 texture_id) const;
+  const std::vector<GraphicsModAction*>& GetTextureLoadActions(u64 texture_id) const;
+  const std::vector<GraphicsModAction*>& GetTextureCreateActions(u64 texture_id) const;
   const std::vector<GraphicsModAction*>& GetEFBActions(const FBInfo& efb) const;
   const std::vector<GraphicsModAction*>& GetXFBActions(const FBInfo& xfb) const;
 
@@ -43,20 +51,27 @@ private:
 
   class DecoratedAction;
 
+  u64 InternTextureName(const std::string& texture_name);
+
+  template <typename Map>
+  static const std::vector<GraphicsModAction*>& FindActions(const Map& map,
+                                                            const typename Map::key_type& key);
+
   static inline const std::vector<GraphicsModAction*> m_default = {};
   std::list<std::unique_ptr<GraphicsModAction>> m_actions;
   std::unordered_map<ProjectionType, std::vector<GraphicsModAction*>>
       m_projection_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
+  Common::EnumMap<std::unordered_map<u64, std::vector<GraphicsModAction*>>,
+                  ProjectionType::Orthographic>
       m_projection_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_draw_started_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_load_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_create_texture_target_to_actions;
+  std::unordered_map<u64, std::vector<GraphicsModAction*>> m_draw_started_target_to_actions;
+  std::unordered_map<u64, std::vector<GraphicsModAction*>> m_load_texture_target_to_actions;
+  std::unordered_map<u64, std::vector<GraphicsModAction*>> m_create_texture_target_to_actions;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_efb_target_to_actions;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_xfb_target_to_actions;
 
   std::unordered_set<std::string> m_groups;
+  std::map<std::string, u64, std::less<>> m_texture_ids;
 
   Common::EventHook m_end_of_frame_event;
 };
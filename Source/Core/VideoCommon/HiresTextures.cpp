@@ -4,6 +4,7 @@
 #include "VideoCommon/HiresTextures.h"
 
 #include <algorithm>
+#include <charconv>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -28,12 +29,20 @@
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/TexturePackManifest.h"
 #include "VideoCommon/VideoConfig.h"
 
 constexpr std::string_view s_format_prefix{"tex1_"};
 
-static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_texture_cache;
+// Previews are at most this many mip levels below the full texture. Decoding the full texture
+// takes around 16 times longer than decoding the second mip level.
+constexpr u32 MAX_PREVIEW_LEVEL = 2;
+
+static std::unordered_map<std::string, std::shared_ptr<VideoCommon::GameTextureAsset>>
+    s_hires_texture_cache;
 static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
+static std::unordered_map<std::string, u32> s_hires_texture_id_to_preview_level;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 
@@ -75,6 +84,70 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 
   return {"", false};
 }
+
+// Reads the native size from a texture name like 'tex1_64x32_...', or 0x0 if it has none
+std::pair<u32, u32> GetNativeDimensions(std::string_view id)
+{
+  if (!id.starts_with(s_format_prefix))
+    return {0, 0};
+
+  const char* const end = id.data() + id.size();
+  u32 width = 0;
+  u32 height = 0;
+  const auto width_result = std::from_chars(id.data() + s_format_prefix.size(), end, width);
+  if (width_result.ec != std::errc{} || width_result.ptr == end || *width_result.ptr != 'x' ||
+      std::from_chars(width_result.ptr + 1, end, height).ec != std::errc{})
+  {
+    return {0, 0};
+  }
+  return {width, height};
+}
+
+std::set<std::string> GetTextureDirectoriesWithGameId(const std::string& root_directory,
+                                                      const std::string& game_id,
+                                                      const std::vector<std::string>& txt_files)
+{
+  std::set<std::string> result;
+  const std::string texture_directory = root_directory + game_id;
+
+  if (File::Exists(texture_directory))
+  {
+    result.insert(texture_directory);
+  }
+  else
+  {
+    // If there's no directory with the region-specific ID, look for a 3-character region-free one
+    const std::string region_free_directory = root_directory + game_id.substr(0, 3);
+
+    if (File::Exists(region_free_directory))
+    {
+      result.insert(region_free_directory);
+    }
+  }
+
+  const auto match_gameid_or_all = [game_id](const std::string& filename) {
+    std::string basename;
+    SplitPath(filename, nullptr, &basename, nullptr);
+    return basename == game_id || basename == game_id.substr(0, 3) || basename == "all";
+  };
+
+  // Look for any other directories that might be specific to the given gameid
+  for (const auto& file : txt_files)
+  {
+    if (match_gameid_or_all(file))
+    {
+      // The following code is used to calculate the top directory
+      // of a found gameid.txt file
+      // ex:  <root directory>/My folder/gameids/<gameid>.txt
+      // would insert "<root directory>/My folder"
+      const auto directory_path = file.substr(root_directory.size());
+      const std::size_t first_path_separator_position = directory_path.find_first_of(DIR_SEP_CHR);
+      result.insert(root_directory + directory_path.substr(0, first_path_separator_position));
+    }
+  }
+
+  return result;
+}
 }  // namespace
 
 void HiresTexture::Shutdown()
@@ -90,20 +163,27 @@ void HiresTexture::Update()
     return;
   }
 
+  // Only the directories which changed since the last boot are searched again
+  const std::string manifest_path = File::GetUserPath(D_CACHE_IDX) + "HiresTextures.manifest";
+  VideoCommon::TexturePackManifest manifest(File::GetUserPath(D_HIRESTEXTURES_IDX));
+  manifest.Load(manifest_path);
+  if (manifest.Update())
+    manifest.Save(manifest_path);
+
   const std::string& game_id = SConfig::GetInstance().GetGameID();
   const std::set<std::string> texture_directories =
-      GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
+      GetTextureDirectoriesWithGameId(manifest, game_id);
   const std::vector<std::string> extensions{".png", ".dds"};
 
   auto& system = Core::System::GetInstance();
+  std::unordered_map<std::string, std::pair<u32, u32>> texture_dimensions;
 
   for (const auto& texture_directory : texture_directories)
   {
-    const auto texture_paths =
-        Common::DoFileSearch({texture_directory}, extensions, /*recursive*/ true);
+    const auto texture_files = manifest.FindFiles(texture_directory, extensions);
 
     bool failed_insert = false;
-    for (auto& path : texture_paths)
+    for (const auto& [path, info] : texture_files)
     {
       std::string filename;
       SplitPath(path, nullptr, &filename, nullptr);
@@ -123,17 +203,20 @@ void HiresTexture::Update()
         }
         else
         {
+          texture_dimensions.emplace(filename, std::pair(info->width, info->height));
+
           // Since this is just a texture (single file) the mapper doesn't really matter
           // just provide a string
           s_file_library->SetAssetIDMapData(filename, std::map<std::string, std::filesystem::path>{
                                                           {"texture", StringToPath(path)}});
 
+          // Prefetched textures are only loaded while they fit in the memory budget
           if (g_ActiveConfig.bCacheHiresTextures)
           {
-            auto hires_texture = std::make_shared<HiresTexture>(
-                has_arbitrary_mipmaps,
-                system.GetCustomAssetLoader().LoadGameTexture(filename, s_file_library));
-            s_hires_texture_cache.try_emplace(filename, std::move(hires_texture));
+            s_hires_texture_cache.try_emplace(
+                filename, system.GetCustomAssetLoader().StreamGameTexture(
+                              filename, s_file_library,
+                              VideoCommon::CustomAssetLoader::LoadPriority::Prefetch));
           }
         }
       }
@@ -146,6 +229,31 @@ void HiresTexture::Update()
     }
   }
 
+  // Textures with mipmaps in separate files can be previewed with one of them. Arbitrary mipmaps
+  // don't look like the texture, so they can't be used. Neither can mipmaps below the native size
+  // of the texture, which would look worse than not replacing it at all.
+  for (const auto& [id, has_arbitrary_mipmaps] : s_hires_texture_id_to_arbmipmap)
+  {
+    if (has_arbitrary_mipmaps)
+      continue;
+
+    const auto [native_width, native_height] = GetNativeDimensions(id);
+    for (u32 level = MAX_PREVIEW_LEVEL; level > 0; --level)
+    {
+      const auto preview = texture_dimensions.find(fmt::format("{}_mip{}", id, level));
+      if (preview == texture_dimensions.end())
+        continue;
+
+      // The size is unknown if the header of the file couldn't be read
+      const auto [width, height] = preview->second;
+      if (width == 0 || native_width == 0 || (width >= native_width && height >= native_height))
+      {
+        s_hires_texture_id_to_preview_level.emplace(id, level);
+        break;
+      }
+    }
+  }
+
   if (g_ActiveConfig.bCacheHiresTextures)
   {
     OSD::AddMessage(fmt::format("Loading '{}' custom textures", s_hires_texture_cache.size()),
@@ -162,6 +270,7 @@ void HiresTexture::Clear()
 {
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
+  s_hires_texture_id_to_preview_level.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 }
 
@@ -171,72 +280,59 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
   if (base_filename == "")
     return nullptr;
 
-  if (auto iter = s_hires_texture_cache.find(base_filename); iter != s_hires_texture_cache.end())
+  // Requesting the texture marks it as used, and loads it again if it was unloaded to stay within
+  // the memory budget
+  auto& loader = Core::System::GetInstance().GetCustomAssetLoader();
+  auto asset = loader.StreamGameTexture(base_filename, s_file_library);
+  if (g_ActiveConfig.bCacheHiresTextures)
+    s_hires_texture_cache.try_emplace(base_filename, asset);
+
+  std::shared_ptr<VideoCommon::GameTextureAsset> preview_asset;
+  u32 preview_level = 0;
+  if (asset->GetData())
   {
-    return iter->second;
+    INCSTAT(g_stats.this_frame.num_custom_texture_hits);
   }
   else
   {
-    auto& system = Core::System::GetInstance();
-    auto hires_texture = std::make_shared<HiresTexture>(
-        has_arb_mipmaps,
-        system.GetCustomAssetLoader().LoadGameTexture(base_filename, s_file_library));
-    if (g_ActiveConfig.bCacheHiresTextures)
+    INCSTAT(g_stats.this_frame.num_custom_texture_misses);
+    if (auto iter = s_hires_texture_id_to_preview_level.find(base_filename);
+        iter != s_hires_texture_id_to_preview_level.end())
     {
-      s_hires_texture_cache.try_emplace(base_filename, hires_texture);
+      preview_level = iter->second;
+      preview_asset = loader.StreamGameTexture(
+          fmt::format("{}_mip{}", base_filename, preview_level), s_file_library,
+          VideoCommon::CustomAssetLoader::LoadPriority::Preview);
     }
-    return hires_texture;
   }
+
+  return std::make_shared<HiresTexture>(has_arb_mipmaps, std::move(asset), std::move(preview_asset),
+                                        preview_level);
 }
 
 HiresTexture::HiresTexture(bool has_arbitrary_mipmaps,
-                           std::shared_ptr<VideoCommon::GameTextureAsset> asset)
-    : m_has_arbitrary_mipmaps(has_arbitrary_mipmaps), m_game_texture(std::move(asset))
+                           std::shared_ptr<VideoCommon::GameTextureAsset> asset,
+                           std::shared_ptr<VideoCommon::GameTextureAsset> preview_asset,
+                           u32 preview_level)
+    : m_has_arbitrary_mipmaps(has_arbitrary_mipmaps), m_game_texture(std::move(asset)),
+      m_preview_texture(std::move(preview_asset)), m_preview_level(preview_level)
 {
 }
 
 std::set<std::string> GetTextureDirectoriesWithGameId(const std::string& root_directory,
                                                       const std::string& game_id)
 {
-  std::set<std::string> result;
-  const std::string texture_directory = root_directory + game_id;
-
-  if (File::Exists(texture_directory))
-  {
-    result.insert(texture_directory);
-  }
-  else
-  {
-    // If there's no directory with the region-specific ID, look for a 3-character region-free one
-    const std::string region_free_directory = root_directory + game_id.substr(0, 3);
-
-    if (File::Exists(region_free_directory))
-    {
-      result.insert(region_free_directory);
-    }
-  }
-
-  const auto match_gameid_or_all = [game_id](const std::string& filename) {
-    std::string basename;
-    SplitPath(filename, nullptr, &basename, nullptr);
-    return basename == game_id || basename == game_id.substr(0, 3) || basename == "all";
-  };
-
-  // Look for any other directories that might be specific to the given gameid
-  const auto files = Common::DoFileSearch({root_directory}, {".txt"}, true);
-  for (const auto& file : files)
-  {
-    if (match_gameid_or_all(file))
-    {
-      // The following code is used to calculate the top directory
-      // of a found gameid.txt file
-      // ex:  <root directory>/My folder/gameids/<gameid>.txt
-      // would insert "<root directory>/My folder"
-      const auto directory_path = file.substr(root_directory.size());
-      const std::size_t first_path_separator_position = directory_path.find_first_of(DIR_SEP_CHR);
-      result.insert(root_directory + directory_path.substr(0, first_path_separator_position));
-    }
-  }
+  return GetTextureDirectoriesWithGameId(
+      root_directory, game_id, Common::DoFileSearch({root_directory}, {".txt"}, true));
+}
 
-  return result;
+std::set<std::string>
+GetTextureDirectoriesWithGameId(const VideoCommon::TexturePackManifest& manifest,
+                                const std::string& game_id)
+{
+  std::vector<std::string> txt_files;
+  for (auto& file : manifest.FindFiles(manifest.GetRootDirectory(), {".txt"}))
+    txt_files.push_back(std::move(file.path));
+  return GetTextureDirectoriesWithGameId(manifest.GetRootDirectory() + DIR_SEP, game_id,
+                                         txt_files);
 }
@@ -16,8 +16,17 @@
 
 enum class TextureFormat;
 
+namespace VideoCommon
+{
+class TexturePackManifest;
+}
+
 std::set<std::string> GetTextureDirectoriesWithGameId(const std::string& root_directory,
                                                       const std::string& game_id);
+// Same as above, with the files below the root of the manifest
+std::set<std::string>
+GetTextureDirectoriesWithGameId(const VideoCommon::TexturePackManifest& manifest,
+                                const std::string& game_id);
 
 class HiresTexture
 {
@@ -27,12 +36,23 @@ public:
   static void Shutdown();
   static std::shared_ptr<HiresTexture> Search(const TextureInfo& texture_info);
 
-  HiresTexture(bool has_arbitrary_mipmaps, std::shared_ptr<VideoCommon::GameTextureAsset> asset);
+  HiresTexture(bool has_arbitrary_mipmaps, std::shared_ptr<VideoCommon::GameTextureAsset> asset,
+               std::shared_ptr<VideoCommon::GameTextureAsset> preview_asset, u32 preview_level);
 
   bool HasArbitraryMipmaps() const { return m_has_arbitrary_mipmaps; }
   const std::shared_ptr<VideoCommon::GameTextureAsset>& GetAsset() const { return m_game_texture; }
 
+  // A single mip level of the texture, which is loaded first so that it can be shown until the
+  // full texture is loaded. Only set while the full texture isn't loaded.
+  const std::shared_ptr<VideoCommon::GameTextureAsset>& GetPreviewAsset() const
+  {
+    return m_preview_texture;
+  }
+  u32 GetPreviewLevel() const { return m_preview_level; }
+
 private:
   bool m_has_arbitrary_mipmaps = false;
   std::shared_ptr<VideoCommon::GameTextureAsset> m_game_texture;
+  std::shared_ptr<VideoCommon::GameTextureAsset> m_preview_texture;
+  u32 m_preview_level = 0;
 };
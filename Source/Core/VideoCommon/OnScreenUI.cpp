@@ -17,6 +17,7 @@
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/AbstractShader.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/GPUProfiler.h"
 #include "VideoCommon/NetPlayChatUI.h"
 #include "VideoCommon/NetPlayGolfUI.h"
 #include "VideoCommon/OnScreenDisplay.h"
@@ -326,6 +327,9 @@ void OnScreenUI::DrawDebugText()
   if (g_ActiveConfig.bOverlayScissorStats)
     g_stats.DisplayScissor();
 
+  if (g_ActiveConfig.bGPUProfiler)
+    g_gpu_profiler.Display();
+
   const std::string profile_output = Common::Profiler::ToString();
   if (!profile_output.empty())
     ImGui::TextUnformatted(profile_output.c_str());
@@ -14,6 +14,8 @@
 
 #include "VideoCommon/OpcodeDecoding.h"
 
+#include <optional>
+
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
@@ -260,6 +262,10 @@ public:
 template <bool is_preprocess>
 u8* RunFifo(DataReader src, u32* cycles)
 {
+  std::optional<GPUThreadPartTimer> timer;
+  if constexpr (!is_preprocess)
+    timer.emplace(GPUThreadPart::OpcodeDecoding);
+
   using CallbackT = RunCallback<is_preprocess>;
   auto callback = CallbackT{};
   u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
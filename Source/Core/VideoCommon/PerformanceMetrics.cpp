@@ -20,6 +20,7 @@ void PerformanceMetrics::Reset()
   m_fps_counter.Reset();
   m_vps_counter.Reset();
   m_speed_counter.Reset();
+  m_frame_pacing.Reset();
 
   m_time_sleeping = DT::zero();
   m_real_times.fill(Clock::now());
@@ -36,6 +37,11 @@ void PerformanceMetrics::CountVBlank()
   m_vps_counter.Count();
 }
 
+void PerformanceMetrics::CountPresent(const FrameTiming& timing)
+{
+  m_frame_pacing.AddFrame(timing);
+}
+
 void PerformanceMetrics::CountThrottleSleep(DT sleep)
 {
   std::unique_lock lock(m_time_lock);
@@ -80,6 +86,11 @@ double PerformanceMetrics::GetLastSpeedDenominator() const
          Core::System::GetInstance().GetVideoInterface().GetTargetRefreshRate();
 }
 
+bool PerformanceMetrics::WriteFramePacingCSV(const std::string& path) const
+{
+  return m_frame_pacing.WriteCSV(path);
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   const float bg_alpha = 0.7f;
@@ -269,5 +280,37 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     ImGui::End();
   }
 
+  if (g_ActiveConfig.bShowFramePacing)
+  {
+    const float window_height = (12.f + 17.f * 3) * backbuffer_scale;
+    const float pacing_window_width = 2.f * window_width + window_padding;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(pacing_window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= pacing_window_width + window_padding;
+
+    if (ImGui::Begin("FramePacingStats", nullptr, imgui_flags))
+    {
+      const FramePacingTracker::Summary summary = m_frame_pacing.GetSummary();
+      const auto draw_percentiles = [&](const char* name,
+                                        const FramePacingTracker::Percentiles& percentiles) {
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%s%6.2lf%6.2lf%6.2lf", name,
+                           DT_ms(percentiles.p50).count(), DT_ms(percentiles.p95).count(),
+                           DT_ms(percentiles.p99).count());
+      };
+
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "ms       p50   p95   p99");
+      draw_percentiles("Frame:", summary.frame_time);
+      draw_percentiles("Lat.: ", summary.latency);
+    }
+    ImGui::End();
+  }
+
   ImGui::PopStyleVar(2);
 }
@@ -5,8 +5,10 @@
 
 #include <array>
 #include <shared_mutex>
+#include <string>
 
 #include "Common/CommonTypes.h"
+#include "VideoCommon/FramePacing.h"
 #include "VideoCommon/PerformanceTracker.h"
 
 namespace Core
@@ -30,6 +32,8 @@ public:
   void CountFrame();
   void CountVBlank();
 
+  void CountPresent(const FrameTiming& timing);
+
   void CountThrottleSleep(DT sleep);
   void CountPerformanceMarker(Core::System& system, s64 cyclesLate);
 
@@ -41,6 +45,8 @@ public:
 
   double GetLastSpeedDenominator() const;
 
+  bool WriteFramePacingCSV(const std::string& path) const;
+
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
 
@@ -48,6 +54,7 @@ private:
   PerformanceTracker m_fps_counter{"render_times.txt"};
   PerformanceTracker m_vps_counter{"vblank_times.txt"};
   PerformanceTracker m_speed_counter{std::nullopt, 1000000};
+  FramePacingTracker m_frame_pacing;
 
   double m_graph_max_time = 0.0;
 
@@ -5,6 +5,7 @@
 
 #include "Common/ChunkFile.h"
 #include "Core/Config/GraphicsSettings.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/Host.h"
 #include "Core/System.h"
@@ -15,7 +16,9 @@
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUProfiler.h"
 #include "VideoCommon/OnScreenUI.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -157,8 +160,10 @@ bool Presenter::FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_heigh
   return old_xfb_id == m_last_xfb_id;
 }
 
-void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks)
+void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks,
+                       TimePoint output_time)
 {
+  const TimePoint gpu_submit = Clock::now();
   bool is_duplicate = FetchXFB(xfb_addr, fb_width, fb_stride, fb_height, ticks);
 
   PresentInfo present_info;
@@ -199,6 +204,7 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
   if (!is_duplicate || !g_ActiveConfig.bSkipPresentingDuplicateXFBs)
   {
     Present();
+    CountFrameTiming(ticks, output_time, gpu_submit);
     ProcessFrameDumping(ticks);
 
     AfterPresentEvent::Trigger(present_info);
@@ -207,6 +213,8 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
 
 void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks)
 {
+  // Immediate XFB copies are presented by the video thread as soon as they are made
+  const TimePoint gpu_submit = Clock::now();
   FetchXFB(xfb_addr, fb_width, fb_stride, fb_height, ticks);
 
   PresentInfo present_info;
@@ -218,11 +226,26 @@ void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_
   BeforePresentEvent::Trigger(present_info);
 
   Present();
+  CountFrameTiming(ticks, gpu_submit, gpu_submit);
   ProcessFrameDumping(ticks);
 
   AfterPresentEvent::Trigger(present_info);
 }
 
+void Presenter::CountFrameTiming(u64 ticks, TimePoint cpu_finish, TimePoint gpu_submit) const
+{
+  const u32 ticks_per_second = Core::System::GetInstance().GetSystemTimers().GetTicksPerSecond();
+
+  FrameTiming timing;
+  timing.emulated_time =
+      std::chrono::duration_cast<DT>(DT_s(static_cast<double>(ticks) / ticks_per_second));
+  timing.cpu_finish = cpu_finish;
+  timing.gpu_submit = gpu_submit;
+  timing.present_call = m_present_call_time;
+  timing.present_return = m_present_return_time;
+  g_perf_metrics.CountPresent(timing);
+}
+
 void Presenter::ProcessFrameDumping(u64 ticks) const
 {
   if (g_frame_dumper->IsFrameDumping() && m_xfb_entry)
@@ -786,6 +809,8 @@ void Presenter::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
                                   const AbstractTexture* source_texture,
                                   const MathUtil::Rectangle<int>& source_rc)
 {
+  GPUProfiler::ScopedPass profiler_pass(GPUProfiler::Pass::PostProcessing);
+
   if (g_ActiveConfig.stereo_mode == StereoMode::QuadBuffer &&
       g_ActiveConfig.backend_info.bUsesExplictQuadBuffering)
   {
@@ -818,13 +843,20 @@ void Presenter::Present()
 {
   m_present_count++;
 
+  // Everything the GPU was given since the last present belongs to the previous frame
+  g_gpu_profiler.EndFrame();
+
   if (g_gfx->IsHeadless() || (!m_onscreen_ui && !m_xfb_entry))
+  {
+    m_present_call_time = m_present_return_time = Clock::now();
     return;
+  }
 
   if (!g_gfx->SupportsUtilityDrawing())
   {
     // Video Software doesn't support drawing a UI or doing post-processing
     // So just show the XFB
+    m_present_call_time = Clock::now();
     if (m_xfb_entry)
     {
       g_gfx->ShowImage(m_xfb_entry->texture.get(), m_xfb_rect);
@@ -833,6 +865,7 @@ void Presenter::Present()
       // Due to depending on guest state, we need to call this every frame.
       SetSuggestedWindowSize(m_xfb_rect.GetWidth(), m_xfb_rect.GetHeight());
     }
+    m_present_return_time = Clock::now();
     return;
   }
 
@@ -867,7 +900,9 @@ void Presenter::Present()
   // Present to the window system.
   {
     std::lock_guard<std::mutex> guard(m_swap_mutex);
+    m_present_call_time = Clock::now();
     g_gfx->PresentBackbuffer();
+    m_present_return_time = Clock::now();
   }
 
   if (m_xfb_entry)
@@ -36,7 +36,8 @@ public:
   Presenter();
   virtual ~Presenter();
 
-  void ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks);
+  void ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks,
+              TimePoint output_time);
   void ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks);
 
   void Present();
@@ -105,6 +106,9 @@ private:
 
   void ProcessFrameDumping(u64 ticks) const;
 
+  // Records when the frame that was just presented passed each stage, for frame pacing analysis
+  void CountFrameTiming(u64 ticks, TimePoint cpu_finish, TimePoint gpu_submit) const;
+
   void OnBackBufferSizeChanged();
 
   // Scales a raw XFB resolution to the target (display) aspect ratio,
@@ -123,6 +127,10 @@ private:
 
   std::mutex m_swap_mutex;
 
+  // Around the last call to the window system's present
+  TimePoint m_present_call_time{};
+  TimePoint m_present_return_time{};
+
   // Backbuffer (window) size and render area
   int m_backbuffer_width = 0;
   int m_backbuffer_height = 0;
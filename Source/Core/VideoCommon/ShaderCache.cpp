@@ -3,11 +3,15 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+#include <tuple>
+
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Trace.h"
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/AbstractGfx.h"
@@ -46,8 +50,12 @@ bool ShaderCache::Initialize()
     return false;
 
   m_async_shader_compiler = g_gfx->CreateAsyncShaderCompiler();
-  m_frame_end_handler = AfterFrameEvent::Register([this](Core::System&) { RetrieveAsyncShaders(); },
-                                                  "RetrieveAsyncShaders");
+  m_frame_end_handler = AfterFrameEvent::Register(
+      [this](Core::System&) {
+        RetrieveAsyncShaders();
+        m_frame_count++;
+      },
+      "RetrieveAsyncShaders");
   return true;
 }
 
@@ -69,7 +77,7 @@ void ShaderCache::InitializeShaderCache()
   // Compile all known UIDs.
   CompileMissingPipelines();
   if (g_ActiveConfig.bWaitForShadersBeforeStarting)
-    WaitForAsyncCompiler();
+    WaitForAsyncCompiler(GetWaitForShadersPriorityLimit());
 
   // Switch to the runtime shader compiler thread configuration.
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
@@ -95,7 +103,7 @@ void ShaderCache::Reload()
   // be recompiled.
   CompileMissingPipelines();
   if (g_ActiveConfig.bWaitForShadersBeforeStarting)
-    WaitForAsyncCompiler();
+    WaitForAsyncCompiler(GetWaitForShadersPriorityLimit());
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
 }
 
@@ -117,16 +125,29 @@ void ShaderCache::Shutdown()
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
   auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  if (it != m_gx_pipeline_cache.end() && !it->second.pending)
+  {
+    if (!it->second.used) [[unlikely]]
+      RecordGXPipelineUse(it->first, it->second);
+    return it->second.pipeline.get();
+  }
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    TRACE_SCOPE("Create pipeline");
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
-  if (g_ActiveConfig.bShaderCache && !exists_in_cache)
-    AppendGXPipelineUID(uid);
+  }
+  if (!exists_in_cache)
+  {
+    it = m_gx_pipeline_cache.try_emplace(uid).first;
+    if (g_ActiveConfig.bShaderCache)
+      it->second.usage_index = AppendGXPipelineUID(uid);
+  }
+  if (!it->second.used)
+    RecordGXPipelineUse(it->first, it->second);
   return InsertGXPipeline(uid, std::move(pipeline));
 }
 
@@ -135,14 +156,19 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
-    // .second is the pending flag, i.e. compiling in the background.
-    if (!it->second.second)
-      return it->second.first.get();
+    if (!it->second.used) [[unlikely]]
+      RecordGXPipelineUse(it->first, it->second);
+
+    // The pending flag means it is compiling in the background.
+    if (!it->second.pending)
+      return it->second.pipeline.get();
     else
       return {};
   }
 
-  AppendGXPipelineUID(uid);
+  auto& entry = m_gx_pipeline_cache[uid];
+  entry.usage_index = AppendGXPipelineUID(uid);
+  RecordGXPipelineUse(uid, entry);
   QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
   return {};
 }
@@ -150,17 +176,26 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
   auto it = m_gx_uber_pipeline_cache.find(uid);
-  if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  if (it != m_gx_uber_pipeline_cache.end() && !it->second.pending)
+  {
+    if (!it->second.used) [[unlikely]]
+      RecordGXUberPipelineUse(it->first, it->second);
+    return it->second.pipeline.get();
+  }
 
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    TRACE_SCOPE("Create pipeline");
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
-  return InsertGXUberPipeline(uid, std::move(pipeline));
+  }
+  const AbstractPipeline* result = InsertGXUberPipeline(uid, std::move(pipeline));
+  RecordGXUberPipelineUse(uid, m_gx_uber_pipeline_cache[uid]);
+  return result;
 }
 
-void ShaderCache::WaitForAsyncCompiler()
+void ShaderCache::WaitForAsyncCompiler(u32 max_priority)
 {
   bool running = true;
 
@@ -187,10 +222,13 @@ void ShaderCache::WaitForAsyncCompiler()
     g_presenter->Present();
   };
 
-  while (running &&
-         (m_async_shader_compiler->HasPendingWork() || m_async_shader_compiler->HasCompletedWork()))
+  // When only waiting for the highest priority work, the remaining items keep completing in the
+  // background, so completed work can't be used as a reason to keep waiting.
+  const bool wait_for_all = max_priority == std::numeric_limits<u32>::max();
+  while (running && (m_async_shader_compiler->HasPendingWork(max_priority) ||
+                     (wait_for_all && m_async_shader_compiler->HasCompletedWork())))
   {
-    running = m_async_shader_compiler->WaitUntilCompletion(update_ui_progress);
+    running = m_async_shader_compiler->WaitUntilCompletion(update_ui_progress, max_priority);
 
     m_async_shader_compiler->RetrieveWorkItems();
   }
@@ -225,46 +263,77 @@ static void UnserializePipelineUid(const SerializedUidType& uid, UidType& real_u
   real_uid.blending_state.hex = uid.blending_state_bits;
 }
 
+static u64 GetDiskCacheSizeLimit()
+{
+  return static_cast<u64>(std::max(g_ActiveConfig.iShaderCacheSizeLimitMB, 0)) * 1024 * 1024;
+}
+
+static void CountCreatedShader(ShaderStage stage)
+{
+  switch (stage)
+  {
+  case ShaderStage::Vertex:
+    INCSTAT(g_stats.num_vertex_shaders_created);
+    INCSTAT(g_stats.num_vertex_shaders_alive);
+    break;
+  case ShaderStage::Pixel:
+    INCSTAT(g_stats.num_pixel_shaders_created);
+    INCSTAT(g_stats.num_pixel_shaders_alive);
+    break;
+  default:
+    break;
+  }
+}
+
 template <ShaderStage stage, typename K, typename T>
 void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type, bool include_gameid)
 {
-  class CacheReader : public Common::LinearDiskCacheReader<K, u8>
+  class CacheReader : public Common::IndexedDiskCacheReader<K, u8>
   {
   public:
-    CacheReader(T& cache_) : cache(cache_) {}
+    CacheReader(ShaderCache* this_ptr_, T& cache_) : this_ptr(this_ptr_), cache(cache_) {}
+    u32 GetLoadedCount() const { return loaded; }
     void Read(const K& key, const u8* value, u32 value_size) override
     {
+      // Per-game caches only reference shaders in the shared cache.
+      if (cache.shared_disk_cache.IsOpen())
+      {
+        if (this_ptr->LoadSharedShader<stage>(cache, key))
+          loaded++;
+        return;
+      }
+
       auto shader = g_gfx->CreateShaderFromBinary(stage, value, value_size);
       if (shader)
       {
         auto& entry = cache.shader_map[key];
         entry.shader = std::move(shader);
         entry.pending = false;
-
-        switch (stage)
-        {
-        case ShaderStage::Vertex:
-          INCSTAT(g_stats.num_vertex_shaders_created);
-          INCSTAT(g_stats.num_vertex_shaders_alive);
-          break;
-        case ShaderStage::Pixel:
-          INCSTAT(g_stats.num_pixel_shaders_created);
-          INCSTAT(g_stats.num_pixel_shaders_alive);
-          break;
-        default:
-          break;
-        }
+        CountCreatedShader(stage);
+        loaded++;
       }
     }
 
   private:
+    ShaderCache* this_ptr;
     T& cache;
+    u32 loaded = 0;
   };
 
+  if (include_gameid)
+  {
+    const std::string shared_filename = GetDiskShaderCacheFileName(api_type, type, false, true);
+    cache.shared_disk_cache.SetSizeLimit(GetDiskCacheSizeLimit());
+    const u32 shared_count = cache.shared_disk_cache.Open(shared_filename);
+    INFO_LOG_FMT(VIDEO, "Opened shared shader cache {} with {} shaders", shared_filename,
+                 shared_count);
+  }
+
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
-  CacheReader reader(cache);
-  u32 count = cache.disk_cache.OpenAndRead(filename, reader);
-  INFO_LOG_FMT(VIDEO, "Loaded {} cached shaders from {}", count, filename);
+  CacheReader reader(this, cache);
+  cache.disk_cache.SetSizeLimit(GetDiskCacheSizeLimit());
+  cache.disk_cache.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(VIDEO, "Loaded {} cached shaders from {}", reader.GetLoadedCount(), filename);
 }
 
 template <typename T>
@@ -272,14 +341,70 @@ void ShaderCache::ClearShaderCache(T& cache)
 {
   cache.disk_cache.Sync();
   cache.disk_cache.Close();
+  cache.shared_disk_cache.Sync();
+  cache.shared_disk_cache.Close();
   cache.shader_map.clear();
 }
 
+template <ShaderStage stage, typename K, typename T>
+const AbstractShader* ShaderCache::LoadSharedShader(T& cache, const K& uid)
+{
+  if (!cache.shared_disk_cache.IsOpen())
+    return nullptr;
+
+  std::unique_ptr<AbstractShader> shader;
+  cache.shared_disk_cache.Lookup({m_driver_fingerprint, uid}, [&](const u8* value, u32 size) {
+    shader = g_gfx->CreateShaderFromBinary(stage, value, size);
+  });
+  if (!shader)
+    return nullptr;
+
+  // Shaders first compiled by other games are referenced by this game from now on.
+  if (!cache.disk_cache.Contains(uid))
+    cache.disk_cache.Append(uid, nullptr, 0);
+
+  auto& entry = cache.shader_map[uid];
+  entry.shader = std::move(shader);
+  entry.pending = false;
+  CountCreatedShader(stage);
+  return entry.shader.get();
+}
+
+template <typename K, typename T>
+void ShaderCache::AppendShaderBinary(T& cache, const K& uid, const AbstractShader& shader)
+{
+  if (!g_ActiveConfig.bShaderCache || !g_ActiveConfig.backend_info.bSupportsShaderBinaries)
+    return;
+
+  const auto binary = shader.GetBinary();
+  if (binary.empty())
+    return;
+
+  if (cache.shared_disk_cache.IsOpen())
+  {
+    cache.shared_disk_cache.Append({m_driver_fingerprint, uid}, binary.data(),
+                                   static_cast<u32>(binary.size()));
+    cache.disk_cache.Append(uid, nullptr, 0);
+  }
+  else
+  {
+    cache.disk_cache.Append(uid, binary.data(), static_cast<u32>(binary.size()));
+  }
+}
+
+template <typename K, typename T>
+void ShaderCache::TouchShader(T& cache, const K& uid)
+{
+  cache.disk_cache.Touch(uid);
+  if (cache.shared_disk_cache.IsOpen())
+    cache.shared_disk_cache.Touch({m_driver_fingerprint, uid});
+}
+
 template <typename KeyType, typename DiskKeyType, typename T>
-void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyType, u8>& disk_cache,
+void ShaderCache::LoadPipelineCache(T& cache, Common::IndexedDiskCache<DiskKeyType, u8>& disk_cache,
                                     APIType api_type, const char* type, bool include_gameid)
 {
-  class CacheReader : public Common::LinearDiskCacheReader<DiskKeyType, u8>
+  class CacheReader : public Common::IndexedDiskCacheReader<DiskKeyType, u8>
   {
   public:
     CacheReader(ShaderCache* this_ptr_, T& cache_) : this_ptr(this_ptr_), cache(cache_) {}
@@ -306,8 +431,8 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
       }
 
       auto& entry = cache[real_uid];
-      entry.first = std::move(pipeline);
-      entry.second = false;
+      entry.pipeline = std::move(pipeline);
+      entry.pending = false;
     }
 
   private:
@@ -318,6 +443,7 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
   CacheReader reader(this, cache);
+  disk_cache.SetSizeLimit(GetDiskCacheSizeLimit());
   const u32 count = disk_cache.OpenAndRead(filename, reader);
   INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, filename);
 
@@ -344,13 +470,15 @@ void ShaderCache::ClearPipelineCache(T& cache, Y& disk_cache)
   // Set the pending flag to false, and destroy the pipeline.
   for (auto& it : cache)
   {
-    it.second.first.reset();
-    it.second.second = false;
+    it.second.pipeline.reset();
+    it.second.pending = false;
   }
 }
 
 void ShaderCache::LoadCaches()
 {
+  m_driver_fingerprint = DriverDetails::GetFingerprint();
+
   // Ubershader caches, if present.
   if (g_ActiveConfig.backend_info.bSupportsShaderBinaries)
   {
@@ -417,21 +545,55 @@ void ShaderCache::ClearCaches()
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
-  for (auto& it : m_gx_pipeline_cache)
+  // Queue all uids with a null pipeline for compilation. Pipelines which previous sessions needed
+  // early, and in the most sessions, are queued first. They are grouped by the second in which
+  // they were first used, as the exact frame varies between sessions.
+  constexpr u32 FIRST_USE_FRAME_GRANULARITY = 60;
+  const auto get_rank = [this](const PipelineCacheEntry& entry) {
+    const PipelineUsage usage = entry.usage_index < m_gx_pipeline_usage.size() ?
+                                    m_gx_pipeline_usage[entry.usage_index] :
+                                    PipelineUsage{};
+    return std::make_tuple(usage.first_use_frame / FIRST_USE_FRAME_GRANULARITY,
+                           std::numeric_limits<u32>::max() - usage.num_sessions);
+  };
+
+  std::vector<decltype(m_gx_pipeline_cache)::iterator> missing_pipelines;
+  for (auto it = m_gx_pipeline_cache.begin(); it != m_gx_pipeline_cache.end(); ++it)
+  {
+    if (!it->second.pipeline)
+      missing_pipelines.push_back(it);
+  }
+  std::stable_sort(missing_pipelines.begin(), missing_pipelines.end(),
+                   [&get_rank](const auto& lhs, const auto& rhs) {
+                     return get_rank(lhs->second) < get_rank(rhs->second);
+                   });
+  for (size_t i = 0; i < missing_pipelines.size(); i++)
   {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+    QueuePipelineCompile(missing_pipelines[i]->first,
+                         COMPILE_PRIORITY_SHADERCACHE_PIPELINE + static_cast<u32>(i));
   }
+
   for (auto& it : m_gx_uber_pipeline_cache)
   {
-    if (!it.second.first)
+    if (!it.second.pipeline)
       QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
   }
 }
 
+u32 ShaderCache::GetWaitForShadersPriorityLimit() const
+{
+  // Pipelines left in the queue are only compiled if there are compiler threads at runtime.
+  const int pipeline_count = g_ActiveConfig.iWaitForShadersPipelineCount;
+  if (pipeline_count <= 0 || g_ActiveConfig.GetShaderCompilerThreads() == 0)
+    return std::numeric_limits<u32>::max();
+
+  return COMPILE_PRIORITY_SHADERCACHE_PIPELINE + static_cast<u32>(pipeline_count) - 1;
+}
+
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
 {
+  TRACE_SCOPE("Compile vertex shader");
+
   const ShaderCode source_code =
       GenerateVertexShaderCode(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer());
@@ -440,6 +602,8 @@ std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexSha
 std::unique_ptr<AbstractShader>
 ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) const
 {
+  TRACE_SCOPE("Compile vertex uber shader");
+
   const ShaderCode source_code =
       UberShader::GenVertexShader(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer(),
@@ -448,6 +612,8 @@ ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) con
 
 std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShaderUid& uid) const
 {
+  TRACE_SCOPE("Compile pixel shader");
+
   const ShaderCode source_code =
       GeneratePixelShaderCode(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer());
@@ -456,6 +622,8 @@ std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShade
 std::unique_ptr<AbstractShader>
 ShaderCache::CompilePixelUberShader(const UberShader::PixelShaderUid& uid) const
 {
+  TRACE_SCOPE("Compile pixel uber shader");
+
   const ShaderCode source_code =
       UberShader::GenPixelShader(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer(),
@@ -470,12 +638,7 @@ const AbstractShader* ShaderCache::InsertVertexShader(const VertexShaderUid& uid
 
   if (shader && !entry.shader)
   {
-    if (g_ActiveConfig.bShaderCache && g_ActiveConfig.backend_info.bSupportsShaderBinaries)
-    {
-      auto binary = shader->GetBinary();
-      if (!binary.empty())
-        m_vs_cache.disk_cache.Append(uid, binary.data(), static_cast<u32>(binary.size()));
-    }
+    AppendShaderBinary(m_vs_cache, uid, *shader);
     INCSTAT(g_stats.num_vertex_shaders_created);
     INCSTAT(g_stats.num_vertex_shaders_alive);
     entry.shader = std::move(shader);
@@ -492,12 +655,7 @@ const AbstractShader* ShaderCache::InsertVertexUberShader(const UberShader::Vert
 
   if (shader && !entry.shader)
   {
-    if (g_ActiveConfig.bShaderCache && g_ActiveConfig.backend_info.bSupportsShaderBinaries)
-    {
-      auto binary = shader->GetBinary();
-      if (!binary.empty())
-        m_uber_vs_cache.disk_cache.Append(uid, binary.data(), static_cast<u32>(binary.size()));
-    }
+    AppendShaderBinary(m_uber_vs_cache, uid, *shader);
     INCSTAT(g_stats.num_vertex_shaders_created);
     INCSTAT(g_stats.num_vertex_shaders_alive);
     entry.shader = std::move(shader);
@@ -514,12 +672,7 @@ const AbstractShader* ShaderCache::InsertPixelShader(const PixelShaderUid& uid,
 
   if (shader && !entry.shader)
   {
-    if (g_ActiveConfig.bShaderCache && g_ActiveConfig.backend_info.bSupportsShaderBinaries)
-    {
-      auto binary = shader->GetBinary();
-      if (!binary.empty())
-        m_ps_cache.disk_cache.Append(uid, binary.data(), static_cast<u32>(binary.size()));
-    }
+    AppendShaderBinary(m_ps_cache, uid, *shader);
     INCSTAT(g_stats.num_pixel_shaders_created);
     INCSTAT(g_stats.num_pixel_shaders_alive);
     entry.shader = std::move(shader);
@@ -536,12 +689,7 @@ const AbstractShader* ShaderCache::InsertPixelUberShader(const UberShader::Pixel
 
   if (shader && !entry.shader)
   {
-    if (g_ActiveConfig.bShaderCache && g_ActiveConfig.backend_info.bSupportsShaderBinaries)
-    {
-      auto binary = shader->GetBinary();
-      if (!binary.empty())
-        m_uber_ps_cache.disk_cache.Append(uid, binary.data(), static_cast<u32>(binary.size()));
-    }
+    AppendShaderBinary(m_uber_ps_cache, uid, *shader);
     INCSTAT(g_stats.num_pixel_shaders_created);
     INCSTAT(g_stats.num_pixel_shaders_alive);
     entry.shader = std::move(shader);
@@ -563,12 +711,7 @@ const AbstractShader* ShaderCache::CreateGeometryShader(const GeometryShaderUid&
 
   if (shader && !entry.shader)
   {
-    if (g_ActiveConfig.bShaderCache && g_ActiveConfig.backend_info.bSupportsShaderBinaries)
-    {
-      auto binary = shader->GetBinary();
-      if (!binary.empty())
-        m_gs_cache.disk_cache.Append(uid, binary.data(), static_cast<u32>(binary.size()));
-    }
+    AppendShaderBinary(m_gs_cache, uid, *shader);
     entry.shader = std::move(shader);
   }
 
@@ -745,7 +888,7 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
   auto vs_iter = m_vs_cache.shader_map.find(config.vs_uid);
   if (vs_iter != m_vs_cache.shader_map.end() && !vs_iter->second.pending)
     vs = vs_iter->second.shader.get();
-  else
+  else if (!(vs = LoadSharedShader<ShaderStage::Vertex>(m_vs_cache, config.vs_uid)))
     vs = InsertVertexShader(config.vs_uid, CompileVertexShader(config.vs_uid));
 
   PixelShaderUid ps_uid = config.ps_uid;
@@ -755,7 +898,7 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
   auto ps_iter = m_ps_cache.shader_map.find(ps_uid);
   if (ps_iter != m_ps_cache.shader_map.end() && !ps_iter->second.pending)
     ps = ps_iter->second.shader.get();
-  else
+  else if (!(ps = LoadSharedShader<ShaderStage::Pixel>(m_ps_cache, ps_uid)))
     ps = InsertPixelShader(ps_uid, CompilePixelShader(ps_uid));
 
   if (!vs || !ps)
@@ -873,14 +1016,14 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
                                                       std::unique_ptr<AbstractPipeline> pipeline)
 {
   auto& entry = m_gx_pipeline_cache[config];
-  entry.second = false;
-  if (!entry.first && pipeline)
+  entry.pending = false;
+  if (!entry.pipeline && pipeline)
   {
-    entry.first = std::move(pipeline);
+    entry.pipeline = std::move(pipeline);
 
     if (g_ActiveConfig.bShaderCache)
     {
-      auto cache_data = entry.first->GetCacheData();
+      auto cache_data = entry.pipeline->GetCacheData();
       if (!cache_data.empty())
       {
         SerializedGXPipelineUid disk_uid;
@@ -891,7 +1034,7 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
     }
   }
 
-  return entry.first.get();
+  return entry.pipeline.get();
 }
 
 const AbstractPipeline*
@@ -899,14 +1042,14 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
                                   std::unique_ptr<AbstractPipeline> pipeline)
 {
   auto& entry = m_gx_uber_pipeline_cache[config];
-  entry.second = false;
-  if (!entry.first && pipeline)
+  entry.pending = false;
+  if (!entry.pipeline && pipeline)
   {
-    entry.first = std::move(pipeline);
+    entry.pipeline = std::move(pipeline);
 
     if (g_ActiveConfig.bShaderCache)
     {
-      auto cache_data = entry.first->GetCacheData();
+      auto cache_data = entry.pipeline->GetCacheData();
       if (!cache_data.empty())
       {
         SerializedGXUberPipelineUid disk_uid;
@@ -917,15 +1060,18 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
     }
   }
 
-  return entry.first.get();
+  return entry.pipeline.get();
 }
 
 void ShaderCache::LoadPipelineUIDCache()
 {
   constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
   constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  const std::string filename_prefix =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID();
+  const std::string filename = filename_prefix + ".uidcache";
+  m_gx_pipeline_usage_filename = filename_prefix + ".uidusage";
+  m_gx_pipeline_usage.clear();
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
@@ -952,7 +1098,7 @@ void ShaderCache::LoadPipelineUIDCache()
           if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
           {
             // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
+            AddSerializedGXPipelineUID(serialized_uid, static_cast<u32>(i));
           }
           else
           {
@@ -965,11 +1111,21 @@ void ShaderCache::LoadPipelineUIDCache()
       // We open the file for reading and writing, so we must seek to the end before writing.
       if (uid_file_valid)
         uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+
+      // Usage records are indexed by the position of the UID in the file.
+      if (uid_file_valid)
+      {
+        m_gx_pipeline_usage.resize(uid_count);
+        LoadPipelineUsage(m_gx_pipeline_usage_filename);
+      }
     }
 
     // If the file is invalid, close it. We re-open and truncate it below.
     if (!uid_file_valid)
+    {
       m_gx_pipeline_uid_cache_file.Close();
+      m_gx_pipeline_usage.clear();
+    }
   }
 
   // If the file is not open, it means it was either corrupted or didn't exist.
@@ -985,8 +1141,8 @@ void ShaderCache::LoadPipelineUIDCache()
       // Write any current UIDs out to the file.
       // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
       // we don't lose the existing UIDs which were previously at the beginning.
-      for (const auto& it : m_gx_pipeline_cache)
-        AppendGXPipelineUID(it.first);
+      for (auto& it : m_gx_pipeline_cache)
+        it.second.usage_index = AppendGXPipelineUID(it.first);
     }
   }
 
@@ -995,11 +1151,59 @@ void ShaderCache::LoadPipelineUIDCache()
 
 void ShaderCache::ClosePipelineUIDCache()
 {
-  // This is left as a method in case we need to append extra data to the file in the future.
+  if (m_gx_pipeline_uid_cache_file.IsOpen())
+    SavePipelineUsage(m_gx_pipeline_usage_filename);
+
   m_gx_pipeline_uid_cache_file.Close();
+  m_gx_pipeline_usage.clear();
+}
+
+namespace
+{
+constexpr u32 PIPELINE_USAGE_FILE_MAGIC = 0x45535550;  // PUSE
+constexpr u32 PIPELINE_USAGE_FILE_VERSION = 1;
+}  // namespace
+
+void ShaderCache::LoadPipelineUsage(const std::string& filename)
+{
+  File::IOFile file(filename, "rb");
+  u32 magic = 0;
+  u32 version = 0;
+  u32 count = 0;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      !file.ReadBytes(&count, sizeof(count)) || magic != PIPELINE_USAGE_FILE_MAGIC ||
+      version != PIPELINE_USAGE_FILE_VERSION)
+  {
+    return;
+  }
+
+  // The usage file is only written on shutdown, so it may be missing records for UIDs that were
+  // appended to the UID cache afterwards. Those are treated as never having been used.
+  const size_t usage_count = std::min<size_t>(count, m_gx_pipeline_usage.size());
+  if (!file.ReadArray(m_gx_pipeline_usage.data(), usage_count))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to read pipeline usage from {}, ignoring.", filename);
+    std::fill(m_gx_pipeline_usage.begin(), m_gx_pipeline_usage.end(), PipelineUsage{});
+    return;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read usage of {} pipeline UIDs from {}", usage_count, filename);
+}
+
+void ShaderCache::SavePipelineUsage(const std::string& filename) const
+{
+  const u32 count = static_cast<u32>(m_gx_pipeline_usage.size());
+  File::IOFile file(filename, "wb");
+  if (!file.WriteBytes(&PIPELINE_USAGE_FILE_MAGIC, sizeof(PIPELINE_USAGE_FILE_MAGIC)) ||
+      !file.WriteBytes(&PIPELINE_USAGE_FILE_VERSION, sizeof(PIPELINE_USAGE_FILE_VERSION)) ||
+      !file.WriteBytes(&count, sizeof(count)) ||
+      !file.WriteArray(m_gx_pipeline_usage.data(), m_gx_pipeline_usage.size()))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing pipeline usage to {} failed.", filename);
+  }
 }
 
-void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
+void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid, u32 usage_index)
 {
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
@@ -1010,13 +1214,14 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 
   // Flag it as empty with a null pipeline object, for later compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
-  entry.second = false;
+  entry.pending = false;
+  entry.usage_index = usage_index;
 }
 
-void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
+u32 ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
 {
   if (!m_gx_pipeline_uid_cache_file.IsOpen())
-    return;
+    return INVALID_USAGE_INDEX;
 
   SerializedGXPipelineUid disk_uid;
   SerializePipelineUid(config, disk_uid);
@@ -1024,7 +1229,54 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   {
     WARN_LOG_FMT(VIDEO, "Writing pipeline UID to cache failed, closing file.");
     m_gx_pipeline_uid_cache_file.Close();
+    return INVALID_USAGE_INDEX;
   }
+
+  m_gx_pipeline_usage.emplace_back();
+  return static_cast<u32>(m_gx_pipeline_usage.size() - 1);
+}
+
+void ShaderCache::RecordGXPipelineUse(const GXPipelineUid& uid, PipelineCacheEntry& entry)
+{
+  entry.used = true;
+
+  // Keep the pipeline and its shaders from being evicted from the disk caches.
+  SerializedGXPipelineUid disk_uid;
+  SerializePipelineUid(uid, disk_uid);
+  m_gx_pipeline_disk_cache.Touch(disk_uid);
+
+  // The shaders are cached under the UIDs GetGXPipelineConfig compiles them with.
+  const GXPipelineUid config = ApplyDriverBugs(uid);
+  PixelShaderUid ps_uid = config.ps_uid;
+  ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
+  TouchShader(m_vs_cache, config.vs_uid);
+  TouchShader(m_ps_cache, ps_uid);
+  if (NeedsGeometryShader(config.gs_uid))
+    TouchShader(m_gs_cache, config.gs_uid);
+
+  if (entry.usage_index >= m_gx_pipeline_usage.size())
+    return;
+
+  PipelineUsage& usage = m_gx_pipeline_usage[entry.usage_index];
+  usage.first_use_frame = std::min(usage.first_use_frame, m_frame_count);
+  usage.num_sessions++;
+}
+
+void ShaderCache::RecordGXUberPipelineUse(const GXUberPipelineUid& uid, PipelineCacheEntry& entry)
+{
+  entry.used = true;
+
+  SerializedGXUberPipelineUid disk_uid;
+  SerializePipelineUid(uid, disk_uid);
+  m_gx_uber_pipeline_disk_cache.Touch(disk_uid);
+
+  const GXUberPipelineUid config = ApplyDriverBugs(uid);
+  UberShader::PixelShaderUid ps_uid = config.ps_uid;
+  UberShader::ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
+  TouchShader(m_uber_vs_cache, config.vs_uid);
+  TouchShader(m_uber_ps_cache, ps_uid);
+  if (NeedsGeometryShader(config.gs_uid))
+    TouchShader(m_gs_cache, config.gs_uid);
 }
 
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
@@ -1051,6 +1303,9 @@ void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 prior
     VertexShaderUid uid;
   };
 
+  if (LoadSharedShader<ShaderStage::Vertex>(m_vs_cache, uid))
+    return;
+
   m_vs_cache.shader_map[uid].pending = true;
   auto wi = m_async_shader_compiler->CreateWorkItem<VertexShaderWorkItem>(this, uid);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
@@ -1109,6 +1364,9 @@ void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priorit
     PixelShaderUid uid;
   };
 
+  if (LoadSharedShader<ShaderStage::Pixel>(m_ps_cache, uid))
+    return;
+
   m_ps_cache.shader_map[uid].pending = true;
   auto wi = m_async_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(this, uid);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
@@ -1163,18 +1421,25 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
 
       GXPipelineUid actual_uid = ApplyDriverBugs(uid);
 
+      // Queueing may load the shader from the shared cache right away.
       auto vs_it = shader_cache->m_vs_cache.shader_map.find(actual_uid.vs_uid);
-      stages_ready &= vs_it != shader_cache->m_vs_cache.shader_map.end() && !vs_it->second.pending;
       if (vs_it == shader_cache->m_vs_cache.shader_map.end())
+      {
         shader_cache->QueueVertexShaderCompile(actual_uid.vs_uid, priority);
+        vs_it = shader_cache->m_vs_cache.shader_map.find(actual_uid.vs_uid);
+      }
+      stages_ready &= vs_it != shader_cache->m_vs_cache.shader_map.end() && !vs_it->second.pending;
 
       PixelShaderUid ps_uid = actual_uid.ps_uid;
       ClearUnusedPixelShaderUidBits(shader_cache->m_api_type, shader_cache->m_host_config, &ps_uid);
 
       auto ps_it = shader_cache->m_ps_cache.shader_map.find(ps_uid);
-      stages_ready &= ps_it != shader_cache->m_ps_cache.shader_map.end() && !ps_it->second.pending;
       if (ps_it == shader_cache->m_ps_cache.shader_map.end())
+      {
         shader_cache->QueuePixelShaderCompile(ps_uid, priority);
+        ps_it = shader_cache->m_ps_cache.shader_map.find(ps_uid);
+      }
+      stages_ready &= ps_it != shader_cache->m_ps_cache.shader_map.end() && !ps_it->second.pending;
 
       return stages_ready;
     }
@@ -1182,7 +1447,10 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     bool Compile() override
     {
       if (config)
+      {
+        TRACE_SCOPE("Create pipeline");
         pipeline = g_gfx->CreatePipeline(*config);
+      }
       return true;
     }
 
@@ -1212,7 +1480,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
-  m_gx_pipeline_cache[uid].second = true;
+  m_gx_pipeline_cache[uid].pending = true;
 }
 
 void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority)
@@ -1257,7 +1525,10 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
     bool Compile() override
     {
       if (config)
+      {
+        TRACE_SCOPE("Create pipeline");
         UberPipeline = g_gfx->CreatePipeline(*config);
+      }
       return true;
     }
 
@@ -1287,7 +1558,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
 
   auto wi = m_async_shader_compiler->CreateWorkItem<UberPipelineWorkItem>(this, uid, priority);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
-  m_gx_uber_pipeline_cache[uid].second = true;
+  m_gx_uber_pipeline_cache[uid].pending = true;
 }
 
 void ShaderCache::QueueUberShaderPipelines()
@@ -1325,7 +1596,7 @@ void ShaderCache::QueueUberShaderPipelines()
           return;
 
         auto& entry = m_gx_uber_pipeline_cache[config];
-        entry.second = false;
+        entry.pending = false;
       };
 
   // Populate the pipeline configs with empty entries, these will be compiled afterwards.
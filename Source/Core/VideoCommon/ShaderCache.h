@@ -6,16 +6,18 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
-#include "Common/LinearDiskCache.h"
+#include "Common/IndexedDiskCache.h"
 
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/AbstractShader.h"
@@ -116,12 +118,35 @@ public:
 
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
+  static constexpr u32 INVALID_USAGE_INDEX = std::numeric_limits<u32>::max();
 
-  void WaitForAsyncCompiler();
+  struct PipelineCacheEntry
+  {
+    std::unique_ptr<AbstractPipeline> pipeline;
+    bool pending = false;
+
+    // Set once the pipeline and its shaders were touched in the disk caches this session.
+    bool used = false;
+    // Specialized pipelines only. The position of the UID in the UID cache file, and the index
+    // into m_gx_pipeline_usage.
+    u32 usage_index = INVALID_USAGE_INDEX;
+  };
+
+  // How a pipeline was used in previous sessions, saved alongside the UID cache.
+  struct PipelineUsage
+  {
+    u32 first_use_frame = std::numeric_limits<u32>::max();
+    u32 num_sessions = 0;
+  };
+
+  void WaitForAsyncCompiler(u32 max_priority = std::numeric_limits<u32>::max());
+  u32 GetWaitForShadersPriorityLimit() const;
   void LoadCaches();
   void ClearCaches();
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
+  void LoadPipelineUsage(const std::string& filename);
+  void SavePipelineUsage(const std::string& filename) const;
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
@@ -159,8 +184,10 @@ private:
                                            std::unique_ptr<AbstractPipeline> pipeline);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
                                                std::unique_ptr<AbstractPipeline> pipeline);
-  void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
-  void AppendGXPipelineUID(const GXPipelineUid& config);
+  void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid, u32 usage_index);
+  u32 AppendGXPipelineUID(const GXPipelineUid& config);
+  void RecordGXPipelineUse(const GXPipelineUid& uid, PipelineCacheEntry& entry);
+  void RecordGXUberPipelineUse(const GXUberPipelineUid& uid, PipelineCacheEntry& entry);
 
   // ASync Compiler Methods
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
@@ -175,8 +202,14 @@ private:
   void LoadShaderCache(T& cache, APIType api_type, const char* type, bool include_gameid);
   template <typename T>
   void ClearShaderCache(T& cache);
+  template <ShaderStage stage, typename K, typename T>
+  const AbstractShader* LoadSharedShader(T& cache, const K& uid);
+  template <typename K, typename T>
+  void AppendShaderBinary(T& cache, const K& uid, const AbstractShader& shader);
+  template <typename K, typename T>
+  void TouchShader(T& cache, const K& uid);
   template <typename KeyType, typename DiskKeyType, typename T>
-  void LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyType, u8>& disk_cache,
+  void LoadPipelineCache(T& cache, Common::IndexedDiskCache<DiskKeyType, u8>& disk_cache,
                          APIType api_type, const char* type, bool include_gameid);
   template <typename T, typename Y>
   void ClearPipelineCache(T& cache, Y& disk_cache);
@@ -184,7 +217,8 @@ private:
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
+  // for as few frames as possible, otherwise we risk framerate drops. Pipelines from the shader
+  // cache are offset from COMPILE_PRIORITY_SHADERCACHE_PIPELINE by their usage rank.
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
@@ -195,6 +229,7 @@ private:
   // Configuration bits.
   APIType m_api_type;
   ShaderHostConfig m_host_config = {};
+  u32 m_driver_fingerprint = 0;
   std::unique_ptr<AsyncShaderCompiler> m_async_shader_compiler;
 
   // Shared shaders
@@ -207,16 +242,31 @@ private:
   std::unique_ptr<AbstractShader> m_color_pixel_shader;
 
   // GX Shader Caches
+  // Specialized shaders are stored in a disk cache shared between games, keyed by UID and driver,
+  // so that games sharing an engine can reuse each other's shaders. The per-game disk cache only
+  // holds references (keys with empty values) to the shaders the game has used.
+#pragma pack(push, 1)
+  template <typename Uid>
+  struct SharedShaderKey
+  {
+    u32 driver_fingerprint;
+    Uid uid;
+  };
+#pragma pack(pop)
   template <typename Uid>
   struct ShaderModuleCache
   {
+    static_assert(sizeof(SharedShaderKey<Uid>) == sizeof(u32) + sizeof(Uid),
+                  "Shared shader keys must not contain padding, as they are hashed as bytes");
+
     struct Shader
     {
       std::unique_ptr<AbstractShader> shader;
       bool pending = false;
     };
     std::map<Uid, Shader> shader_map;
-    Common::LinearDiskCache<Uid, u8> disk_cache;
+    Common::IndexedDiskCache<Uid, u8> disk_cache;
+    Common::IndexedDiskCache<SharedShaderKey<Uid>, u8> shared_disk_cache;
   };
   ShaderModuleCache<VertexShaderUid> m_vs_cache;
   ShaderModuleCache<GeometryShaderUid> m_gs_cache;
@@ -224,13 +274,15 @@ private:
   ShaderModuleCache<UberShader::VertexShaderUid> m_uber_vs_cache;
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
-  // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
-      m_gx_uber_pipeline_cache;
+  // GX Pipeline Caches
+  std::map<GXPipelineUid, PipelineCacheEntry> m_gx_pipeline_cache;
+  std::map<GXUberPipelineUid, PipelineCacheEntry> m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
-  Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
-  Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
+  std::string m_gx_pipeline_usage_filename;
+  std::vector<PipelineUsage> m_gx_pipeline_usage;
+  u32 m_frame_count = 0;
+  Common::IndexedDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
+  Common::IndexedDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
@@ -12,6 +12,7 @@
 #include "Core/HW/SystemTimers.h"
 #include "Core/System.h"
 
+#include "VideoCommon/Assets/CustomAssetLoader.h"
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -90,6 +91,25 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Texture index hits", "%d", this_frame.num_texture_index_hits);
+  draw_statistic("Texture hashes skipped", "%d", this_frame.num_texture_hashes_skipped);
+  draw_statistic("Textures decoded ahead", "%d", this_frame.num_textures_decoded_ahead);
+  draw_statistic("Textures decoded on GPU", "%d", this_frame.num_textures_decoded_on_gpu);
+  if (g_ActiveConfig.bHiresTextures)
+  {
+    const auto streaming = Core::System::GetInstance().GetCustomAssetLoader().GetStreamingStats();
+    draw_statistic("Custom texture hits", "%d/%d", this_frame.num_custom_texture_hits,
+                   this_frame.num_custom_texture_hits + this_frame.num_custom_texture_misses);
+    draw_statistic("Custom textures unloaded", "%llu",
+                   static_cast<unsigned long long>(streaming.textures_unloaded));
+    draw_statistic("Custom texture memory", "%zu/%zu MiB", streaming.bytes_loaded / 1024 / 1024,
+                   streaming.memory_budget / 1024 / 1024);
+  }
+  if (g_ActiveConfig.bGraphicMods)
+  {
+    draw_statistic("Graphics mod lookups", "%d (%d us)", this_frame.num_graphics_mod_lookups,
+                   this_frame.graphics_mod_lookup_ns / 1000);
+  }
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
@@ -112,6 +132,22 @@ void Statistics::Display() const
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
+  draw_statistic("EFB copy readback stalls:", "%d", this_frame.num_efb_copy_readback_stalls);
+  draw_statistic("EFB copy readback stalls avoided:", "%d",
+                 this_frame.num_efb_copy_readback_stalls_avoided);
+  draw_statistic("EFB peek cache hits:", "%d/%d", this_frame.num_efb_peek_cache_hits,
+                 this_frame.num_efb_peek_cache_hits + this_frame.num_efb_peek_cache_misses);
+  draw_statistic("EFB peek tiles prefetched:", "%d", this_frame.num_efb_peek_tiles_prefetched);
+  draw_statistic("EFB peek stall time:", "%d us", this_frame.efb_peek_stall_us);
+  if (g_ActiveConfig.bBBoxEnable)
+  {
+    draw_statistic("BBox readback stalls:", "%d", this_frame.num_bbox_readback_stalls);
+    draw_statistic("BBox reads exact/speculated:", "%d/%d", this_frame.num_bbox_reads_exact,
+                   this_frame.num_bbox_reads_speculated);
+    draw_statistic("BBox speculation hits:", "%d/%d", this_frame.num_bbox_speculation_hits,
+                   this_frame.num_bbox_speculation_hits +
+                       this_frame.num_bbox_speculation_misses);
+  }
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
 
@@ -505,3 +541,31 @@ void Statistics::DisplayScissor()
 
   ImGui::End();
 }
+
+// The innermost running timer of the thread, which is paused while a nested one runs.
+static thread_local GPUThreadPartTimer* s_current_timer = nullptr;
+
+GPUThreadPartTimer::GPUThreadPartTimer(GPUThreadPart part) : m_part(part)
+{
+  if (!g_stats.time_gpu_thread_parts)
+    return;
+
+  m_start = Clock::now();
+  m_outer = std::exchange(s_current_timer, this);
+  if (m_outer)
+    g_stats.gpu_thread_part_time[m_outer->m_part] += m_start - m_outer->m_start;
+  m_running = true;
+}
+
+void GPUThreadPartTimer::Stop()
+{
+  if (!m_running)
+    return;
+
+  const Clock::time_point now = Clock::now();
+  g_stats.gpu_thread_part_time[m_part] += now - m_start;
+  s_current_timer = m_outer;
+  if (m_outer)
+    m_outer->m_start = now;
+  m_running = false;
+}
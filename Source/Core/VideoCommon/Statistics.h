@@ -4,10 +4,22 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <vector>
 
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
 #include "VideoCommon/BPFunctions.h"
 
+// Parts of the GPU thread which benchmarks time.
+enum class GPUThreadPart
+{
+  OpcodeDecoding,
+  VertexLoading,
+  TextureDecoding,
+  Drawing,
+};
+
 struct Statistics
 {
   int num_pixel_shaders_created = 0;
@@ -61,6 +73,15 @@ struct Statistics
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
     int bytes_uniform_streamed = 0;
+    int num_texture_index_hits = 0;
+    int num_texture_hashes_skipped = 0;
+    int num_textures_decoded_ahead = 0;
+    int num_textures_decoded_on_gpu = 0;
+    int num_custom_texture_hits = 0;
+    int num_custom_texture_misses = 0;
+    int num_graphics_mod_lookups = 0;
+    // Only measured while the statistics are shown
+    int graphics_mod_lookup_ns = 0;
 
     int num_triangles_clipped = 0;
     int num_triangles_in = 0;
@@ -75,12 +96,30 @@ struct Statistics
 
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
+    int num_efb_copy_readback_stalls = 0;
+    int num_efb_copy_readback_stalls_avoided = 0;
+    int num_efb_peek_cache_hits = 0;
+    int num_efb_peek_cache_misses = 0;
+    int num_efb_peek_tiles_prefetched = 0;
+    int efb_peek_stall_us = 0;
+
+    int num_bbox_readback_stalls = 0;
+    int num_bbox_reads_exact = 0;
+    int num_bbox_reads_speculated = 0;
+    int num_bbox_speculation_hits = 0;
+    int num_bbox_speculation_misses = 0;
 
     int num_draw_done = 0;
     int num_token = 0;
     int num_token_int = 0;
   };
   ThisFrame this_frame;
+
+  // Time the GPU thread spent in each part while timing was enabled. Unlike this_frame, these are
+  // never reset, so benchmarks take the difference over a run.
+  bool time_gpu_thread_parts = false;
+  Common::EnumMap<std::chrono::nanoseconds, GPUThreadPart::Drawing> gpu_thread_part_time{};
+
   void ResetFrame();
   void SwapDL();
   void AddScissorRect();
@@ -91,6 +130,29 @@ struct Statistics
 
 extern Statistics g_stats;
 
+// Adds the time until it is stopped or destroyed to Statistics::gpu_thread_part_time, when timing
+// is enabled. Time spent in a part nested inside another one only counts towards the inner part.
+class GPUThreadPartTimer
+{
+public:
+  explicit GPUThreadPartTimer(GPUThreadPart part);
+  ~GPUThreadPartTimer() { Stop(); }
+
+  GPUThreadPartTimer(const GPUThreadPartTimer&) = delete;
+  GPUThreadPartTimer& operator=(const GPUThreadPartTimer&) = delete;
+
+  // Timers must be stopped in the reverse order they were started in.
+  void Stop();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  GPUThreadPart m_part;
+  bool m_running = false;
+  GPUThreadPartTimer* m_outer = nullptr;
+  Clock::time_point m_start;
+};
+
 #define STATISTICS
 
 #ifdef STATISTICS
@@ -4,6 +4,7 @@
 #include "VideoCommon/TextureCacheBase.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <memory>
@@ -39,6 +40,7 @@
 #include "VideoCommon/Assets/CustomTextureData.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUProfiler.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
@@ -92,6 +94,7 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
 TextureCacheBase::TextureCacheBase()
 {
   SetBackupConfig(g_ActiveConfig);
+  m_decode_pool.Start(g_ActiveConfig.GetTextureDecodeThreads());
 
   m_temp_size = 2048 * 2048 * 4;
   m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
@@ -139,6 +142,8 @@ void TextureCacheBase::Invalidate()
     bind.reset();
   m_textures_by_hash.clear();
   m_textures_by_address.clear();
+  m_lookup_index.Clear();
+  m_watched_hashes.clear();
 
   m_texture_pool.clear();
 }
@@ -169,6 +174,9 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  if (config.GetTextureDecodeThreads() != m_decode_pool.GetWorkerCount())
+    m_decode_pool.Start(config.GetTextureDecodeThreads());
+
   SetBackupConfig(config);
 }
 
@@ -346,7 +354,7 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddToAddressCache(decoded_entry->addr, decoded_entry);
 
   return decoded_entry;
 }
@@ -392,7 +400,7 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddToAddressCache(reinterpreted_entry->addr, reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -746,7 +754,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+      AddToAddressCache(addr, entry);
   }
 
   // Fill in hash map.
@@ -1280,9 +1288,17 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
 
     // Otherwise, hash the backing memory and check it's unchanged.
     // FIXME: this doesn't correctly handle textures from tmem.
-    if (!entry->invalidated && entry->base_hash == entry->CalculateHash())
-    {
-      return entry;
+    if (!entry->invalidated)
+    {
+      const std::optional<u64> unwritten_hash =
+          entry->IsCopy() ?
+              std::nullopt :
+              GetUnwrittenHash(entry->addr, entry->size_in_bytes, entry->HashSampleSize());
+      if (unwritten_hash ? entry->base_hash == *unwritten_hash :
+                           entry->base_hash == entry->CalculateHash())
+      {
+        return entry;
+      }
     }
   }
 
@@ -1294,11 +1310,10 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
   entry->frameCount = FRAMECOUNT_INVALID;
   if (entry->texture_info_name.empty() && g_ActiveConfig.bGraphicMods)
   {
-    entry->texture_info_name = texture_info.CalculateTextureName().GetFullName();
+    entry->SetTextureInfoName(texture_info.CalculateTextureName().GetFullName());
 
     GraphicsModActionData::TextureLoad texture_load{entry->texture_info_name};
-    for (const auto& action :
-         g_graphics_mod_manager->GetTextureLoadActions(entry->texture_info_name))
+    for (const auto& action : g_graphics_mod_manager->GetTextureLoadActions(entry->texture_info_id))
     {
       action->OnTextureLoad(&texture_load);
     }
@@ -1349,8 +1364,16 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  if (texture_info.IsFromTmem())
+  {
+    base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+                                  textureCacheSafetyColorSampleSize);
+  }
+  else
+  {
+    base_hash = HashTextureData(texture_info.GetRawAddress(), texture_info.GetData(),
+                                texture_info.GetTextureSize(), textureCacheSafetyColorSampleSize);
+  }
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
@@ -1391,6 +1414,30 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   //
   // For efb copies, the entry created in CopyRenderTargetToTexture always has to be used, or else
   // it was done in vain.
+  //
+  // The lookup index finds the normal texture which the search below would pick, without walking
+  // all entries at this address. It can't be used if there are copies at the address, as those are
+  // preferred over normal textures, and unused copies are pruned by the search.
+  const RcTcacheEntry* indexed_entry = m_lookup_index.Find(
+      LookupIndex::MakeKey(texture_info.GetRawAddress(), texture_info.GetTextureFormat(),
+                           texture_info.GetTlutFormat(), full_hash),
+      texture_info.GetStage());
+  if (indexed_entry && !m_lookup_index.HasCopies(texture_info.GetRawAddress()) &&
+      (*indexed_entry)->native_levels >= texture_info.GetLevelCount() &&
+      (*indexed_entry)->native_width == texture_info.GetRawWidth() &&
+      (*indexed_entry)->native_height == texture_info.GetRawHeight())
+  {
+    RcTcacheEntry entry = *indexed_entry;
+    entry = DoPartialTextureUpdates(entry, texture_info.GetTlutAddress(),
+                                    texture_info.GetTlutFormat());
+    if (entry)
+    {
+      entry->texture->FinishedRendering();
+      INCSTAT(g_stats.this_frame.num_texture_index_hits);
+      return entry;
+    }
+  }
+
   auto iter_range = m_textures_by_address.equal_range(texture_info.GetRawAddress());
   TexAddrCache::iterator iter = iter_range.first;
   TexAddrCache::iterator oldest_entry = iter;
@@ -1617,19 +1664,46 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
     texture_name = texture_info.CalculateTextureName().GetFullName();
     GraphicsModActionData::TextureCreate texture_create{
         texture_name, width, height, &cached_game_assets, &additional_dependencies};
-    for (const auto& action : g_graphics_mod_manager->GetTextureCreateActions(texture_name))
+    for (const auto& action : g_graphics_mod_manager->GetTextureCreateActions(
+             g_graphics_mod_manager->GetTextureID(texture_name)))
     {
       action->OnTextureCreate(&texture_create);
     }
   }
 
+  // Until the custom texture is loaded, its preview is shown if it has one. Both are linked to
+  // the entry, so that it is created again once either of them is loaded. Graphics mods may add
+  // textures of the full size, which the preview can't be combined with.
+  u32 preview_level = 0;
+  if (hires_texture && hires_texture->GetPreviewAsset() && cached_game_assets.size() == 1 &&
+      !cached_game_assets[0].m_asset->GetData())
+  {
+    auto& cached_asset = cached_game_assets[0];
+    const auto& preview_asset = hires_texture->GetPreviewAsset();
+    if (preview_asset->GetData())
+    {
+      additional_dependencies.push_back(VideoCommon::CachedAsset<VideoCommon::CustomAsset>{
+          cached_asset.m_asset, cached_asset.m_cached_write_time});
+      cached_asset = VideoCommon::CachedAsset<VideoCommon::GameTextureAsset>{
+          preview_asset, preview_asset->GetLastLoadedTime()};
+      preview_level = hires_texture->GetPreviewLevel();
+    }
+    else
+    {
+      additional_dependencies.push_back(VideoCommon::CachedAsset<VideoCommon::CustomAsset>{
+          preview_asset, preview_asset->GetLastLoadedTime()});
+    }
+  }
+
   data_for_assets.reserve(cached_game_assets.size());
   for (auto& cached_asset : cached_game_assets)
   {
     auto data = cached_asset.m_asset->GetData();
     if (data)
     {
-      if (cached_asset.m_asset->Validate(texture_info.GetRawWidth(), texture_info.GetRawHeight()))
+      // The preview is a mip level of the texture, so it is validated against that level
+      if (cached_asset.m_asset->Validate(texture_info.GetRawWidth() >> preview_level,
+                                         texture_info.GetRawHeight() >> preview_level))
       {
         data_for_assets.push_back(data);
       }
@@ -1642,10 +1716,46 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                          std::move(data_for_assets), has_arbitrary_mipmaps, skip_texture_dump);
   entry->linked_game_texture_assets = std::move(cached_game_assets);
   entry->linked_asset_dependencies = std::move(additional_dependencies);
-  entry->texture_info_name = std::move(texture_name);
+  entry->SetTextureInfoName(std::move(texture_name));
   return entry;
 }
 
+u64 TextureCacheBase::HashTextureData(u32 address, const u8* data, u32 size, int sample_size)
+{
+  auto& memory = Core::System::GetInstance().GetMemory();
+  if (!memory.IsWriteTrackingEnabled())
+    return Common::GetHash64(data, size, sample_size);
+
+  if (const std::optional<u64> hash = GetUnwrittenHash(address, size, sample_size))
+  {
+    INCSTAT(g_stats.this_frame.num_texture_hashes_skipped);
+    return *hash;
+  }
+
+  // The range has to be watched before hashing, so writes during hashing invalidate the hash.
+  const u64 stamp = memory.WatchRange(address, size);
+  const u64 hash = Common::GetHash64(data, size, sample_size);
+  if (stamp != 0)
+    m_watched_hashes.insert_or_assign({address, size, sample_size}, WatchedHash{stamp, hash});
+  else
+    m_watched_hashes.erase({address, size, sample_size});
+  return hash;
+}
+
+std::optional<u64> TextureCacheBase::GetUnwrittenHash(u32 address, u32 size,
+                                                      int sample_size) const
+{
+  const auto iter = m_watched_hashes.find({address, size, sample_size});
+  if (iter == m_watched_hashes.end())
+    return std::nullopt;
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  if (memory.WasRangeWritten(address, size, iter->second.stamp))
+    return std::nullopt;
+
+  return iter->second.hash;
+}
+
 // Note: the following function assumes all CustomTextureData has a single slice.  This is verified
 // with the 'GameTexture::Validate' function after the data is loaded. Only a single slice is
 // expected because each texture is loaded into a texture array
@@ -1717,14 +1827,47 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     // banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
     // there's no conversion between formats. In the future this could be extended with a separate
     // shader, however.
-    const bool decode_on_gpu =
-        g_ActiveConfig.UseGPUTextureDecoding() &&
+    const bool can_decode_on_gpu =
+        g_ActiveConfig.backend_info.bSupportsGPUTextureDecoding &&
         !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
+    bool decode_on_gpu = can_decode_on_gpu && g_ActiveConfig.UseGPUTextureDecoding();
+
+    // Unless GPU decoding is forced on, the selector picks the faster path for the texture. The
+    // arbitrary mipmap detector needs every level decoded on the CPU, though.
+    const u32 num_texels = expanded_width * expanded_height;
+    const bool select_decoder = can_decode_on_gpu && g_ActiveConfig.UseAutoGPUTextureDecoding() &&
+                                !(texLevels > 1 && g_ActiveConfig.bArbitraryMipmapDetection);
+    if (select_decoder)
+    {
+      decode_on_gpu = m_decoder_selector.Select(texture_info.GetTextureFormat(), num_texels) ==
+                      VideoCommon::TextureDecoderSelector::Path::GPU;
+    }
+    const auto decode_start = std::chrono::steady_clock::now();
+    GPUThreadPartTimer decode_timer(GPUThreadPart::TextureDecoding);
+    bool fell_back_to_cpu = false;
 
     ArbitraryMipmapDetector arbitrary_mip_detector;
 
-    // Initialized to null because only software loading uses this buffer
-    u8* dst_buffer = nullptr;
+    // Allocate memory for all levels at once, as any level which fails to decode on the GPU is
+    // decoded on the CPU instead.
+    const size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
+    size_t total_texture_size = decoded_texture_size;
+
+    // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+    const size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
+
+    size_t prev_level_size = decoded_texture_size;
+    for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+    {
+      prev_level_size /= 4;
+      total_texture_size += prev_level_size;
+    }
+
+    // Add space for the downsampling at the end
+    total_texture_size += mip_downsample_buffer_size;
+
+    CheckTempSize(total_texture_size);
+    u8* dst_buffer = m_temp;
 
     if (!decode_on_gpu ||
         !DecodeTextureOnGPU(
@@ -1733,31 +1876,24 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
             creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
             texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
     {
-      size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
-
-      // Allocate memory for all levels at once
-      size_t total_texture_size = decoded_texture_size;
-
-      // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
-      size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
-
-      size_t prev_level_size = decoded_texture_size;
-      for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+      fell_back_to_cpu = decode_on_gpu;
+      if (!texture_info.IsFromTmem())
       {
-        prev_level_size /= 4;
-        total_texture_size += prev_level_size;
+        m_decode_pool.Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                             texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                             texture_info.GetTlutFormat());
       }
-
-      // Add space for the downsampling at the end
-      total_texture_size += mip_downsample_buffer_size;
-
-      CheckTempSize(total_texture_size);
-      dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
+      else if (texture_info.GetTextureFormat() != TextureFormat::RGBA8)
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        const u32 tmem_address = static_cast<u32>(texture_info.GetData() - s_tex_mem.data());
+        if (m_decode_pool.DecodeFromTmem(tmem_address, dst_buffer, texture_info.GetData(),
+                                         expanded_width, expanded_height,
+                                         texture_info.GetTextureFormat(),
+                                         texture_info.GetTlutAddress(),
+                                         texture_info.GetTlutFormat()))
+        {
+          INCSTAT(g_stats.this_frame.num_textures_decoded_ahead);
+        }
       }
       else
       {
@@ -1788,12 +1924,14 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
                                   (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
                               texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
       {
+        fell_back_to_cpu |= decode_on_gpu;
+
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        m_decode_pool.Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                             mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                             texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
         entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
                              mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
 
@@ -1804,6 +1942,19 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       }
     }
 
+    // For the GPU path, this only measures uploading the data and recording the dispatches, but
+    // that is what holds up the GPU thread.
+    if (select_decoder && !fell_back_to_cpu)
+    {
+      m_decoder_selector.ReportTime(decode_on_gpu ? VideoCommon::TextureDecoderSelector::Path::GPU :
+                                                    VideoCommon::TextureDecoderSelector::Path::CPU,
+                                    texture_info.GetTextureFormat(), num_texels,
+                                    std::chrono::steady_clock::now() - decode_start);
+    }
+    if (decode_on_gpu && !fell_back_to_cpu)
+      INCSTAT(g_stats.this_frame.num_textures_decoded_on_gpu);
+    decode_timer.Stop();
+
     entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
@@ -1823,7 +1974,6 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
   if (safety_color_sample_size == 0 ||
       std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
           (u32)safety_color_sample_size * 8)
@@ -1841,6 +1991,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
+  const auto iter = AddToAddressCache(texture_info.GetRawAddress(), entry);
+
   INCSTAT(g_stats.num_textures_uploaded);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
 
@@ -1923,7 +2075,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddToAddressCache(entry->addr, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -1932,7 +2084,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
     const std::string id = fmt::format("{}x{}", width, height);
     if (g_ActiveConfig.bGraphicMods)
     {
-      entry->texture_info_name = fmt::format("{}_{}", XFB_DUMP_PREFIX, id);
+      entry->SetTextureInfoName(fmt::format("{}_{}", XFB_DUMP_PREFIX, id));
     }
 
     if (g_ActiveConfig.bDumpXFBTarget)
@@ -2239,6 +2391,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   // Disadvantage of all methods: Calling this function requires the GPU to perform a pipeline flush
   // which stalls any further CPU processing.
   const bool is_xfb_copy = !is_depth_copy && !isIntensity && dstFormat == EFBCopyFormat::XFB;
+  GPUProfiler::ScopedPass profiler_pass(is_xfb_copy ? GPUProfiler::Pass::XFBCopy :
+                                                      GPUProfiler::Pass::EFBCopy);
   bool copy_to_vram =
       g_ActiveConfig.backend_info.bSupportsCopyToVram && !g_ActiveConfig.bDisableCopyToVRAM;
   bool copy_to_ram =
@@ -2321,7 +2475,10 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       if (skip == true)
       {
         if (copy_to_ram)
+        {
           UninitializeEFBMemory(dst, dstStride, bytes_per_row, num_blocks_y);
+          memory.NotifyWrite(dstAddr, covered_range);
+        }
         return;
       }
     }
@@ -2383,7 +2540,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         const std::string id = fmt::format("{}x{}", tex_w, tex_h);
         if (g_ActiveConfig.bGraphicMods)
         {
-          entry->texture_info_name = fmt::format("{}_{}", XFB_DUMP_PREFIX, id);
+          entry->SetTextureInfoName(fmt::format("{}_{}", XFB_DUMP_PREFIX, id));
         }
 
         if (g_ActiveConfig.bDumpXFBTarget)
@@ -2399,7 +2556,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         const std::string id = fmt::format("{}x{}_{}", tex_w, tex_h, static_cast<int>(baseFormat));
         if (g_ActiveConfig.bGraphicMods)
         {
-          entry->texture_info_name = fmt::format("{}_{}", EFB_DUMP_PREFIX, id);
+          entry->SetTextureInfoName(fmt::format("{}_{}", EFB_DUMP_PREFIX, id));
         }
 
         if (g_ActiveConfig.bDumpEFBTarget)
@@ -2422,23 +2579,28 @@ void TextureCacheBase::CopyRenderTargetToTexture(
                          AllCopyFilterCoefsNeeded(coefficients),
                          CopyFilterCanOverflow(coefficients), gamma != 1.0);
 
-    std::unique_ptr<AbstractStagingTexture> staging_texture = GetEFBCopyStagingTexture();
+    // Flush the copies which are done by now, so that they don't need to be waited for later on.
+    FlushFinishedEFBCopies();
+
+    const auto [staging_texture, staging_row] = GetEFBCopyStagingRows(num_blocks_y);
     if (staging_texture)
     {
-      CopyEFB(staging_texture.get(), format, tex_w, bytes_per_row, num_blocks_y, dstStride, srcRect,
-              scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom, coefficients);
+      CopyEFB(staging_texture, staging_row, format, tex_w, bytes_per_row, num_blocks_y, dstStride,
+              srcRect, scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom,
+              coefficients);
 
       // We can't defer if there is no VRAM copy (since we need to update the hash).
       if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
       {
         // Immediately flush it.
         WriteEFBCopyToRAM(dst, bytes_per_row / sizeof(u32), num_blocks_y, dstStride,
-                          std::move(staging_texture));
+                          staging_texture, staging_row);
       }
       else
       {
         // Defer the flush until later.
-        entry->pending_efb_copy = std::move(staging_texture);
+        entry->pending_efb_copy = staging_texture;
+        entry->pending_efb_copy_row = staging_row;
         entry->pending_efb_copy_width = bytes_per_row / sizeof(u32);
         entry->pending_efb_copy_height = num_blocks_y;
         m_pending_efb_copies.push_back(entry);
@@ -2457,6 +2619,11 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     }
   }
 
+  // Deferred copies are only written to RAM later, but for write tracking, it's enough that the
+  // range is written again when they are flushed.
+  if (copy_to_ram)
+    memory.NotifyWrite(dstAddr, covered_range);
+
   // Invalidate all textures, if they are either fully overwritten by our efb copy, or if they
   // have a different stride than our efb copy. Partly overwritten textures with the same stride
   // as our efb copy are marked to check them for partial texture updates.
@@ -2538,7 +2705,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    AddToAddressCache(dstAddr, std::move(entry));
   }
 }
 
@@ -2552,6 +2719,23 @@ void TextureCacheBase::FlushEFBCopies()
   m_pending_efb_copies.clear();
 }
 
+void TextureCacheBase::FlushFinishedEFBCopies()
+{
+  // Copies may overlap, so they have to be written to RAM in the order they were made. The GPU
+  // finishes them in that order too.
+  const auto unfinished = std::ranges::find_if(m_pending_efb_copies, [](const auto& entry) {
+    return !entry->pending_efb_copy->IsCopyComplete();
+  });
+  for (auto iter = m_pending_efb_copies.begin(); iter != unfinished; ++iter)
+    FlushEFBCopy(iter->get());
+  m_pending_efb_copies.erase(m_pending_efb_copies.begin(), unfinished);
+}
+
+void TextureCacheBase::OnTmemPreload(u32 tmem_address, u32 size)
+{
+  m_decode_pool.OnTmemPreload(tmem_address, s_tex_mem.data() + tmem_address, size);
+}
+
 void TextureCacheBase::FlushStaleBinds()
 {
   for (u32 i = 0; i < m_bound_textures.size(); i++)
@@ -2562,11 +2746,11 @@ void TextureCacheBase::FlushStaleBinds()
 }
 
 void TextureCacheBase::WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
-                                         std::unique_ptr<AbstractStagingTexture> staging_texture)
+                                         AbstractStagingTexture* staging_texture, u32 staging_row)
 {
-  MathUtil::Rectangle<int> copy_rect(0, 0, static_cast<int>(width), static_cast<int>(height));
+  MathUtil::Rectangle<int> copy_rect(0, static_cast<int>(staging_row), static_cast<int>(width),
+                                     static_cast<int>(staging_row + height));
   staging_texture->ReadTexels(copy_rect, dst_ptr, stride);
-  ReleaseEFBCopyStagingTexture(std::move(staging_texture));
 }
 
 void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
@@ -2577,8 +2761,14 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
   u8* const dst = memory.GetPointerForRange(entry->addr, covered_range);
+  if (entry->pending_efb_copy->IsCopyComplete())
+    INCSTAT(g_stats.this_frame.num_efb_copy_readback_stalls_avoided);
+  else
+    INCSTAT(g_stats.this_frame.num_efb_copy_readback_stalls);
   WriteEFBCopyToRAM(dst, entry->pending_efb_copy_width, entry->pending_efb_copy_height,
-                    entry->memory_stride, std::move(entry->pending_efb_copy));
+                    entry->memory_stride, std::exchange(entry->pending_efb_copy, nullptr),
+                    entry->pending_efb_copy_row);
+  memory.NotifyWrite(entry->addr, covered_range);
 
   // If the EFB copy was invalidated (e.g. the bloom case mentioned in InvalidateTexture), we don't
   // need to do anything more. The entry will be automatically deleted by smart pointers
@@ -2608,27 +2798,38 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   }
 }
 
-std::unique_ptr<AbstractStagingTexture> TextureCacheBase::GetEFBCopyStagingTexture()
+std::pair<AbstractStagingTexture*, u32> TextureCacheBase::GetEFBCopyStagingRows(u32 height)
 {
-  // Pull off the back first to re-use the most frequently used textures.
-  if (!m_efb_copy_staging_texture_pool.empty())
+  // Once all copies have been flushed, nothing refers to the staging textures anymore.
+  if (m_pending_efb_copies.empty())
   {
-    auto ptr = std::move(m_efb_copy_staging_texture_pool.back());
-    m_efb_copy_staging_texture_pool.pop_back();
-    return ptr;
+    m_efb_copy_staging_index = 0;
+    m_efb_copy_staging_rows = 0;
   }
 
-  std::unique_ptr<AbstractStagingTexture> tex = g_gfx->CreateStagingTexture(
-      StagingTextureType::Readback, m_efb_encoding_texture->GetConfig());
-  if (!tex)
-    WARN_LOG_FMT(VIDEO, "Failed to create EFB copy staging texture");
+  if (m_efb_copy_staging_index < m_efb_copy_staging_textures.size() &&
+      m_efb_copy_staging_rows + height >
+          m_efb_copy_staging_textures[m_efb_copy_staging_index]->GetHeight())
+  {
+    m_efb_copy_staging_index++;
+    m_efb_copy_staging_rows = 0;
+  }
 
-  return tex;
-}
+  if (m_efb_copy_staging_index == m_efb_copy_staging_textures.size())
+  {
+    std::unique_ptr<AbstractStagingTexture> tex = g_gfx->CreateStagingTexture(
+        StagingTextureType::Readback, m_efb_encoding_texture->GetConfig());
+    if (!tex)
+    {
+      WARN_LOG_FMT(VIDEO, "Failed to create EFB copy staging texture");
+      return {nullptr, 0};
+    }
+    m_efb_copy_staging_textures.push_back(std::move(tex));
+  }
 
-void TextureCacheBase::ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex)
-{
-  m_efb_copy_staging_texture_pool.push_back(std::move(tex));
+  const u32 row = m_efb_copy_staging_rows;
+  m_efb_copy_staging_rows += height;
+  return {m_efb_copy_staging_textures[m_efb_copy_staging_index].get(), row};
 }
 
 void TextureCacheBase::UninitializeEFBMemory(u8* dst, u32 stride, u32 bytes_per_row,
@@ -2765,6 +2966,23 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddToAddressCache(u32 addr,
+                                                                             RcTcacheEntry entry)
+{
+  if (entry->IsCopy())
+  {
+    m_lookup_index.AddCopy(addr);
+  }
+  else
+  {
+    m_lookup_index.Insert(LookupIndex::MakeKey(addr, entry->format.texfmt, entry->format.tlutfmt,
+                                               entry->hash),
+                          entry);
+  }
+
+  return m_textures_by_address.emplace(addr, std::move(entry));
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
@@ -2796,6 +3014,17 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
     entry->textures_by_hash_iter = m_textures_by_hash.end();
   }
 
+  if (entry->IsCopy())
+  {
+    m_lookup_index.RemoveCopy(iter->first);
+  }
+  else
+  {
+    m_lookup_index.Remove(LookupIndex::MakeKey(iter->first, entry->format.texfmt,
+                                               entry->format.tlutfmt, entry->hash),
+                          entry);
+  }
+
   // If this is a pending EFB copy, we don't want to flush it here.
   // Why? Because let's say a game is rendering a bloom-type effect, using EFB copies to essentially
   // downscale the framebuffer. Copy from EFB->Texture, draw texture to EFB, copy EFB->Texture,
@@ -2811,7 +3040,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
       // existing pending copy, and not bother waiting for it in the future. This happens in
       // Xenoblade's sunset scene, where 35 copies are done per frame, and 25 of them are
       // copied to the same address, and can be skipped.
-      ReleaseEFBCopyStagingTexture(std::move(entry->pending_efb_copy));
+      entry->pending_efb_copy = nullptr;
       auto pending_it = std::ranges::find(m_pending_efb_copies, entry);
       if (pending_it != m_pending_efb_copies.end())
         m_pending_efb_copies.erase(pending_it);
@@ -2941,12 +3170,12 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   entry->texture->FinishedRendering();
 }
 
-void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params,
-                               u32 native_width, u32 bytes_per_row, u32 num_blocks_y,
-                               u32 memory_stride, const MathUtil::Rectangle<int>& src_rect,
-                               bool scale_by_half, bool linear_filter, float y_scale, float gamma,
-                               bool clamp_top, bool clamp_bottom,
-                               const std::array<u32, 3>& filter_coefficients)
+void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, u32 dst_row,
+                               const EFBCopyParams& params, u32 native_width, u32 bytes_per_row,
+                               u32 num_blocks_y, u32 memory_stride,
+                               const MathUtil::Rectangle<int>& src_rect, bool scale_by_half,
+                               bool linear_filter, float y_scale, float gamma, bool clamp_top,
+                               bool clamp_bottom, const std::array<u32, 3>& filter_coefficients)
 {
   // Flush EFB pokes first, as they're expected to be included.
   g_framebuffer_manager->FlushEFBPokes();
@@ -3014,7 +3243,9 @@ void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams&
   g_gfx->SetSamplerState(0, linear_filter ? RenderState::GetLinearSamplerState() :
                                             RenderState::GetPointSamplerState());
   g_gfx->Draw(0, 3);
-  dst->CopyFromTexture(m_efb_encoding_texture.get(), encode_rect, 0, 0, encode_rect);
+  const auto staging_rect = MathUtil::Rectangle<int>(0, dst_row, render_width,
+                                                     dst_row + render_height);
+  dst->CopyFromTexture(m_efb_encoding_texture.get(), encode_rect, 0, 0, staging_rect);
   g_gfx->EndUtilityDrawing();
 
   // Flush if there's sufficient draws between this copy and the last.
@@ -3142,6 +3373,12 @@ void TCacheEntry::SetNotCopy()
   is_xfb_container = false;
 }
 
+void TCacheEntry::SetTextureInfoName(std::string name)
+{
+  texture_info_id = g_graphics_mod_manager->GetTextureID(name);
+  texture_info_name = std::move(name);
+}
+
 int TCacheEntry::HashSampleSize() const
 {
   if (should_force_safe_hashing)
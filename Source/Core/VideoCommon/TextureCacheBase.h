@@ -25,8 +25,11 @@
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/TextureDecodePool.h"
+#include "VideoCommon/TextureDecoderSelector.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
+#include "VideoCommon/TextureLookupIndex.h"
 #include "VideoCommon/TextureUtils.h"
 #include "VideoCommon/VideoEvents.h"
 
@@ -160,12 +163,16 @@ struct TCacheEntry
   //   * partially updated textures which refer to this efb copy
   std::unordered_set<TCacheEntry*> references;
 
-  // Pending EFB copy
-  std::unique_ptr<AbstractStagingTexture> pending_efb_copy;
+  // Pending EFB copy, in the rows of a shared staging texture starting at pending_efb_copy_row
+  AbstractStagingTexture* pending_efb_copy = nullptr;
+  u32 pending_efb_copy_row = 0;
   u32 pending_efb_copy_width = 0;
   u32 pending_efb_copy_height = 0;
 
   std::string texture_info_name = "";
+  // 'texture_info_name' interned by 'GraphicsModManager::GetTextureID()', which graphics mod
+  // actions are looked up by
+  u64 texture_info_id = 0;
 
   std::vector<VideoCommon::CachedAsset<VideoCommon::GameTextureAsset>> linked_game_texture_assets;
   std::vector<VideoCommon::CachedAsset<VideoCommon::CustomAsset>> linked_asset_dependencies;
@@ -199,6 +206,8 @@ struct TCacheEntry
     hash = _hash;
   }
 
+  void SetTextureInfoName(std::string name);
+
   // This texture entry is used by the other entry as a sub-texture
   void CreateReference(TCacheEntry* other_entry)
   {
@@ -298,6 +307,9 @@ public:
   // Flush any Bound textures that can't be reused
   void FlushStaleBinds();
 
+  // Called after data was preloaded to TMEM, so it can be decoded ahead of time.
+  void OnTmemPreload(u32 tmem_address, u32 size);
+
   // Texture Serialization
   void SerializeTexture(AbstractTexture* tex, const TextureConfig& config, PointerWrap& p);
   std::optional<TexPoolEntry> DeserializeTexture(PointerWrap& p);
@@ -323,8 +335,9 @@ protected:
                           u32 aligned_height, u32 row_stride, const u8* palette,
                           TLUTFormat palette_format);
 
-  virtual void CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
-                       u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
+  // Encodes the copy to the rows of dst starting at dst_row.
+  virtual void CopyEFB(AbstractStagingTexture* dst, u32 dst_row, const EFBCopyParams& params,
+                       u32 native_width, u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
                        const MathUtil::Rectangle<int>& src_rect, bool scale_by_half,
                        bool linear_filter, float y_scale, float gamma, bool clamp_top,
                        bool clamp_bottom, const std::array<u32, 3>& filter_coefficients);
@@ -342,6 +355,7 @@ private:
   using TexHashCache = std::multimap<u64, RcTcacheEntry>;
 
   using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
+  using LookupIndex = VideoCommon::TextureLookupIndex<RcTcacheEntry>;
 
   static bool DidLinkedAssetsChange(const TCacheEntry& entry);
 
@@ -374,6 +388,14 @@ private:
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  // Hashes texture data in RAM, unless write tracking shows that the range hasn't been written
+  // since it was last hashed.
+  u64 HashTextureData(u32 address, const u8* data, u32 size, int sample_size);
+  std::optional<u64> GetUnwrittenHash(u32 address, u32 size, int sample_size) const;
+
+  // Inserts the entry into m_textures_by_address, and m_lookup_index if it is a normal texture
+  TexAddrCache::iterator AddToAddressCache(u32 addr, RcTcacheEntry entry);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
@@ -394,14 +416,15 @@ private:
 
   // Flushes a pending EFB copy to RAM from the host to the guest RAM.
   void WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
-                         std::unique_ptr<AbstractStagingTexture> staging_texture);
+                         AbstractStagingTexture* staging_texture, u32 staging_row);
   void FlushEFBCopy(TCacheEntry* entry);
 
-  // Returns a staging texture of the maximum EFB copy size.
-  std::unique_ptr<AbstractStagingTexture> GetEFBCopyStagingTexture();
+  // Flushes the pending EFB copies which the GPU has already finished, without waiting for the
+  // others. Copies are flushed in order, so this stops at the first one which isn't finished.
+  void FlushFinishedEFBCopies();
 
-  // Returns an EFB copy staging texture to the pool, so it can be re-used.
-  void ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex);
+  // Returns a staging texture with the given number of free rows, and the first of those rows.
+  std::pair<AbstractStagingTexture*, u32> GetEFBCopyStagingRows(u32 height);
 
   bool CheckReadbackTexture(u32 width, u32 height, AbstractTextureFormat format);
   void DoSaveState(PointerWrap& p);
@@ -415,6 +438,31 @@ private:
   // All textures in here will also be in m_textures_by_address
   TexHashCache m_textures_by_hash;
 
+  // m_lookup_index is another view of m_textures_by_address, for the common case of a normal
+  // texture being loaded again with identical parameters
+  LookupIndex m_lookup_index;
+
+  VideoCommon::TextureDecodePool m_decode_pool;
+  VideoCommon::TextureDecoderSelector m_decoder_selector;
+
+  // The last hash of each range of texture data, along with the write tracking stamp from before
+  // it was calculated. The hash stays valid until the range is written. Ranges are keyed by their
+  // size and sample size as well, as different textures may start at the same address.
+  struct WatchedRange
+  {
+    u32 address;
+    u32 size;
+    int sample_size;
+
+    auto operator<=>(const WatchedRange&) const = default;
+  };
+  struct WatchedHash
+  {
+    u64 stamp;
+    u64 hash;
+  };
+  std::map<WatchedRange, WatchedHash> m_watched_hashes;
+
   // m_bound_textures are actually active in the current draw
   // It's valid for textures to be in here after they've been invalidated
   std::array<RcTcacheEntry, 8> m_bound_textures{};
@@ -448,8 +496,12 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
-  // Pool of readback textures used for deferred EFB copies.
-  std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
+  // Readback textures used for EFB copies to RAM. Copies are placed below each other, so a frame
+  // with many small copies only needs a few staging textures of the maximum EFB copy size. The rows
+  // are only reused once all pending copies have been flushed.
+  std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_textures;
+  size_t m_efb_copy_staging_index = 0;
+  u32 m_efb_copy_staging_rows = 0;
 
   // List of pending EFB copies. It is important that the order is preserved for these,
   // so that overlapping textures are written to guest RAM in the order they are issued.
@@ -0,0 +1,256 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureDecodePool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fmt/format.h>
+
+#include "Common/Thread.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace VideoCommon
+{
+// Each strip decodes to at least this many texels, so small textures are still decoded in one go
+// on the calling thread, as waking up the workers would take longer.
+static constexpr int MIN_STRIP_TEXELS = 64 * 1024;
+
+TextureDecodePool::TextureDecodePool() = default;
+
+TextureDecodePool::~TextureDecodePool()
+{
+  Stop();
+}
+
+void TextureDecodePool::Start(u32 num_workers)
+{
+  Stop();
+
+  m_exit = false;
+  for (u32 i = 0; i < num_workers; ++i)
+    m_workers.emplace_back(&TextureDecodePool::WorkerThread, this, i);
+}
+
+void TextureDecodePool::Stop()
+{
+  {
+    std::lock_guard lock(m_task_lock);
+    m_exit = true;
+  }
+  m_task_cv.notify_all();
+
+  for (std::thread& worker : m_workers)
+    worker.join();
+  m_workers.clear();
+
+  // Jobs which were still queued were dropped along with the tasks.
+  m_tasks.clear();
+  std::lock_guard lock(m_preload_lock);
+  m_preload_jobs.clear();
+}
+
+void TextureDecodePool::QueueTask(std::function<void()> task)
+{
+  {
+    std::lock_guard lock(m_task_lock);
+    m_tasks.push_back(std::move(task));
+  }
+  m_task_cv.notify_one();
+}
+
+void TextureDecodePool::WorkerThread(u32 index)
+{
+  Common::SetCurrentThreadName(fmt::format("Texture decoder {}", index).c_str());
+
+  std::unique_lock lock(m_task_lock);
+  while (true)
+  {
+    m_task_cv.wait(lock, [this] { return m_exit || !m_tasks.empty(); });
+    if (m_exit)
+      return;
+
+    std::function<void()> task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+    lock.unlock();
+    task();
+    lock.lock();
+  }
+}
+
+void TextureDecodePool::Decode(u8* dst, const u8* src, int width, int height, TextureFormat format,
+                               const u8* tlut, TLUTFormat tlut_format)
+{
+  const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+  const int min_rows = (MIN_STRIP_TEXELS + width - 1) / width;
+  const int rows_per_strip = (min_rows + block_height - 1) / block_height * block_height;
+  const u32 num_strips = static_cast<u32>((height + rows_per_strip - 1) / rows_per_strip);
+  if (m_workers.empty() || num_strips < 2)
+  {
+    TexDecoder_Decode(dst, src, width, height, format, tlut, tlut_format);
+    return;
+  }
+
+  // Workers may only get to their task after all strips have been decoded, and must not touch the
+  // texture in that case, so they only need to keep the counters alive.
+  struct Batch
+  {
+    std::atomic<u32> next_strip = 0;
+    std::atomic<u32> strips_done = 0;
+    std::mutex lock;
+    std::condition_variable done_cv;
+  };
+  const auto batch = std::make_shared<Batch>();
+  const auto decode_strips = [=] {
+    for (u32 strip = batch->next_strip++; strip < num_strips; strip = batch->next_strip++)
+    {
+      const int first_row = static_cast<int>(strip) * rows_per_strip;
+      TexDecoder_DecodeRows(dst, src, width, height, first_row,
+                            std::min(rows_per_strip, height - first_row), format, tlut,
+                            tlut_format);
+      if (++batch->strips_done == num_strips)
+      {
+        std::lock_guard lock(batch->lock);
+        batch->done_cv.notify_one();
+      }
+    }
+  };
+
+  const u32 num_helpers = std::min(GetWorkerCount(), num_strips - 1);
+  for (u32 i = 0; i < num_helpers; ++i)
+    QueueTask(decode_strips);
+  decode_strips();
+
+  {
+    std::unique_lock lock(batch->lock);
+    batch->done_cv.wait(lock, [&] { return batch->strips_done == num_strips; });
+  }
+
+  TexDecoder_DrawOverlay(dst, width, height, format);
+}
+
+bool TextureDecodePool::DecodeFromTmem(u32 tmem_address, u8* dst, const u8* src, int width,
+                                       int height, TextureFormat format, const u8* tlut,
+                                       TLUTFormat tlut_format)
+{
+  // Paletted textures are never decoded ahead, as the palette is usually loaded after the preload.
+  if (IsColorIndexed(format))
+  {
+    m_last_tmem_textures.erase(tmem_address);
+    Decode(dst, src, width, height, format, tlut, tlut_format);
+    return false;
+  }
+
+  m_last_tmem_textures[tmem_address] = {format, width, height};
+
+  std::shared_ptr<PreloadJob> job;
+  {
+    std::unique_lock lock(m_preload_lock);
+    const auto iter = std::ranges::find_if(m_preload_jobs, [&](const auto& queued_job) {
+      return queued_job->tmem_address == tmem_address;
+    });
+    if (iter != m_preload_jobs.end())
+    {
+      job = std::move(*iter);
+      m_preload_jobs.erase(iter);
+
+      // Decoding a job which hasn't started yet on this thread is just as fast.
+      if (job->state == PreloadJob::State::Queued)
+        job->state = PreloadJob::State::Cancelled;
+      else
+        m_preload_cv.wait(lock, [&] { return job->state == PreloadJob::State::Done; });
+    }
+  }
+
+  const size_t size = static_cast<size_t>(TexDecoder_GetTextureSizeInBytes(width, height, format));
+  if (!job || job->state != PreloadJob::State::Done || job->texture.format != format ||
+      job->texture.width != width || job->texture.height != height || job->src.size() != size ||
+      std::memcmp(job->src.data(), src, size) != 0)
+  {
+    Decode(dst, src, width, height, format, tlut, tlut_format);
+    return false;
+  }
+
+  std::memcpy(dst, job->decoded.data(), job->decoded.size());
+  TexDecoder_DrawOverlay(dst, width, height, format);
+  return true;
+}
+
+void TextureDecodePool::OnTmemPreload(u32 tmem_address, const u8* data, u32 size)
+{
+  if (m_workers.empty())
+    return;
+
+  const auto last_texture = m_last_tmem_textures.find(tmem_address);
+  if (last_texture == m_last_tmem_textures.end())
+    return;
+
+  const TmemTexture& texture = last_texture->second;
+  const u32 texture_size =
+      static_cast<u32>(TexDecoder_GetTextureSizeInBytes(texture.width, texture.height,
+                                                        texture.format));
+  if (texture_size > size)
+    return;
+
+  // The TMEM contents can change before the job runs, so it works on a copy.
+  auto job = std::make_shared<PreloadJob>();
+  job->tmem_address = tmem_address;
+  job->texture = texture;
+  job->src.assign(data, data + texture_size);
+  {
+    std::lock_guard lock(m_preload_lock);
+    const auto drop_job = [](PreloadJob& dropped_job) {
+      if (dropped_job.state == PreloadJob::State::Queued)
+        dropped_job.state = PreloadJob::State::Cancelled;
+    };
+    std::erase_if(m_preload_jobs, [&](const auto& queued_job) {
+      if (queued_job->tmem_address != tmem_address)
+        return false;
+      drop_job(*queued_job);
+      return true;
+    });
+    if (m_preload_jobs.size() == MAX_PRELOAD_JOBS)
+    {
+      drop_job(*m_preload_jobs.front());
+      m_preload_jobs.pop_front();
+    }
+    m_preload_jobs.push_back(job);
+  }
+
+  QueueTask([this, job] { DecodePreload(job); });
+}
+
+void TextureDecodePool::WaitForPreloads()
+{
+  // Jobs are removed from the list when they are cancelled, so the rest will all finish.
+  std::unique_lock lock(m_preload_lock);
+  m_preload_cv.wait(lock, [this] {
+    return std::ranges::all_of(m_preload_jobs, [](const auto& job) {
+      return job->state == PreloadJob::State::Done;
+    });
+  });
+}
+
+void TextureDecodePool::DecodePreload(const std::shared_ptr<PreloadJob>& job)
+{
+  {
+    std::lock_guard lock(m_preload_lock);
+    if (job->state == PreloadJob::State::Cancelled)
+      return;
+    job->state = PreloadJob::State::Decoding;
+  }
+
+  // The overlay is drawn when the job is taken, so it matches the current settings.
+  const TmemTexture& texture = job->texture;
+  job->decoded.resize(static_cast<size_t>(texture.width) * texture.height * sizeof(u32));
+  TexDecoder_DecodeRows(job->decoded.data(), job->src.data(), texture.width, texture.height, 0,
+                        texture.height, texture.format, nullptr, TLUTFormat::IA8);
+
+  {
+    std::lock_guard lock(m_preload_lock);
+    job->state = PreloadJob::State::Done;
+  }
+  m_preload_cv.notify_all();
+}
+}  // namespace VideoCommon
@@ -0,0 +1,102 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+enum class TextureFormat;
+enum class TLUTFormat;
+
+namespace VideoCommon
+{
+// Decodes textures on a pool of worker threads, so large textures don't stall the GPU thread for
+// as long. Textures are split into strips of block rows, which are decoded in parallel, with the
+// calling thread decoding strips as well.
+//
+// Textures preloaded to TMEM are also decoded ahead of time, as soon as the preload happens. The
+// format of the preloaded data isn't known until the texture is loaded, so it is guessed from the
+// last texture which was loaded from the same TMEM address.
+class TextureDecodePool
+{
+public:
+  TextureDecodePool();
+  ~TextureDecodePool();
+
+  // Without workers, all textures are decoded on the calling thread.
+  void Start(u32 num_workers);
+  void Stop();
+
+  u32 GetWorkerCount() const { return static_cast<u32>(m_workers.size()); }
+
+  // Same as TexDecoder_Decode.
+  void Decode(u8* dst, const u8* src, int width, int height, TextureFormat format, const u8* tlut,
+              TLUTFormat tlut_format);
+
+  // Decodes a texture from TMEM, using the result of decoding its preload ahead of time if the
+  // guess was right. Returns true in that case.
+  bool DecodeFromTmem(u32 tmem_address, u8* dst, const u8* src, int width, int height,
+                      TextureFormat format, const u8* tlut, TLUTFormat tlut_format);
+
+  // Starts decoding data which was just preloaded to TMEM, if its format can be guessed.
+  void OnTmemPreload(u32 tmem_address, const u8* data, u32 size);
+
+  // Blocks until every preload which is kept around has been decoded.
+  void WaitForPreloads();
+
+private:
+  struct TmemTexture
+  {
+    TextureFormat format;
+    int width;
+    int height;
+  };
+
+  struct PreloadJob
+  {
+    enum class State
+    {
+      Queued,
+      Decoding,
+      Done,
+      Cancelled,
+    };
+
+    u32 tmem_address;
+    TmemTexture texture;
+    std::vector<u8> src;
+    std::vector<u8> decoded;
+    State state = State::Queued;
+  };
+
+  // Decoded preloads which are kept around. Games usually load a preloaded texture right after
+  // preloading it, so there is no point in keeping many.
+  static constexpr size_t MAX_PRELOAD_JOBS = 4;
+
+  void QueueTask(std::function<void()> task);
+  void WorkerThread(u32 index);
+  void DecodePreload(const std::shared_ptr<PreloadJob>& job);
+
+  std::vector<std::thread> m_workers;
+  std::mutex m_task_lock;
+  std::condition_variable m_task_cv;
+  std::deque<std::function<void()>> m_tasks;
+  bool m_exit = false;
+
+  // Only used on the GPU thread.
+  std::map<u32, TmemTexture> m_last_tmem_textures;
+
+  std::mutex m_preload_lock;
+  std::condition_variable m_preload_cv;
+  std::deque<std::shared_ptr<PreloadJob>> m_preload_jobs;
+};
+}  // namespace VideoCommon
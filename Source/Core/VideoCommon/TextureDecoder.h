@@ -191,6 +191,14 @@ TextureFormat TexDecoder_GetEFBCopyBaseFormat(EFBCopyFormat format);
 
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt);
+// Decodes num_rows rows of texels starting at first_row, which both have to be multiples of the
+// block height, so that parts of a texture can be decoded in parallel. dst and src point to the
+// start of the whole texture. The format overlay has to be drawn separately.
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int height, int first_row,
+                           int num_rows, TextureFormat texformat, const u8* tlut,
+                           TLUTFormat tlutfmt);
+// Draws the format overlay over a decoded texture, if it is enabled.
+void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat);
 void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
                                     int height);
 void TexDecoder_DecodeTexel(u8* dst, std::span<const u8> src, int s, int t, int imageWidth,
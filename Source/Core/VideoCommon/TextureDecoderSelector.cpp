@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureDecoderSelector.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "VideoCommon/TextureDecoder.h"
+
+namespace VideoCommon
+{
+// Weight of a new timing in the moving average.
+static constexpr float TIMING_WEIGHT = 1.0f / 8.0f;
+
+// While a path doesn't have enough timings yet, every this many textures take it.
+static constexpr u32 WARMUP_INTERVAL = 4;
+
+TextureDecoderSelector::Path TextureDecoderSelector::Select(TextureFormat format, u32 num_texels)
+{
+  SizeClass& size_class = GetSizeClass(format, num_texels);
+  const Timing& cpu = size_class.timings[static_cast<size_t>(Path::CPU)];
+  const Timing& gpu = size_class.timings[static_cast<size_t>(Path::GPU)];
+
+  Path best;
+  if (cpu.samples >= MIN_SAMPLES && gpu.samples >= MIN_SAMPLES)
+    best = gpu.ns_per_texel < cpu.ns_per_texel ? Path::GPU : Path::CPU;
+  else if (IsColorIndexed(format) || num_texels >= GPU_GUESS_TEXELS)
+    best = Path::GPU;
+  else
+    best = Path::CPU;
+
+  const Path other = best == Path::CPU ? Path::GPU : Path::CPU;
+  const u32 interval = size_class.timings[static_cast<size_t>(other)].samples < MIN_SAMPLES ?
+                           WARMUP_INTERVAL :
+                           RETIME_INTERVAL;
+  return ++size_class.selections % interval == 0 ? other : best;
+}
+
+void TextureDecoderSelector::ReportTime(Path path, TextureFormat format, u32 num_texels,
+                                        std::chrono::nanoseconds time)
+{
+  SizeClass& size_class = GetSizeClass(format, num_texels);
+  Timing& timing = size_class.timings[static_cast<size_t>(path)];
+
+  // The first texture of each path is dropped, as it pays for one-off costs like compiling the
+  // decoding shader or growing the upload buffers.
+  if (!size_class.warmed_up[static_cast<size_t>(path)])
+  {
+    size_class.warmed_up[static_cast<size_t>(path)] = true;
+    return;
+  }
+
+  const float ns_per_texel =
+      static_cast<float>(time.count()) / static_cast<float>(std::max(num_texels, 1u));
+  if (timing.samples == 0)
+    timing.ns_per_texel = ns_per_texel;
+  else
+    timing.ns_per_texel += (ns_per_texel - timing.ns_per_texel) * TIMING_WEIGHT;
+  timing.samples++;
+}
+
+void TextureDecoderSelector::Reset()
+{
+  m_size_classes = {};
+}
+
+TextureDecoderSelector::SizeClass& TextureDecoderSelector::GetSizeClass(TextureFormat format,
+                                                                        u32 num_texels)
+{
+  const u32 size_class = std::min<u32>(std::bit_width(num_texels), NUM_SIZE_CLASSES - 1);
+  return m_size_classes[static_cast<u32>(format) % NUM_FORMATS][size_class];
+}
+}  // namespace VideoCommon
@@ -0,0 +1,71 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+
+enum class TextureFormat;
+
+namespace VideoCommon
+{
+// Picks whether a texture is decoded on the CPU or by the GPU texture decoding shaders, when GPU
+// texture decoding isn't forced on. Neither is faster for every texture: uploading the data and
+// dispatching a compute shader has a fixed cost which small textures don't make up for, while
+// large textures and paletted textures are slow to decode on the CPU.
+//
+// The first textures of each format and size class go where a fixed guess says. After that, the
+// time each path takes on the GPU thread decides, and every so often a texture takes the path
+// which currently looks slower, so the timings of both paths stay up to date.
+class TextureDecoderSelector
+{
+public:
+  enum class Path
+  {
+    CPU,
+    GPU,
+  };
+
+  // Textures of at least this many texels are guessed to be faster to decode on the GPU.
+  static constexpr u32 GPU_GUESS_TEXELS = 256 * 256;
+
+  // Every this many textures of a size class, the path which looks slower is timed again.
+  static constexpr u32 RETIME_INTERVAL = 64;
+
+  // Timings which a path needs before they override the guess.
+  static constexpr u32 MIN_SAMPLES = 4;
+
+  Path Select(TextureFormat format, u32 num_texels);
+
+  // Reports how long the whole texture took to decode and upload with the given path.
+  void ReportTime(Path path, TextureFormat format, u32 num_texels, std::chrono::nanoseconds time);
+
+  void Reset();
+
+private:
+  // Textures are grouped by the power of two of their texel count.
+  static constexpr u32 NUM_SIZE_CLASSES = 32;
+  static constexpr u32 NUM_FORMATS = 16;
+
+  struct Timing
+  {
+    // Moving average of the time per texel.
+    float ns_per_texel = 0.0f;
+    u32 samples = 0;
+  };
+
+  struct SizeClass
+  {
+    std::array<Timing, 2> timings;
+    std::array<bool, 2> warmed_up{};
+    u32 selections = 0;
+  };
+
+  SizeClass& GetSizeClass(TextureFormat format, u32 num_texels);
+
+  std::array<std::array<SizeClass, NUM_SIZE_CLASSES>, NUM_FORMATS> m_size_classes{};
+};
+}  // namespace VideoCommon
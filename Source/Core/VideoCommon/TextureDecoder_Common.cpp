@@ -256,7 +256,7 @@ void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center)
   TexFmt_Overlay_Center = center;
 }
 
-static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
+static void DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
 {
   int w = std::min(width, 40);
   int h = std::min(height, 10);
@@ -303,8 +303,32 @@ void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFor
 {
   _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
 
+  TexDecoder_DrawOverlay(dst, width, height, texformat);
+}
+
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int height, int first_row,
+                           int num_rows, TextureFormat texformat, const u8* tlut,
+                           TLUTFormat tlutfmt)
+{
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  if (first_row % block_height != 0 || num_rows % block_height != 0 ||
+      first_row + num_rows > height)
+  {
+    PanicAlertFmt("Invalid rows {}+{} of {}x{} texture in format {}", first_row, num_rows, width,
+                  height, texformat);
+    return;
+  }
+
+  const int block_row_size = TexDecoder_GetTextureSizeInBytes(width, block_height, texformat);
+  _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst) + first_row * width,
+                         src + (first_row / block_height) * block_row_size, width, num_rows,
+                         texformat, tlut, tlutfmt);
+}
+
+void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
+{
   if (TexFmt_Overlay_Enable)
-    TexDecoder_DrawOverlay(dst, width, height, texformat);
+    DrawOverlay(dst, width, height, texformat);
 }
 
 static inline u32 DecodePixel_IA8(u16 val)
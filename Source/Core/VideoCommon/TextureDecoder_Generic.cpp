@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
@@ -71,25 +72,29 @@ static inline u32 DecodePixel_Paletted(u16 pixel, TLUTFormat tlutfmt)
   }
 }
 
-static inline void DecodeBytes_C4(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+// Decodes the palette up front, so texels only need a table lookup instead of decoding the same
+// colors over and over.
+static void DecodePalette(u32* palette, const u8* tlut_, TLUTFormat tlutfmt, int num_entries)
+{
+  const u16* tlut = (const u16*)tlut_;
+  for (int i = 0; i < num_entries; i++)
+    palette[i] = DecodePixel_Paletted(tlut[i], tlutfmt);
+}
+
+static inline void DecodeBytes_C4(u32* dst, const u8* src, const u32* palette)
 {
-  const u16* tlut = (u16*)tlut_;
   for (int x = 0; x < 4; x++)
   {
     u8 val = src[x];
-    *dst++ = DecodePixel_Paletted(tlut[val >> 4], tlutfmt);
-    *dst++ = DecodePixel_Paletted(tlut[val & 0xF], tlutfmt);
+    *dst++ = palette[val >> 4];
+    *dst++ = palette[val & 0xF];
   }
 }
 
-static inline void DecodeBytes_C8(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+static inline void DecodeBytes_C8(u32* dst, const u8* src, const u32* palette)
 {
-  const u16* tlut = (u16*)tlut_;
   for (int x = 0; x < 8; x++)
-  {
-    u8 val = src[x];
-    *dst++ = DecodePixel_Paletted(tlut[val], tlutfmt);
-  }
+    *dst++ = palette[src[x]];
 }
 
 static inline void DecodeBytes_C14X2(u32* dst, const u16* src, const u8* tlut_, TLUTFormat tlutfmt)
@@ -102,6 +107,12 @@ static inline void DecodeBytes_C14X2(u32* dst, const u16* src, const u8* tlut_,
   }
 }
 
+static inline void DecodeBytes_C14X2(u32* dst, const u16* src, const u32* palette)
+{
+  for (int x = 0; x < 4; x++)
+    *dst++ = palette[Common::swap16(src[x]) & 0x3FFF];
+}
+
 static inline void DecodeBytes_IA4(u32* dst, const u8* src)
 {
   for (int x = 0; x < 8; x++)
@@ -187,11 +198,15 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
+  {
+    u32 palette[16];
+    DecodePalette(palette, tlut, tlutfmt, 16);
     for (int y = 0; y < height; y += 8)
       for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
-          DecodeBytes_C4(dst + (y + iy) * width + x, src + 4 * xStep, tlut, tlutfmt);
-    break;
+          DecodeBytes_C4(dst + (y + iy) * width + x, src + 4 * xStep, palette);
+  }
+  break;
   case TextureFormat::I4:
   {
     // Reference C implementation:
@@ -239,11 +254,15 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   }
   break;
   case TextureFormat::C8:
+  {
+    u32 palette[256];
+    DecodePalette(palette, tlut, tlutfmt, 256);
     for (int y = 0; y < height; y += 4)
       for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
-          DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
-    break;
+          DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, palette);
+  }
+  break;
   case TextureFormat::IA4:
   {
     for (int y = 0; y < height; y += 4)
@@ -269,10 +288,23 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   }
   break;
   case TextureFormat::C14X2:
-    for (int y = 0; y < height; y += 4)
-      for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
-        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
-          DecodeBytes_C14X2(dst + (y + iy) * width + x, (u16*)(src + 8 * xStep), tlut, tlutfmt);
+    // Decoding the whole palette only pays off for textures with at least as many texels.
+    if (width * height >= 16384)
+    {
+      std::vector<u32> palette(16384);
+      DecodePalette(palette.data(), tlut, tlutfmt, 16384);
+      for (int y = 0; y < height; y += 4)
+        for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+          for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+            DecodeBytes_C14X2(dst + (y + iy) * width + x, (u16*)(src + 8 * xStep), palette.data());
+    }
+    else
+    {
+      for (int y = 0; y < height; y += 4)
+        for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+          for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+            DecodeBytes_C14X2(dst + (y + iy) * width + x, (u16*)(src + 8 * xStep), tlut, tlutfmt);
+    }
     break;
   case TextureFormat::RGB565:
   {
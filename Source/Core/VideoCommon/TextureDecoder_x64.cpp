@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <vector>
 
 #ifdef CHECK
 #include "Common/Assert.h"
@@ -1413,6 +1414,427 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+// Decodes the palette up front for the AVX2 decoders, so texels only need a table lookup. Returns
+// false for invalid TLUT formats, which the other decoders leave undecoded as well.
+static bool DecodePalette(u32* palette, const u8* tlut_, TLUTFormat tlutfmt, int num_entries)
+{
+  const u16* tlut = (const u16*)tlut_;
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_IA8(tlut[i]);
+    return true;
+
+  case TLUTFormat::RGB565:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_RGB565(Common::swap16(tlut[i]));
+    return true;
+
+  case TLUTFormat::RGB5A3:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_RGB5A3(Common::swap16(tlut[i]));
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+// The AVX2 decoders write a row of eight texels, or two rows of four texels, per 256-bit store.
+
+// Expands the 4-bit texels of a row of eight texels to 32-bit lanes, first texel in the high
+// nibble.
+FUNCTION_TARGET_AVX2
+static inline __m256i LoadNibbles_AVX2(const u8* src)
+{
+  const __m128i dup = _mm_setr_epi8(0, 0, 1, 1, 2, 2, 3, 3, -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i bytes = _mm_shuffle_epi8(_mm_cvtsi32_si128(*(const int*)src), dup);
+  const __m256i shifts = _mm256_setr_epi32(4, 0, 4, 0, 4, 0, 4, 0);
+  return _mm256_and_si256(_mm256_srlv_epi32(_mm256_cvtepu8_epi32(bytes), shifts),
+                          _mm256_set1_epi32(0xF));
+}
+
+// Loads two rows of four big endian 16-bit texels to 32-bit lanes.
+FUNCTION_TARGET_AVX2
+static inline __m256i LoadTexels16_AVX2(const u8* src)
+{
+  const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  return _mm256_cvtepu16_epi32(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src), swap));
+}
+
+FUNCTION_TARGET_AVX2
+static inline void StoreRows_AVX2(u32* dst, int width, __m256i rows)
+{
+  _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(rows));
+  _mm_storeu_si128((__m128i*)(dst + width), _mm256_extracti128_si256(rows, 1));
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[16];
+  if (!DecodePalette(palette, tlut, tlutfmt, 16))
+    return;
+
+  // The palette fits in two registers, so texels are looked up with permutes instead of gathers.
+  const __m256i palette_lo = _mm256_load_si256((const __m256i*)palette);
+  const __m256i palette_hi = _mm256_load_si256((const __m256i*)(palette + 8));
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        const __m256i index = LoadNibbles_AVX2(src + 4 * xStep);
+        const __m256i lo = _mm256_permutevar8x32_epi32(palette_lo, index);
+        const __m256i hi = _mm256_permutevar8x32_epi32(palette_hi, index);
+        const __m256i use_hi = _mm256_slli_epi32(index, 28);
+        const __m256i rgba = _mm256_castps_si256(_mm256_blendv_ps(
+            _mm256_castsi256_ps(lo), _mm256_castsi256_ps(hi), _mm256_castsi256_ps(use_hi)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), rgba);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        const __m256i i = LoadNibbles_AVX2(src + 4 * xStep);
+        const __m256i iiii = _mm256_mullo_epi32(i, _mm256_set1_epi32(0x11111111));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), iiii);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12, 0, 0,
+                                          0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i i = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), _mm256_shuffle_epi8(i, spread));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[256];
+  if (!DecodePalette(palette, tlut, tlutfmt, 256))
+    return;
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i index =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        const __m256i rgba = _mm256_i32gather_epi32((const int*)palette, index, 4);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), rgba);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA4_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask = _mm256_set1_epi32(0xF);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i ia = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        // Multiplying copies each nibble to all of the nibbles of the bytes it ends up in.
+        const __m256i a =
+            _mm256_mullo_epi32(_mm256_srli_epi32(ia, 4), _mm256_set1_epi32(0x11000000));
+        const __m256i l =
+            _mm256_mullo_epi32(_mm256_and_si256(ia, mask), _mm256_set1_epi32(0x00111111));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), _mm256_or_si256(a, l));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask = _mm256_setr_epi8(1, 1, 1, 0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12, 1, 1, 1,
+                                        0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m256i ia =
+            _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(src + 8 * xStep)));
+        StoreRows_AVX2(dst + (y + iy) * width + x, width, _mm256_shuffle_epi8(ia, mask));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C14X2_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  std::vector<u32> palette(16384);
+  if (!DecodePalette(palette.data(), tlut, tlutfmt, 16384))
+    return;
+
+  const __m256i mask = _mm256_set1_epi32(0x3FFF);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m256i index = _mm256_and_si256(LoadTexels16_AVX2(src + 8 * xStep), mask);
+        const __m256i rgba = _mm256_i32gather_epi32((const int*)palette.data(), index, 4);
+        StoreRows_AVX2(dst + (y + iy) * width + x, width, rgba);
+      }
+    }
+  }
+}
+
+// Expands the 3, 4, 5 and 6 bit components of every 32-bit lane to 8 bits.
+FUNCTION_TARGET_AVX2
+static inline __m256i Convert3To8_AVX2(__m256i v)
+{
+  return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(v, 5), _mm256_slli_epi32(v, 2)),
+                         _mm256_srli_epi32(v, 1));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i Convert4To8_AVX2(__m256i v)
+{
+  return _mm256_or_si256(_mm256_slli_epi32(v, 4), v);
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i Convert5To8_AVX2(__m256i v)
+{
+  return _mm256_or_si256(_mm256_slli_epi32(v, 3), _mm256_srli_epi32(v, 2));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i Convert6To8_AVX2(__m256i v)
+{
+  return _mm256_or_si256(_mm256_slli_epi32(v, 2), _mm256_srli_epi32(v, 4));
+}
+
+// Extracts the component at the given bit offset of every 32-bit lane.
+FUNCTION_TARGET_AVX2
+static inline __m256i Component_AVX2(__m256i v, int shift, int mask)
+{
+  return _mm256_and_si256(_mm256_srli_epi32(v, shift), _mm256_set1_epi32(mask));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i MakeRGBA_AVX2(__m256i r, __m256i g, __m256i b, __m256i a)
+{
+  return _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+                         _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_slli_epi32(a, 24)));
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB565_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i alpha = _mm256_set1_epi32(0xFF);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m256i val = LoadTexels16_AVX2(src + 8 * xStep);
+        const __m256i r = Convert5To8_AVX2(Component_AVX2(val, 11, 0x1F));
+        const __m256i g = Convert6To8_AVX2(Component_AVX2(val, 5, 0x3F));
+        const __m256i b = Convert5To8_AVX2(Component_AVX2(val, 0, 0x1F));
+        StoreRows_AVX2(dst + (y + iy) * width + x, width, MakeRGBA_AVX2(r, g, b, alpha));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i alpha = _mm256_set1_epi32(0xFF);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m256i val = LoadTexels16_AVX2(src + 8 * xStep);
+
+        // Both encodings are decoded, and the top bit picks which one is used.
+        const __m256i rgb555 = MakeRGBA_AVX2(Convert5To8_AVX2(Component_AVX2(val, 10, 0x1F)),
+                                             Convert5To8_AVX2(Component_AVX2(val, 5, 0x1F)),
+                                             Convert5To8_AVX2(Component_AVX2(val, 0, 0x1F)), alpha);
+        const __m256i argb3444 = MakeRGBA_AVX2(Convert4To8_AVX2(Component_AVX2(val, 8, 0xF)),
+                                               Convert4To8_AVX2(Component_AVX2(val, 4, 0xF)),
+                                               Convert4To8_AVX2(Component_AVX2(val, 0, 0xF)),
+                                               Convert3To8_AVX2(Component_AVX2(val, 12, 0x7)));
+        const __m256i opaque = _mm256_slli_epi32(val, 16);
+        const __m256i rgba = _mm256_castps_si256(
+            _mm256_blendv_ps(_mm256_castsi256_ps(argb3444), _mm256_castsi256_ps(rgb555),
+                             _mm256_castsi256_ps(opaque)));
+        StoreRows_AVX2(dst + (y + iy) * width + x, width, rgba);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGBA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Interleaving the AR and GB halves of a block gives ARGB texels, with rows 0 and 2 in the low
+  // halves of the 128-bit lanes, and rows 1 and 3 in the high halves.
+  const __m256i argb_to_rgba = _mm256_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15,
+                                                12, 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14,
+                                                15, 12);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      const u8* src2 = src + 64 * yStep;
+      const __m256i ar = _mm256_loadu_si256((const __m256i*)src2);
+      const __m256i gb = _mm256_loadu_si256((const __m256i*)(src2 + 32));
+      const __m256i rows02 = _mm256_shuffle_epi8(_mm256_unpacklo_epi16(ar, gb), argb_to_rgba);
+      const __m256i rows13 = _mm256_shuffle_epi8(_mm256_unpackhi_epi16(ar, gb), argb_to_rgba);
+
+      u32* dst_block = dst + y * width + x;
+      _mm_storeu_si128((__m128i*)dst_block, _mm256_castsi256_si128(rows02));
+      _mm_storeu_si128((__m128i*)(dst_block + width), _mm256_castsi256_si128(rows13));
+      _mm_storeu_si128((__m128i*)(dst_block + 2 * width), _mm256_extracti128_si256(rows02, 1));
+      _mm_storeu_si128((__m128i*)(dst_block + 3 * width), _mm256_extracti128_si256(rows13, 1));
+    }
+  }
+}
+
+// Weighs two components in eighths. The products fit in 16 bits.
+FUNCTION_TARGET_AVX2
+static inline __m256i BlendDXT_AVX2(__m256i a, __m256i b, __m256i weight_a, __m256i weight_b)
+{
+  return _mm256_srli_epi32(
+      _mm256_add_epi32(_mm256_mullo_epi16(a, weight_a), _mm256_mullo_epi16(b, weight_b)), 3);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Two horizontally adjacent blocks are decoded together, with the palette of the first block in
+  // the low 128-bit lane, and the palette of the second one in the high lane. Each palette color
+  // is a weighted sum of the two block colors, in eighths:
+  //   color0 = 8/8 c1,  color1 = 8/8 c2,  color2 = 5/8 c1 + 3/8 c2,  color3 = 3/8 c1 + 5/8 c2
+  // and when c1 <= c2, color2 and color3 are both the average, with color3 transparent.
+  const __m256i c1_c2_c1_c1 = _mm256_setr_epi8(1, 0, -1, -1, 3, 2, -1, -1, 1, 0, -1, -1, 1, 0, -1,
+                                               -1, 9, 8, -1, -1, 11, 10, -1, -1, 9, 8, -1, -1, 9,
+                                               8, -1, -1);
+  const __m256i c1_c2_c2_c2 = _mm256_setr_epi8(1, 0, -1, -1, 3, 2, -1, -1, 3, 2, -1, -1, 3, 2, -1,
+                                               -1, 9, 8, -1, -1, 11, 10, -1, -1, 11, 10, -1, -1,
+                                               11, 10, -1, -1);
+  const __m256i c1s = _mm256_setr_epi8(1, 0, -1, -1, 1, 0, -1, -1, 1, 0, -1, -1, 1, 0, -1, -1, 9,
+                                       8, -1, -1, 9, 8, -1, -1, 9, 8, -1, -1, 9, 8, -1, -1);
+  const __m256i c2s = _mm256_setr_epi8(3, 2, -1, -1, 3, 2, -1, -1, 3, 2, -1, -1, 3, 2, -1, -1, 11,
+                                       10, -1, -1, 11, 10, -1, -1, 11, 10, -1, -1, 11, 10, -1, -1);
+  const __m256i lines_mask = _mm256_setr_epi8(4, 5, 6, 7, 4, 5, 6, 7, 4, 5, 6, 7, 4, 5, 6, 7, 12,
+                                              13, 14, 15, 12, 13, 14, 15, 12, 13, 14, 15, 12, 13,
+                                              14, 15);
+  const __m256i weights_blend = _mm256_setr_epi32(8, 8, 5, 3, 8, 8, 5, 3);
+  const __m256i weights_average = _mm256_setr_epi32(8, 8, 4, 4, 8, 8, 4, 4);
+  const __m256i alpha_average = _mm256_setr_epi32(0xFF, 0xFF, 0xFF, 0, 0xFF, 0xFF, 0xFF, 0);
+  const __m256i eight = _mm256_set1_epi32(8);
+  const __m256i alpha_opaque = _mm256_set1_epi32(0xFF);
+
+  const __m256i shifts = _mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0);
+  const __m256i second_block = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+  const __m256i mask = _mm256_set1_epi32(3);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int z = 0, xStep = 2 * yStep; z < 2; ++z, xStep++)
+      {
+        const __m256i dxt = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i*)(src + sizeof(DXTBlock) * 2 * xStep)));
+        const __m256i a = _mm256_shuffle_epi8(dxt, c1_c2_c1_c1);
+        const __m256i b = _mm256_shuffle_epi8(dxt, c1_c2_c2_c2);
+        const __m256i c1_greater = _mm256_cmpgt_epi32(_mm256_shuffle_epi8(dxt, c1s),
+                                                      _mm256_shuffle_epi8(dxt, c2s));
+        const __m256i weight_a = _mm256_blendv_epi8(weights_average, weights_blend, c1_greater);
+        const __m256i weight_b = _mm256_sub_epi32(eight, weight_a);
+        const __m256i r = BlendDXT_AVX2(Convert5To8_AVX2(Component_AVX2(a, 11, 0x1F)),
+                                        Convert5To8_AVX2(Component_AVX2(b, 11, 0x1F)), weight_a,
+                                        weight_b);
+        const __m256i g = BlendDXT_AVX2(Convert6To8_AVX2(Component_AVX2(a, 5, 0x3F)),
+                                        Convert6To8_AVX2(Component_AVX2(b, 5, 0x3F)), weight_a,
+                                        weight_b);
+        const __m256i bl = BlendDXT_AVX2(Convert5To8_AVX2(Component_AVX2(a, 0, 0x1F)),
+                                         Convert5To8_AVX2(Component_AVX2(b, 0, 0x1F)), weight_a,
+                                         weight_b);
+        const __m256i alpha = _mm256_blendv_epi8(alpha_average, alpha_opaque, c1_greater);
+        const __m256i palette = MakeRGBA_AVX2(r, g, bl, alpha);
+
+        const __m256i lines = _mm256_shuffle_epi8(dxt, lines_mask);
+        for (int iy = 0; iy < 4; iy++)
+        {
+          const __m256i row_shifts = _mm256_add_epi32(shifts, _mm256_set1_epi32(8 * iy));
+          const __m256i index = _mm256_add_epi32(
+              _mm256_and_si256(_mm256_srlv_epi32(lines, row_shifts), mask), second_block);
+          _mm256_storeu_si256((__m256i*)(dst + (y + 4 * z + iy) * width + x),
+                              _mm256_permutevar8x32_epi32(palette, index));
+        }
+      }
+    }
+  }
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
@@ -1422,11 +1844,18 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1434,7 +1863,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1442,15 +1874,28 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    // Small textures don't have enough texels to make up for decoding the whole palette.
+    if (cpu_info.bAVX2 && width * height >= 256)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
-    TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else
+      TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                Wsteps8);
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1459,17 +1904,28 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C14X2:
-    TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    if (cpu_info.bAVX2 && width * height >= 16384)
+      TexDecoder_DecodeImpl_C14X2_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                  Wsteps8);
     break;
 
   case TextureFormat::RGB565:
-    TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                 Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB565_AVX2(dst, src, width, height, texformat, tlut, tlutfmt,
+                                        Wsteps4, Wsteps8);
+    else
+      TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                   Wsteps8);
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt,
+                                        Wsteps4, Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1478,7 +1934,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGBA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                         Wsteps8);
     else
@@ -1487,7 +1946,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
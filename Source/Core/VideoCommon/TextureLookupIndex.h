@@ -0,0 +1,219 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace VideoCommon
+{
+// Flat index over texture cache entries, keyed on address, format and hash (which includes the
+// TLUT hash for paletted textures). The texture cache keeps its ordered address map for range
+// queries, and uses this index to find a matching entry without walking all entries at an address.
+//
+// Each texture unit remembers the slot of its last hit, which is checked before probing, as games
+// tend to load the same texture on the same unit over and over again.
+//
+// The index also counts the EFB/XFB copies living at each address, as those take precedence over
+// normal textures, so the index can only be trusted for addresses without copies.
+template <typename T>
+class TextureLookupIndex
+{
+public:
+  static constexpr u32 NUM_UNITS = 8;
+
+  struct Key
+  {
+    u32 address;
+    u32 format;
+    u64 hash;
+
+    bool operator==(const Key&) const = default;
+  };
+
+  // The TLUT format is only part of the key for color indexed formats, which matches the
+  // comparison in TextureAndTLUTFormat.
+  static Key MakeKey(u32 address, TextureFormat texfmt, TLUTFormat tlutfmt, u64 hash)
+  {
+    const u32 tlut = IsColorIndexed(texfmt) ? static_cast<u32>(tlutfmt) + 1 : 0;
+    return {address, static_cast<u32>(texfmt) | tlut << 8, hash};
+  }
+
+  // Keeps the existing value if the key is already indexed, and returns false in that case.
+  bool Insert(const Key& key, T value)
+  {
+    if (m_entries.Find(key, HashKey(key)) != NOT_FOUND)
+      return false;
+
+    m_entries.Insert(key, HashKey(key), std::move(value));
+    return true;
+  }
+
+  // Only removes the key if it is indexed with the given value.
+  void Remove(const Key& key, const T& value)
+  {
+    const size_t slot = m_entries.Find(key, HashKey(key));
+    if (slot != NOT_FOUND && m_entries.slots[slot].value == value)
+      m_entries.Erase(slot);
+  }
+
+  const T* Find(const Key& key, u32 unit)
+  {
+    size_t& last_hit = m_last_hits[unit % NUM_UNITS];
+    if (last_hit < m_entries.slots.size() && m_entries.slots[last_hit].used &&
+        m_entries.slots[last_hit].key == key)
+    {
+      return &m_entries.slots[last_hit].value;
+    }
+
+    const size_t slot = m_entries.Find(key, HashKey(key));
+    if (slot == NOT_FOUND)
+      return nullptr;
+
+    last_hit = slot;
+    return &m_entries.slots[slot].value;
+  }
+
+  void AddCopy(u32 address)
+  {
+    const size_t slot = m_copies.Find(address, HashAddress(address));
+    if (slot != NOT_FOUND)
+      m_copies.slots[slot].value++;
+    else
+      m_copies.Insert(address, HashAddress(address), 1);
+  }
+
+  void RemoveCopy(u32 address)
+  {
+    const size_t slot = m_copies.Find(address, HashAddress(address));
+    if (slot != NOT_FOUND && --m_copies.slots[slot].value == 0)
+      m_copies.Erase(slot);
+  }
+
+  bool HasCopies(u32 address) const
+  {
+    return m_copies.Find(address, HashAddress(address)) != NOT_FOUND;
+  }
+
+  void Clear()
+  {
+    m_entries = {};
+    m_copies = {};
+    m_last_hits.fill(NOT_FOUND);
+  }
+
+  size_t GetSize() const { return m_entries.size; }
+
+private:
+  static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+  static u64 HashAddress(u32 address) { return address * 0x9E3779B97F4A7C15ull; }
+  static u64 HashKey(const Key& key)
+  {
+    // The texture hash is already well distributed, the rest only needs to be mixed in.
+    return key.hash ^ ((static_cast<u64>(key.address) << 8 | key.format) * 0x9E3779B97F4A7C15ull);
+  }
+
+  // Linear probing with backward shift deletion, so lookups never have to skip tombstones.
+  template <typename K, typename V>
+  struct Table
+  {
+    struct Slot
+    {
+      K key{};
+      V value{};
+      bool used = false;
+    };
+
+    static constexpr size_t MIN_CAPACITY = 64;
+
+    size_t Home(u64 hash) const { return static_cast<size_t>(hash >> 32) & (slots.size() - 1); }
+
+    size_t Find(const K& key, u64 hash) const
+    {
+      if (slots.empty())
+        return NOT_FOUND;
+
+      for (size_t i = Home(hash);; i = (i + 1) & (slots.size() - 1))
+      {
+        if (!slots[i].used)
+          return NOT_FOUND;
+        if (slots[i].key == key)
+          return i;
+      }
+    }
+
+    void Insert(const K& key, u64 hash, V value)
+    {
+      // Keep the load factor below 3/4.
+      if ((size + 1) * 4 > slots.size() * 3)
+        Grow();
+
+      size_t i = Home(hash);
+      while (slots[i].used)
+        i = (i + 1) & (slots.size() - 1);
+
+      slots[i].key = key;
+      slots[i].value = std::move(value);
+      slots[i].used = true;
+      size++;
+    }
+
+    void Erase(size_t hole)
+    {
+      const size_t mask = slots.size() - 1;
+      for (size_t i = (hole + 1) & mask; slots[i].used; i = (i + 1) & mask)
+      {
+        // Move the slot back into the hole, unless its home lies cyclically in (hole, i].
+        const size_t home = Home(HashOf(slots[i].key));
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+          slots[hole] = std::move(slots[i]);
+          hole = i;
+        }
+      }
+
+      slots[hole] = Slot{};
+      size--;
+    }
+
+    void Grow()
+    {
+      std::vector<Slot> old_slots = std::exchange(
+          slots, std::vector<Slot>(slots.empty() ? MIN_CAPACITY : slots.size() * 2));
+      size = 0;
+      for (Slot& slot : old_slots)
+      {
+        if (slot.used)
+          Insert(slot.key, HashOf(slot.key), std::move(slot.value));
+      }
+    }
+
+    static u64 HashOf(const Key& key) { return HashKey(key); }
+    static u64 HashOf(u32 address) { return HashAddress(address); }
+
+    std::vector<Slot> slots;
+    size_t size = 0;
+  };
+
+  Table<Key, T> m_entries;
+  Table<u32, u32> m_copies;
+
+  // Slots move when the table grows or entries are erased, so these are only hints, which are
+  // verified against the key on use.
+  std::array<size_t, NUM_UNITS> m_last_hits = MakeEmptyLastHits();
+
+  static constexpr std::array<size_t, NUM_UNITS> MakeEmptyLastHits()
+  {
+    std::array<size_t, NUM_UNITS> last_hits{};
+    last_hits.fill(NOT_FOUND);
+    return last_hits;
+  }
+};
+}  // namespace VideoCommon
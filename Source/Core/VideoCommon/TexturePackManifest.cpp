@@ -0,0 +1,473 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TexturePackManifest.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/MappedFile.h"
+#include "Common/StringUtil.h"
+#include "Common/Swap.h"
+
+// On disk format:
+// header{
+// u32 'TPMF';
+// u32 version;
+// u32 num_directories;
+// u32 num_subdirectories;
+// u32 num_files;
+// u32 strings_size;
+// u32 root_directory_offset;
+// u32 root_directory_length;
+//}
+// directory[num_directories]{
+// u32 path_offset;
+// u32 path_length;
+// s64 mtime;
+// u32 first_subdirectory;
+// u32 num_subdirectories;
+// u32 first_file;
+// u32 num_files;
+//}
+// subdirectory[num_subdirectories]{
+// u32 name_offset;
+// u32 name_length;
+//}
+// file[num_files]{
+// u32 name_offset;
+// u32 name_length;
+// u64 size;
+// s64 mtime;
+// u32 width;
+// u32 height;
+// u8 format;
+// u8 padding[7];
+//}
+// char strings[strings_size];
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr u32 MANIFEST_MAGIC = 0x464D5054;  // 'TPMF'
+constexpr u32 MANIFEST_VERSION = 1;
+
+struct ManifestHeader
+{
+  u32 magic;
+  u32 version;
+  u32 num_directories;
+  u32 num_subdirectories;
+  u32 num_files;
+  u32 strings_size;
+  u32 root_directory_offset;
+  u32 root_directory_length;
+};
+static_assert(sizeof(ManifestHeader) == 32);
+
+struct DirectoryRecord
+{
+  u32 path_offset;
+  u32 path_length;
+  s64 mtime;
+  u32 first_subdirectory;
+  u32 num_subdirectories;
+  u32 first_file;
+  u32 num_files;
+};
+static_assert(sizeof(DirectoryRecord) == 32);
+
+struct StringRecord
+{
+  u32 offset;
+  u32 length;
+};
+static_assert(sizeof(StringRecord) == 8);
+
+struct FileRecord
+{
+  u32 name_offset;
+  u32 name_length;
+  u64 size;
+  s64 mtime;
+  u32 width;
+  u32 height;
+  TexturePackManifest::FileFormat format;
+  std::array<u8, 7> padding;
+};
+static_assert(sizeof(FileRecord) == 40);
+
+s64 GetTimeCount(std::filesystem::file_time_type time)
+{
+  return static_cast<s64>(time.time_since_epoch().count());
+}
+
+TexturePackManifest::FileFormat GetFileFormat(std::string_view name)
+{
+  const size_t dot = name.rfind('.');
+  if (dot == std::string_view::npos)
+    return TexturePackManifest::FileFormat::Other;
+
+  std::string extension(name.substr(dot));
+  Common::ToLower(&extension);
+  if (extension == ".png")
+    return TexturePackManifest::FileFormat::PNG;
+  if (extension == ".dds")
+    return TexturePackManifest::FileFormat::DDS;
+  return TexturePackManifest::FileFormat::Other;
+}
+
+// Reads the dimensions from the PNG IHDR chunk or the DDS header, which both end within the first
+// 24 bytes of the file.
+void ReadDimensions(const std::string& path, TexturePackManifest::FileInfo* file)
+{
+  if (file->format == TexturePackManifest::FileFormat::Other)
+    return;
+
+  std::array<u8, 24> header;
+  File::IOFile io_file(path, "rb");
+  if (!io_file.ReadArray(&header))
+    return;
+
+  if (file->format == TexturePackManifest::FileFormat::PNG)
+  {
+    constexpr std::array<u8, 8> PNG_SIGNATURE = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    if (!std::equal(PNG_SIGNATURE.begin(), PNG_SIGNATURE.end(), header.begin()) ||
+        std::memcmp(&header[12], "IHDR", 4) != 0)
+    {
+      return;
+    }
+    file->width = Common::swap32(&header[16]);
+    file->height = Common::swap32(&header[20]);
+  }
+  else
+  {
+    if (std::memcmp(&header[0], "DDS ", 4) != 0)
+      return;
+    std::memcpy(&file->height, &header[12], sizeof(u32));
+    std::memcpy(&file->width, &header[16], sizeof(u32));
+  }
+}
+}  // namespace
+
+TexturePackManifest::TexturePackManifest(std::string root_directory)
+    : m_root_directory(std::move(root_directory))
+{
+  while (m_root_directory.size() > 1 && m_root_directory.back() == DIR_SEP_CHR)
+    m_root_directory.pop_back();
+}
+
+bool TexturePackManifest::Load(const std::string& manifest_path)
+{
+  m_directories.clear();
+
+  File::MappedFile file;
+  if (!file.Open(manifest_path))
+    return false;
+
+  const u8* const data = file.GetData();
+  const u64 size = file.GetSize();
+  ManifestHeader header;
+  if (size < sizeof(header))
+    return false;
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != MANIFEST_MAGIC || header.version != MANIFEST_VERSION)
+    return false;
+
+  const u64 directories_offset = sizeof(header);
+  const u64 subdirectories_offset =
+      directories_offset + u64{header.num_directories} * sizeof(DirectoryRecord);
+  const u64 files_offset =
+      subdirectories_offset + u64{header.num_subdirectories} * sizeof(StringRecord);
+  const u64 strings_offset = files_offset + u64{header.num_files} * sizeof(FileRecord);
+  if (strings_offset + header.strings_size != size)
+  {
+    WARN_LOG_FMT(VIDEO, "Texture pack manifest {} is truncated, rebuilding it", manifest_path);
+    return false;
+  }
+
+  const auto get_string = [&](u32 offset, u32 length) -> std::optional<std::string_view> {
+    if (u64{offset} + length > header.strings_size)
+      return std::nullopt;
+    return std::string_view(reinterpret_cast<const char*>(data + strings_offset + offset), length);
+  };
+
+  if (get_string(header.root_directory_offset, header.root_directory_length) != m_root_directory)
+    return false;
+
+  std::map<std::string, DirectoryInfo> directories;
+  for (u32 i = 0; i < header.num_directories; ++i)
+  {
+    DirectoryRecord record;
+    std::memcpy(&record, data + directories_offset + i * sizeof(record), sizeof(record));
+    const auto path = get_string(record.path_offset, record.path_length);
+    if (!path || u64{record.first_subdirectory} + record.num_subdirectories >
+                     header.num_subdirectories ||
+        u64{record.first_file} + record.num_files > header.num_files)
+    {
+      WARN_LOG_FMT(VIDEO, "Texture pack manifest {} is corrupted, rebuilding it", manifest_path);
+      return false;
+    }
+
+    DirectoryInfo& directory = directories[std::string(*path)];
+    directory.mtime = record.mtime;
+
+    directory.subdirectories.reserve(record.num_subdirectories);
+    const u32 subdirectories_end = record.first_subdirectory + record.num_subdirectories;
+    for (u32 j = record.first_subdirectory; j < subdirectories_end; ++j)
+    {
+      StringRecord subdirectory;
+      std::memcpy(&subdirectory, data + subdirectories_offset + j * sizeof(subdirectory),
+                  sizeof(subdirectory));
+      const auto name = get_string(subdirectory.offset, subdirectory.length);
+      if (!name)
+        return false;
+      directory.subdirectories.emplace_back(*name);
+    }
+
+    directory.files.reserve(record.num_files);
+    for (u32 j = record.first_file; j < record.first_file + record.num_files; ++j)
+    {
+      FileRecord file_record;
+      std::memcpy(&file_record, data + files_offset + j * sizeof(file_record),
+                  sizeof(file_record));
+      const auto name = get_string(file_record.name_offset, file_record.name_length);
+      if (!name)
+        return false;
+      directory.files.push_back(FileInfo{std::string(*name), file_record.size, file_record.mtime,
+                                         file_record.format, file_record.width,
+                                         file_record.height});
+    }
+  }
+
+  m_directories = std::move(directories);
+  return true;
+}
+
+bool TexturePackManifest::Save(const std::string& manifest_path) const
+{
+  std::string strings;
+  const auto add_string = [&strings](std::string_view str) {
+    const StringRecord record{static_cast<u32>(strings.size()), static_cast<u32>(str.size())};
+    strings.append(str);
+    return record;
+  };
+
+  std::vector<DirectoryRecord> directories;
+  std::vector<StringRecord> subdirectories;
+  std::vector<FileRecord> files;
+  directories.reserve(m_directories.size());
+
+  const StringRecord root_directory = add_string(m_root_directory);
+  for (const auto& [path, directory] : m_directories)
+  {
+    const StringRecord path_record = add_string(path);
+    directories.push_back(DirectoryRecord{
+        path_record.offset, path_record.length, directory.mtime,
+        static_cast<u32>(subdirectories.size()), static_cast<u32>(directory.subdirectories.size()),
+        static_cast<u32>(files.size()), static_cast<u32>(directory.files.size())});
+
+    for (const std::string& subdirectory : directory.subdirectories)
+      subdirectories.push_back(add_string(subdirectory));
+
+    for (const FileInfo& file : directory.files)
+    {
+      const StringRecord name = add_string(file.name);
+      files.push_back(FileRecord{name.offset, name.length, file.size, file.mtime, file.width,
+                                 file.height, file.format, {}});
+    }
+  }
+
+  const ManifestHeader header{MANIFEST_MAGIC,
+                              MANIFEST_VERSION,
+                              static_cast<u32>(directories.size()),
+                              static_cast<u32>(subdirectories.size()),
+                              static_cast<u32>(files.size()),
+                              static_cast<u32>(strings.size()),
+                              root_directory.offset,
+                              root_directory.length};
+
+  // Written to a temporary file first, so that a crash never leaves a partial manifest behind
+  const std::string temp_path = manifest_path + ".tmp";
+  {
+    File::IOFile file(temp_path, "wb");
+    if (!file.WriteArray(&header, 1) || !file.WriteArray(directories.data(), directories.size()) ||
+        !file.WriteArray(subdirectories.data(), subdirectories.size()) ||
+        !file.WriteArray(files.data(), files.size()) ||
+        !file.WriteBytes(strings.data(), strings.size()))
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to write texture pack manifest {}", temp_path);
+      return false;
+    }
+  }
+  return File::Rename(temp_path, manifest_path);
+}
+
+bool TexturePackManifest::Update()
+{
+  bool changed = false;
+  std::map<std::string, DirectoryInfo> directories;
+
+  std::vector<std::string> pending{""};
+  while (!pending.empty())
+  {
+    const std::string relative_path = std::move(pending.back());
+    pending.pop_back();
+    const std::string full_path = GetFullPath(relative_path);
+    const auto add_subdirectories = [&](const DirectoryInfo& directory) {
+      for (const std::string& subdirectory : directory.subdirectories)
+      {
+        pending.push_back(relative_path.empty() ? subdirectory :
+                                                  relative_path + DIR_SEP + subdirectory);
+      }
+    };
+
+    std::error_code error;
+    const auto mtime = std::filesystem::last_write_time(StringToPath(full_path), error);
+    if (error)
+    {
+      // Removed since the manifest was saved, or the root doesn't exist
+      changed |= m_directories.contains(relative_path);
+      continue;
+    }
+
+    const auto previous = m_directories.find(relative_path);
+    if (previous != m_directories.end() && previous->second.mtime == GetTimeCount(mtime))
+    {
+      add_subdirectories(directories[relative_path] = std::move(previous->second));
+      continue;
+    }
+
+    // Files which didn't change keep the dimensions which were read before
+    std::unordered_map<std::string_view, const FileInfo*> previous_files;
+    if (previous != m_directories.end())
+    {
+      for (const FileInfo& file : previous->second.files)
+        previous_files.emplace(file.name, &file);
+    }
+
+    changed = true;
+    DirectoryInfo directory;
+    directory.mtime = GetTimeCount(mtime);
+    for (auto it = std::filesystem::directory_iterator(StringToPath(full_path), error);
+         it != std::filesystem::directory_iterator(); it.increment(error))
+    {
+      const std::string name = PathToString(it->path().filename());
+      std::error_code entry_error;
+      if (it->is_directory(entry_error))
+      {
+        directory.subdirectories.push_back(name);
+        continue;
+      }
+      if (!it->is_regular_file(entry_error))
+        continue;
+
+      FileInfo file{name, it->file_size(entry_error),
+                    GetTimeCount(it->last_write_time(entry_error)), GetFileFormat(name)};
+      const auto previous_file = previous_files.find(file.name);
+      if (previous_file != previous_files.end() && previous_file->second->size == file.size &&
+          previous_file->second->mtime == file.mtime)
+      {
+        file.width = previous_file->second->width;
+        file.height = previous_file->second->height;
+      }
+      else
+      {
+        ReadDimensions(full_path + DIR_SEP + name, &file);
+      }
+      directory.files.push_back(std::move(file));
+    }
+    if (error)
+      ERROR_LOG_FMT(VIDEO, "Failed to search {}: {}", full_path, error.message());
+
+    add_subdirectories(directory);
+    directories.emplace(relative_path, std::move(directory));
+  }
+
+  m_directories = std::move(directories);
+  return changed;
+}
+
+bool TexturePackManifest::HasDirectory(const std::string& path) const
+{
+  const std::optional<std::string> relative_path = GetRelativePath(path);
+  return relative_path && m_directories.contains(*relative_path);
+}
+
+std::vector<TexturePackManifest::FoundFile>
+TexturePackManifest::FindFiles(const std::string& directory,
+                               const std::vector<std::string>& extensions) const
+{
+  std::vector<FoundFile> result;
+  const std::optional<std::string> relative_path = GetRelativePath(directory);
+  if (!relative_path)
+    return result;
+
+  const auto extension_matches = [&extensions](std::string_view name) {
+    return extensions.empty() || std::ranges::any_of(extensions, [name](const std::string& ext) {
+             return name.size() >= ext.size() &&
+                    Common::CaseInsensitiveEquals(name.substr(name.size() - ext.size()), ext);
+           });
+  };
+  const auto add_files = [&](const std::string& path, const DirectoryInfo& info) {
+    const std::string full_path = GetFullPath(path);
+    for (const FileInfo& file : info.files)
+    {
+      if (extension_matches(file.name))
+        result.push_back(FoundFile{full_path + DIR_SEP + file.name, &file});
+    }
+  };
+
+  // The subdirectories of a directory are the paths following it with its path and a separator as
+  // prefix, and all paths are below the root.
+  auto it = m_directories.begin();
+  if (!relative_path->empty())
+  {
+    const auto self = m_directories.find(*relative_path);
+    if (self == m_directories.end())
+      return result;
+    add_files(self->first, self->second);
+    it = m_directories.lower_bound(*relative_path + DIR_SEP);
+  }
+  const std::string prefix = relative_path->empty() ? "" : *relative_path + DIR_SEP;
+  for (; it != m_directories.end() && it->first.starts_with(prefix); ++it)
+    add_files(it->first, it->second);
+
+  // Sorted like the results of 'Common::DoFileSearch()', which callers may depend on to resolve
+  // duplicates
+  std::ranges::sort(result, {}, &FoundFile::path);
+  return result;
+}
+
+std::optional<std::string> TexturePackManifest::GetRelativePath(const std::string& path) const
+{
+  if (!path.starts_with(m_root_directory))
+    return std::nullopt;
+
+  std::string_view relative_path = std::string_view(path).substr(m_root_directory.size());
+  if (!relative_path.empty() && relative_path.front() != DIR_SEP_CHR)
+    return std::nullopt;
+
+  while (!relative_path.empty() && relative_path.front() == DIR_SEP_CHR)
+    relative_path.remove_prefix(1);
+  while (!relative_path.empty() && relative_path.back() == DIR_SEP_CHR)
+    relative_path.remove_suffix(1);
+  return std::string(relative_path);
+}
+
+std::string TexturePackManifest::GetFullPath(const std::string& relative_path) const
+{
+  return relative_path.empty() ? m_root_directory : m_root_directory + DIR_SEP + relative_path;
+}
+}  // namespace VideoCommon
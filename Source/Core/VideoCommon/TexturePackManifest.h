@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace VideoCommon
+{
+// An index of the files below a texture pack directory, which is saved between runs so that the
+// directory tree doesn't have to be searched at every boot. Searching texture packs with hundreds
+// of thousands of files takes a long time on network drives.
+//
+// The manifest is brought up to date by checking the modification time of each directory, and
+// only searching the directories which changed. Adding, removing or renaming a file changes the
+// modification time of its directory, but overwriting a file in place doesn't, so the size and
+// dimensions of a file which was overwritten in place can be outdated.
+class TexturePackManifest
+{
+public:
+  enum class FileFormat : u8
+  {
+    Other,
+    PNG,
+    DDS,
+  };
+
+  struct FileInfo
+  {
+    std::string name;
+    u64 size = 0;
+    s64 mtime = 0;
+    FileFormat format = FileFormat::Other;
+    // Read from the header of PNG and DDS files, 0 if it couldn't be read
+    u32 width = 0;
+    u32 height = 0;
+  };
+
+  struct FoundFile
+  {
+    std::string path;
+    const FileInfo* info;
+  };
+
+  explicit TexturePackManifest(std::string root_directory);
+
+  // Fails if the file doesn't exist or is a manifest of another directory. Otherwise the loaded
+  // manifest still has to be brought up to date with 'Update()'.
+  bool Load(const std::string& manifest_path);
+  bool Save(const std::string& manifest_path) const;
+
+  // Searches the directories which changed since the manifest was saved. Returns whether any did.
+  bool Update();
+
+  const std::string& GetRootDirectory() const { return m_root_directory; }
+  bool HasDirectory(const std::string& path) const;
+
+  // Same as 'Common::DoFileSearch()' with a single directory below the root, recursive.
+  std::vector<FoundFile> FindFiles(const std::string& directory,
+                                   const std::vector<std::string>& extensions) const;
+
+private:
+  struct DirectoryInfo
+  {
+    s64 mtime = 0;
+    std::vector<std::string> subdirectories;
+    std::vector<FileInfo> files;
+  };
+
+  // Returns the path relative to the root, without separators at either end, or nothing if the
+  // path isn't below the root.
+  std::optional<std::string> GetRelativePath(const std::string& path) const;
+  std::string GetFullPath(const std::string& relative_path) const;
+
+  std::string m_root_directory;
+  // Indexed by the path relative to the root, which is empty for the root itself
+  std::map<std::string, DirectoryInfo> m_directories;
+};
+}  // namespace VideoCommon
@@ -23,6 +23,7 @@
 
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/IndexGenerator.h"
@@ -407,6 +408,7 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
   {
     // Doing early return for the opposite case would be cleaner
     // but triggers a false unreachable code warning in MSVC debug builds.
+    GPUThreadPartTimer timer(GPUThreadPart::VertexLoading);
 
     if (g_needs_cp_xf_consistency_check) [[unlikely]]
     {
@@ -440,6 +442,13 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     const bool cullall = (bpmem.genMode.cullmode == CullMode::All &&
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
+    // Until bounding box values have been read back from the GPU, they can be guessed from where
+    // the vertices end up on screen
+    const bool estimate_bbox = g_ActiveConfig.bBBoxAsyncReadback && g_ActiveConfig.bBBoxEnable &&
+                               g_ActiveConfig.backend_info.bSupportsBBox &&
+                               g_bounding_box->IsEnabled() && g_bounding_box->NeedsEstimate() &&
+                               !cullall;
+
     const int stride = loader->m_native_vtx_decl.stride;
     do
     {
@@ -452,6 +461,12 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
       const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
       src += loader->m_vertex_size * max_vertices;
 
+      if (estimate_bbox)
+      {
+        g_bounding_box->ExtendEstimate(
+            g_vertex_manager->GetScreenBounds(loader, primitive, dst.GetPointer(), num_loaded));
+      }
+
       if (can_cpu_cull && !cullall)
       {
         const bool all_culled =
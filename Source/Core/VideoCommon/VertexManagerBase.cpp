@@ -24,6 +24,7 @@
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUProfiler.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/CustomShaderCache.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
@@ -146,6 +147,13 @@ bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
   return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
 }
 
+MathUtil::Rectangle<int> VertexManagerBase::GetScreenBounds(VertexLoaderBase* loader,
+                                                            OpcodeDecoder::Primitive primitive,
+                                                            const u8* src, u32 count)
+{
+  return m_cpu_cull.GetScreenBounds(loader, primitive, src, count);
+}
+
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
                                                        u32 count, u32 stride, bool cullall)
 {
@@ -354,6 +362,7 @@ void VertexManagerBase::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 ba
     g_bounding_box->Flush();
   }
 
+  GPUProfiler::ScopedPass profiler_pass(GPUProfiler::Pass::Draw);
   g_gfx->DrawIndexed(base_index, num_indices, base_vertex);
 }
 
@@ -439,6 +448,7 @@ void VertexManagerBase::Flush()
     return;
 
   m_is_flushed = true;
+  GPUThreadPartTimer timer(GPUThreadPart::Drawing);
 
   if (m_draw_counter == 0)
   {
@@ -562,7 +572,7 @@ void VertexManagerBase::Flush()
   CalculateNormals(VertexLoaderManager::GetCurrentVertexFormat());
   // Calculate ZSlope for zfreeze
   const auto used_textures = UsedTextures();
-  std::vector<std::string> texture_names;
+  Common::SmallVector<u64, 8> texture_ids;
   Common::SmallVector<u32, 8> texture_units;
   std::array<SamplerState, 8> samplers;
   if (!m_cull_all)
@@ -586,9 +596,9 @@ void VertexManagerBase::Flush()
         const auto cache_entry = g_texture_cache->Load(TextureInfo::FromStage(i));
         if (cache_entry)
         {
-          if (!Common::Contains(texture_names, cache_entry->texture_info_name))
+          if (!Common::Contains(texture_ids, cache_entry->texture_info_id))
           {
-            texture_names.push_back(cache_entry->texture_info_name);
+            texture_ids.push_back(cache_entry->texture_info_id);
             texture_units.push_back(i);
           }
 
@@ -599,7 +609,7 @@ void VertexManagerBase::Flush()
       }
     }
   }
-  vertex_shader_manager.SetConstants(texture_names, xf_state_manager);
+  vertex_shader_manager.SetConstants(texture_ids, xf_state_manager);
   if (!bpmem.genMode.zfreeze)
   {
     // Must be done after VertexShaderManager::SetConstants()
@@ -615,21 +625,17 @@ void VertexManagerBase::Flush()
   {
     CustomPixelShaderContents custom_pixel_shader_contents;
     std::optional<CustomPixelShader> custom_pixel_shader;
-    std::vector<std::string> custom_pixel_texture_names;
     std::span<u8> custom_pixel_shader_uniforms;
     bool skip = false;
-    for (size_t i = 0; i < texture_names.size(); i++)
+    for (const u64 texture_id : texture_ids)
     {
       GraphicsModActionData::DrawStarted draw_started{texture_units, &skip, &custom_pixel_shader,
                                                       &custom_pixel_shader_uniforms};
-      for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_names[i]))
+      for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_id))
       {
         action->OnDrawStarted(&draw_started);
         if (custom_pixel_shader)
-        {
           custom_pixel_shader_contents.shaders.push_back(*custom_pixel_shader);
-          custom_pixel_texture_names.push_back(texture_names[i]);
-        }
         custom_pixel_shader = std::nullopt;
       }
     }
@@ -110,6 +110,9 @@ public:
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
+  MathUtil::Rectangle<int> GetScreenBounds(VertexLoaderBase* loader,
+                                           OpcodeDecoder::Primitive primitive, const u8* src,
+                                           u32 count);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
                                               u32 stride, bool cullall);
   /// Switch cullall off after a call to PrepareForAdditionalData with cullall true
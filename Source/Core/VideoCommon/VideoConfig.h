@@ -134,6 +134,8 @@ struct VideoConfig final
   float widescreen_heuristic_widescreen_ratio = 0.f;
   bool bCrop = false;  // Aspect ratio controls.
   bool bShaderCache = false;
+  // Size limit for each on-disk shader/pipeline cache file, in MiB. 0 means unlimited.
+  int iShaderCacheSizeLimitMB = 0;
 
   // Enhancements
   u32 iMultisamples = 0;
@@ -174,6 +176,7 @@ struct VideoConfig final
   bool bShowFTimes = false;
   bool bShowVPS = false;
   bool bShowVTimes = false;
+  bool bShowFramePacing = false;
   bool bShowGraphs = false;
   bool bShowSpeed = false;
   bool bShowSpeedColors = false;
@@ -183,6 +186,7 @@ struct VideoConfig final
   bool bOverlayStats = false;
   bool bOverlayProjStats = false;
   bool bOverlayScissorStats = false;
+  bool bGPUProfiler = false;
   bool bTexFmtOverlayEnable = false;
   bool bTexFmtOverlayCenter = false;
   bool bLogRenderTimeToFile = false;
@@ -210,6 +214,7 @@ struct VideoConfig final
       FrameDumpResolutionType::XFBAspectRatioCorrectedResolution;
   bool bBorderlessFullscreen = false;
   bool bEnableGPUTextureDecoding = false;
+  bool bAutoGPUTextureDecoding = false;
   bool bPreferVSForLinePointExpansion = false;
   int iBitrateKbps = 0;
   bool bGraphicMods = false;
@@ -218,8 +223,10 @@ struct VideoConfig final
   // Hacks
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
+  bool bEFBAccessDoubleBuffer = false;
   bool bPerfQueriesEnable = false;
   bool bBBoxEnable = false;
+  bool bBBoxAsyncReadback = false;
   bool bForceProgressive = false;
   bool bCPUCull = false;
 
@@ -275,6 +282,9 @@ struct VideoConfig final
 
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting = false;
+  // Number of cached pipelines, most used first, to wait for before starting.
+  // The rest are compiled in the background. 0 waits for all of them.
+  int iWaitForShadersPipelineCount = 0;
   ShaderCompilationMode iShaderCompilationMode{};
 
   // Number of shader compiler threads.
@@ -283,6 +293,16 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of texture decoding threads, in addition to the GPU thread.
+  // 0 decodes all textures on the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecodeThreads = 0;
+
+  // Number of threads which rasterize tiles of the EFB in the software renderer, in addition to
+  // the GPU thread. 0 rasterizes everything on the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iSWRasterizerThreads = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -368,6 +388,12 @@ struct VideoConfig final
   {
     return backend_info.bSupportsGPUTextureDecoding && bEnableGPUTextureDecoding;
   }
+  // Picks CPU or GPU decoding for each texture when GPU decoding isn't forced on.
+  bool UseAutoGPUTextureDecoding() const
+  {
+    return backend_info.bSupportsGPUTextureDecoding && !bEnableGPUTextureDecoding &&
+           bAutoGPUTextureDecoding;
+  }
   bool UseVertexRounding() const { return bVertexRounding && iEFBScale != 1; }
   bool ManualTextureSamplingWithCustomTextureSizes() const
   {
@@ -392,6 +418,8 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetTextureDecodeThreads() const;
+  u32 GetSWRasterizerThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
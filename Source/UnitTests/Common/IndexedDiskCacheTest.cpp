@@ -0,0 +1,199 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IndexedDiskCache.h"
+
+namespace
+{
+struct Key
+{
+  u32 id;
+  u32 variant;
+
+  bool operator<(const Key& other) const
+  {
+    return std::tie(id, variant) < std::tie(other.id, other.variant);
+  }
+};
+
+using Cache = Common::IndexedDiskCache<Key, u8>;
+
+class CollectingReader final : public Common::IndexedDiskCacheReader<Key, u8>
+{
+public:
+  void Read(const Key& key, const u8* value, u32 value_size) override
+  {
+    entries[key] = std::vector<u8>(value, value + value_size);
+  }
+
+  std::map<Key, std::vector<u8>> entries;
+};
+
+std::vector<u8> MakeValue(u32 seed, u32 size)
+{
+  std::vector<u8> value(size);
+  for (u32 i = 0; i < size; ++i)
+    value[i] = static_cast<u8>(seed * 31 + i);
+  return value;
+}
+
+void Append(Cache& cache, const Key& key, const std::vector<u8>& value)
+{
+  cache.Append(key, value.data(), static_cast<u32>(value.size()));
+}
+
+std::vector<u8> Lookup(Cache& cache, const Key& key)
+{
+  std::vector<u8> result;
+  cache.Lookup(key,
+               [&](const u8* value, u32 value_size) { result.assign(value, value + value_size); });
+  return result;
+}
+}  // namespace
+
+class IndexedDiskCacheTest : public testing::Test
+{
+protected:
+  IndexedDiskCacheTest()
+      : m_parent_directory(File::CreateTempDir()), m_file_path(m_parent_directory + "/test.cache")
+  {
+  }
+
+  ~IndexedDiskCacheTest() override
+  {
+    if (!m_parent_directory.empty())
+      File::DeleteDirRecursively(m_parent_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_parent_directory.empty())
+      FAIL();
+  }
+
+  const std::string m_parent_directory;
+  const std::string m_file_path;
+};
+
+TEST_F(IndexedDiskCacheTest, ReopenReadsAllEntries)
+{
+  {
+    Cache cache;
+    EXPECT_EQ(cache.Open(m_file_path), 0u);
+    for (u32 i = 0; i < 16; ++i)
+      Append(cache, {i, 0}, MakeValue(i, i * 7));
+  }
+
+  Cache cache;
+  CollectingReader reader;
+  EXPECT_EQ(cache.OpenAndRead(m_file_path, reader), 16u);
+  ASSERT_EQ(reader.entries.size(), 16u);
+  for (u32 i = 0; i < 16; ++i)
+  {
+    const Key key{i, 0};
+    EXPECT_EQ(reader.entries[key], MakeValue(i, i * 7));
+  }
+
+  EXPECT_EQ(Lookup(cache, {5, 0}), MakeValue(5, 35));
+  EXPECT_TRUE(cache.Contains({15, 0}));
+  EXPECT_FALSE(cache.Contains({16, 0}));
+}
+
+TEST_F(IndexedDiskCacheTest, RecoversEntriesWithoutIndex)
+{
+  {
+    Cache cache;
+    cache.Open(m_file_path);
+    for (u32 i = 0; i < 4; ++i)
+      Append(cache, {i, 0}, MakeValue(i, 100));
+  }
+
+  // Without the index, the data file is scanned, as it would be after a crash.
+  ASSERT_TRUE(File::Delete(m_file_path + ".idx"));
+
+  Cache cache;
+  EXPECT_EQ(cache.Open(m_file_path), 4u);
+  EXPECT_EQ(Lookup(cache, {3, 0}), MakeValue(3, 100));
+}
+
+TEST_F(IndexedDiskCacheTest, VersionChangeDiscardsEntries)
+{
+  {
+    Cache cache;
+    cache.Open(m_file_path, "version 1");
+    Append(cache, {1, 0}, MakeValue(1, 10));
+  }
+
+  {
+    Cache cache;
+    EXPECT_EQ(cache.Open(m_file_path, "version 1"), 1u);
+  }
+
+  Cache cache;
+  EXPECT_EQ(cache.Open(m_file_path, "version 2"), 0u);
+}
+
+TEST_F(IndexedDiskCacheTest, DuplicatesAreReplacedAndCompacted)
+{
+  constexpr u32 VALUE_SIZE = 64 * 1024;
+  {
+    Cache cache;
+    cache.Open(m_file_path);
+    for (u32 i = 0; i < 64; ++i)
+      Append(cache, {0, 0}, MakeValue(i, VALUE_SIZE));
+    Append(cache, {1, 0}, MakeValue(100, VALUE_SIZE));
+    EXPECT_EQ(cache.GetEntryCount(), 2u);
+    EXPECT_EQ(Lookup(cache, {0, 0}), MakeValue(63, VALUE_SIZE));
+  }
+  const u64 size_before = File::GetSize(m_file_path);
+
+  // Opening starts the compaction, and closing waits for it to finish.
+  {
+    Cache cache;
+    EXPECT_EQ(cache.Open(m_file_path), 2u);
+    EXPECT_GT(cache.GetDeadBytes(), 0u);
+    Append(cache, {2, 0}, MakeValue(200, VALUE_SIZE));
+  }
+  EXPECT_LT(File::GetSize(m_file_path), size_before / 8);
+
+  Cache cache;
+  EXPECT_EQ(cache.Open(m_file_path), 3u);
+  EXPECT_EQ(cache.GetDeadBytes(), 0u);
+  EXPECT_EQ(Lookup(cache, {0, 0}), MakeValue(63, VALUE_SIZE));
+  EXPECT_EQ(Lookup(cache, {1, 0}), MakeValue(100, VALUE_SIZE));
+  EXPECT_EQ(Lookup(cache, {2, 0}), MakeValue(200, VALUE_SIZE));
+}
+
+TEST_F(IndexedDiskCacheTest, SizeLimitEvictsLeastRecentlyUsed)
+{
+  constexpr u32 VALUE_SIZE = 1000;
+  {
+    Cache cache;
+    cache.Open(m_file_path);
+    for (u32 i = 0; i < 10; ++i)
+      Append(cache, {i, 0}, MakeValue(i, VALUE_SIZE));
+  }
+
+  // Use the first half of the entries in a later session, then shrink the cache to fit them.
+  {
+    Cache cache;
+    cache.Open(m_file_path);
+    for (u32 i = 0; i < 5; ++i)
+      cache.Touch({i, 0});
+    cache.SetSizeLimit(cache.GetLiveBytes() / 2);
+  }
+
+  Cache cache;
+  EXPECT_EQ(cache.Open(m_file_path), 5u);
+  for (u32 i = 0; i < 10; ++i)
+    EXPECT_EQ(cache.Contains({i, 0}), i < 5) << i;
+}
@@ -0,0 +1,133 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <picojson.h>
+
+#include "Common/FileUtil.h"
+#include "Common/JsonUtil.h"
+#include "Common/Thread.h"
+#include "Common/Trace.h"
+
+class TraceTest : public testing::Test
+{
+protected:
+  struct TracedEvent
+  {
+    double begin_us;
+    double end_us;
+    std::string thread_name;
+  };
+
+  TraceTest()
+      : m_parent_directory(File::CreateTempDir()), m_trace_path(m_parent_directory + "/trace.json")
+  {
+  }
+
+  ~TraceTest() override
+  {
+    if (!m_parent_directory.empty())
+      File::DeleteDirRecursively(m_parent_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_parent_directory.empty())
+      FAIL();
+  }
+
+  // Returns the events of the trace by name
+  std::map<std::string, TracedEvent> ReadTrace() const
+  {
+    picojson::value root;
+    std::string error;
+    if (!JsonFromFile(m_trace_path, &root, &error))
+    {
+      ADD_FAILURE() << error;
+      return {};
+    }
+
+    std::map<double, std::string> thread_names;
+    std::map<std::string, TracedEvent> events;
+    for (const picojson::value& value : root.get("traceEvents").get<picojson::array>())
+    {
+      const std::string& phase = value.get("ph").to_str();
+      const std::string& name = value.get("name").to_str();
+      if (phase == "M" && name == "thread_name")
+      {
+        thread_names[value.get("tid").get<double>()] = value.get("args").get("name").to_str();
+      }
+      else if (phase == "X")
+      {
+        const double begin_us = value.get("ts").get<double>();
+        events[name] = {begin_us, begin_us + value.get("dur").get<double>(),
+                        thread_names[value.get("tid").get<double>()]};
+      }
+    }
+    return events;
+  }
+
+  const std::string m_parent_directory;
+  const std::string m_trace_path;
+};
+
+TEST_F(TraceTest, RecordsNothingWhenStopped)
+{
+  {
+    TRACE_SCOPE("ignored");
+  }
+  EXPECT_FALSE(Common::Trace::IsRecording());
+  EXPECT_FALSE(Common::Trace::Stop(m_trace_path));
+  EXPECT_FALSE(File::Exists(m_trace_path));
+}
+
+TEST_F(TraceTest, RecordsEventsOfEachThread)
+{
+  Common::Trace::Start();
+  {
+    TRACE_SCOPE("outer");
+    {
+      TRACE_SCOPE("inner");
+    }
+  }
+  std::thread thread([] {
+    Common::SetCurrentThreadName("Trace test thread");
+    TRACE_SCOPE("worker");
+  });
+  thread.join();
+  ASSERT_TRUE(Common::Trace::Stop(m_trace_path));
+  EXPECT_FALSE(Common::Trace::IsRecording());
+
+  const auto events = ReadTrace();
+  ASSERT_EQ(events.size(), 3u);
+
+  const TracedEvent& outer = events.at("outer");
+  const TracedEvent& inner = events.at("inner");
+  EXPECT_LE(outer.begin_us, inner.begin_us);
+  EXPECT_GE(outer.end_us, inner.end_us);
+  EXPECT_EQ(outer.thread_name, inner.thread_name);
+  EXPECT_EQ(events.at("worker").thread_name, "Trace test thread");
+}
+
+TEST_F(TraceTest, DiscardsEventsOfPreviousTrace)
+{
+  Common::Trace::Start();
+  {
+    TRACE_SCOPE("first");
+  }
+  ASSERT_TRUE(Common::Trace::Stop(m_trace_path));
+
+  Common::Trace::Start();
+  {
+    TRACE_SCOPE("second");
+  }
+  ASSERT_TRUE(Common::Trace::Stop(m_trace_path));
+
+  const auto events = ReadTrace();
+  EXPECT_EQ(events.size(), 1u);
+  EXPECT_TRUE(events.contains("second"));
+}
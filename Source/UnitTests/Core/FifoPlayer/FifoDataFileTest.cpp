@@ -0,0 +1,143 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+
+namespace
+{
+// Large enough for the data to be shared between updates
+constexpr size_t LARGE_DATA_SIZE = 64 * 1024;
+
+std::vector<u8> MakeData(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+    byte = static_cast<u8>(rng());
+  return data;
+}
+
+MemoryUpdate MakeUpdate(u32 fifo_position, u32 address, std::vector<u8> data)
+{
+  MemoryUpdate update;
+  update.fifoPosition = fifo_position;
+  update.address = address;
+  update.data = std::move(data);
+  update.type = MemoryUpdate::Type::TextureMap;
+  return update;
+}
+
+void ExpectSameFrame(const FifoFrameInfo& frame, const FifoFrameInfo& expected)
+{
+  EXPECT_EQ(frame.fifoData, expected.fifoData);
+  EXPECT_EQ(frame.fifoStart, expected.fifoStart);
+  EXPECT_EQ(frame.fifoEnd, expected.fifoEnd);
+  ASSERT_EQ(frame.memoryUpdates.size(), expected.memoryUpdates.size());
+  for (size_t i = 0; i < frame.memoryUpdates.size(); ++i)
+  {
+    const MemoryUpdate& update = frame.memoryUpdates[i];
+    const MemoryUpdate& expected_update = expected.memoryUpdates[i];
+    EXPECT_EQ(update.fifoPosition, expected_update.fifoPosition);
+    EXPECT_EQ(update.address, expected_update.address);
+    EXPECT_EQ(update.type, expected_update.type);
+    EXPECT_EQ(update.data, expected_update.data) << "update " << i;
+  }
+}
+}  // namespace
+
+TEST(FifoDataFile, ReadsBackWrittenFrames)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/test.dff";
+
+  const std::vector<u8> texture_a = MakeData(LARGE_DATA_SIZE, 1);
+  const std::vector<u8> texture_b = MakeData(LARGE_DATA_SIZE, 2);
+
+  std::vector<FifoFrameInfo> frames(3);
+  frames[0].fifoData = MakeData(100, 3);
+  frames[0].memoryUpdates.push_back(MakeUpdate(0, 0x1000, MakeData(16, 4)));
+  frames[0].memoryUpdates.push_back(MakeUpdate(10, 0x2000, texture_a));
+  frames[0].memoryUpdates.push_back(MakeUpdate(20, 0x3000, texture_b));
+  frames[1].fifoData = MakeData(50, 5);
+  frames[1].fifoStart = 0x100;
+  frames[1].fifoEnd = 0x200;
+  frames[1].memoryUpdates.push_back(MakeUpdate(5, 0x2000, texture_a));
+  frames[1].memoryUpdates.push_back(MakeUpdate(6, 0x1000, MakeData(16, 6)));
+  frames[2].fifoData = MakeData(10, 7);
+  frames[2].memoryUpdates.push_back(MakeUpdate(0, 0x3000, texture_b));
+  frames[2].memoryUpdates.push_back(MakeUpdate(1, 0x4000, texture_a));
+
+  FifoDataFile file;
+  file.SetIsWii(true);
+  for (const FifoFrameInfo& frame : frames)
+    file.AddFrame(frame);
+  ASSERT_TRUE(file.Save(path));
+
+  // Each large payload is only written once
+  EXPECT_LT(File::GetSize(path), FifoDataFile::TEX_MEM_SIZE + 3 * LARGE_DATA_SIZE);
+
+  std::unique_ptr<FifoDataFile> loaded = FifoDataFile::Load(path, false);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_TRUE(loaded->GetIsWii());
+  ASSERT_EQ(loaded->GetFrameCount(), frames.size());
+  for (u32 i = 0; i < loaded->GetFrameCount(); ++i)
+  {
+    const std::shared_ptr<const FifoFrameInfo> frame = loaded->GetFrame(i);
+    ASSERT_NE(frame, nullptr);
+    ExpectSameFrame(*frame, frames[i]);
+  }
+
+  loaded.reset();
+  File::DeleteDirRecursively(directory);
+}
+
+TEST(FifoDataFile, SharesFifoData)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/test.dff";
+
+  FifoDataFile file;
+  for (u32 i = 0; i < 2; ++i)
+  {
+    FifoFrameInfo frame;
+    frame.fifoData = MakeData(100, i);
+    file.AddFrame(std::move(frame));
+  }
+  ASSERT_TRUE(file.Save(path));
+
+  // Frames in memory aren't copied
+  const std::shared_ptr<const std::vector<u8>> in_memory = file.GetFifoData(1);
+  ASSERT_NE(in_memory, nullptr);
+  EXPECT_EQ(in_memory->data(), file.GetFrame(1)->fifoData.data());
+
+  std::unique_ptr<FifoDataFile> loaded = FifoDataFile::Load(path, false);
+  ASSERT_NE(loaded, nullptr);
+  const std::shared_ptr<const std::vector<u8>> fifo_data = loaded->GetFifoData(0);
+  ASSERT_NE(fifo_data, nullptr);
+  EXPECT_EQ(*fifo_data, file.GetFrame(0)->fifoData);
+
+  // The FIFO data which was read last is kept
+  EXPECT_EQ(loaded->GetFifoData(0), fifo_data);
+  const std::shared_ptr<const std::vector<u8>> other_fifo_data = loaded->GetFifoData(1);
+  ASSERT_NE(other_fifo_data, nullptr);
+  EXPECT_EQ(*other_fifo_data, *in_memory);
+
+  // Frames in the cache are shared with it
+  const std::shared_ptr<const FifoFrameInfo> frame = loaded->GetFrame(0);
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(loaded->GetFifoData(0)->data(), frame->fifoData.data());
+
+  loaded.reset();
+  File::DeleteDirRecursively(directory);
+}
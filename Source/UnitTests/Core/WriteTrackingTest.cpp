@@ -0,0 +1,81 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/ScopeGuard.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/MemTools.h"
+#include "Core/System.h"
+
+#ifdef _MSC_VER
+#define ASAN_DISABLE __declspec(no_sanitize_address)
+#else
+#define ASAN_DISABLE
+#endif
+
+// Stores through the fastmem view like JIT code does, so that watched pages fault.
+static void ASAN_DISABLE StoreByte(u8* pointer, u8 value)
+{
+  *static_cast<volatile u8*>(pointer) = value;
+}
+
+TEST(WriteTracking, FaultBetweenWatchAndCheck)
+{
+  if (!EMM::IsExceptionHandlerSupported())
+    GTEST_SKIP() << "Write tracking requires fault handling.";
+
+  Config::Init();
+  Config::SetCurrent(Config::GFX_HACK_TEXTURE_WRITE_TRACKING, true);
+  Core::DeclareAsCPUThread();
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  memory.Init();
+  Common::ScopeGuard guard([&memory] {
+    memory.ShutdownFastmemArena();
+    memory.Shutdown();
+    Core::UndeclareAsCPUThread();
+    Config::Shutdown();
+  });
+  if (!memory.IsWriteTrackingEnabled())
+    GTEST_SKIP() << "Write tracking is not supported on this platform.";
+  ASSERT_TRUE(memory.InitFastmemArena());
+
+  EMM::InstallExceptionHandler();
+  Common::ScopeGuard handler_guard([] { EMM::UninstallExceptionHandler(); });
+
+  constexpr u32 ADDRESS = 0x10000;
+  u8* const view = memory.GetPhysicalBase() + ADDRESS;
+
+  const u64 stamp = memory.WatchRange(ADDRESS, 4);
+  ASSERT_NE(stamp, 0u);
+  EXPECT_FALSE(memory.WasRangeWritten(ADDRESS, 4, stamp));
+
+  // The store faults once, and is retried once the page was unprotected.
+  StoreByte(view, 1);
+  EXPECT_EQ(memory.GetRAM()[ADDRESS], 1);
+  EXPECT_TRUE(memory.WasRangeWritten(ADDRESS, 4, stamp));
+
+  // The fault left the page unprotected, so watching the range again has to protect it again.
+  const u64 second_stamp = memory.WatchRange(ADDRESS, 4);
+  EXPECT_GT(second_stamp, stamp);
+  EXPECT_FALSE(memory.WasRangeWritten(ADDRESS, 4, second_stamp));
+  StoreByte(view + 1, 2);
+  EXPECT_EQ(memory.GetRAM()[ADDRESS + 1], 2);
+  EXPECT_TRUE(memory.WasRangeWritten(ADDRESS, 4, second_stamp));
+
+  // Watching a page which is still protected doesn't fault, and stores to other pages aren't
+  // counted.
+  const u64 third_stamp = memory.WatchRange(ADDRESS, 4);
+  const u64 fourth_stamp = memory.WatchRange(ADDRESS, 4);
+  EXPECT_GT(fourth_stamp, third_stamp);
+  StoreByte(view + 0x10000, 3);
+  EXPECT_FALSE(memory.WasRangeWritten(ADDRESS, 4, third_stamp));
+  StoreByte(view + 2, 4);
+  EXPECT_TRUE(memory.WasRangeWritten(ADDRESS, 4, third_stamp));
+  EXPECT_TRUE(memory.WasRangeWritten(ADDRESS, 4, fourth_stamp));
+}
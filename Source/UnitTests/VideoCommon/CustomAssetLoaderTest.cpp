@@ -0,0 +1,148 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/CustomAssetLoader.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+
+namespace
+{
+using VideoCommon::CustomAssetLibrary;
+using VideoCommon::CustomAssetLoader;
+using VideoCommon::GameTextureAsset;
+
+constexpr u32 TEXTURE_SIZE = 256;
+constexpr std::size_t TEXTURE_BYTES = TEXTURE_SIZE * TEXTURE_SIZE * 4;
+
+// Serves RGBA8 textures of TEXTURE_SIZE and counts how often each one was loaded.
+class TestLibrary final : public CustomAssetLibrary
+{
+public:
+  LoadInfo LoadTexture(const AssetID& asset_id, VideoCommon::TextureData* data) override
+  {
+    {
+      std::lock_guard lk(m_lock);
+      ++m_load_counts[asset_id];
+    }
+
+    data->m_type = VideoCommon::TextureData::Type::Type_Texture2D;
+    auto& level = data->m_texture.m_slices.emplace_back().m_levels.emplace_back();
+    level.width = TEXTURE_SIZE;
+    level.height = TEXTURE_SIZE;
+    level.row_length = TEXTURE_SIZE;
+    level.data.resize(TEXTURE_BYTES);
+    return LoadInfo{TEXTURE_BYTES, TimeType{std::chrono::seconds{1}}};
+  }
+
+  TimeType GetLastAssetWriteTime(const AssetID&) const override
+  {
+    return TimeType{std::chrono::seconds{1}};
+  }
+
+  LoadInfo LoadPixelShader(const AssetID&, VideoCommon::PixelShaderData*) override { return {}; }
+  LoadInfo LoadMaterial(const AssetID&, VideoCommon::MaterialData*) override { return {}; }
+  LoadInfo LoadMesh(const AssetID&, VideoCommon::MeshData*) override { return {}; }
+
+  int GetLoadCount(const AssetID& asset_id)
+  {
+    std::lock_guard lk(m_lock);
+    return m_load_counts[asset_id];
+  }
+
+private:
+  std::mutex m_lock;
+  std::map<AssetID, int> m_load_counts;
+};
+
+class CustomAssetLoaderTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    Config::Init();
+    // Room for four textures
+    Config::SetCurrent(Config::GFX_CUSTOM_TEXTURE_MEMORY_BUDGET_MB, 1);
+    m_loader.Init();
+  }
+
+  void TearDown() override
+  {
+    m_loader.Shutdown();
+    Config::Shutdown();
+  }
+
+  std::shared_ptr<GameTextureAsset>
+  Stream(const std::string& asset_id,
+         CustomAssetLoader::LoadPriority priority = CustomAssetLoader::LoadPriority::Normal)
+  {
+    return m_loader.StreamGameTexture(asset_id, m_library, priority);
+  }
+
+  std::shared_ptr<TestLibrary> m_library = std::make_shared<TestLibrary>();
+  CustomAssetLoader m_loader;
+};
+}  // namespace
+
+TEST_F(CustomAssetLoaderTest, UnloadsLeastRecentlyRequestedTextures)
+{
+  std::shared_ptr<GameTextureAsset> textures[4];
+  for (int i = 0; i < 4; ++i)
+  {
+    textures[i] = Stream(std::to_string(i));
+    m_loader.WaitForLoads();
+  }
+  for (const auto& texture : textures)
+    EXPECT_NE(texture->GetData(), nullptr);
+  EXPECT_EQ(m_loader.GetStreamingStats().textures_unloaded, 0u);
+
+  // Using the first texture again makes the second one the least recently used.
+  Stream("0");
+  const auto fifth = Stream("4");
+  m_loader.WaitForLoads();
+
+  EXPECT_NE(fifth->GetData(), nullptr);
+  EXPECT_NE(textures[0]->GetData(), nullptr);
+  EXPECT_EQ(textures[1]->GetData(), nullptr);
+  EXPECT_NE(textures[2]->GetData(), nullptr);
+  EXPECT_EQ(m_loader.GetStreamingStats().textures_unloaded, 1u);
+  EXPECT_LE(m_loader.GetStreamingStats().bytes_loaded, 4 * TEXTURE_BYTES);
+
+  // Requesting an unloaded texture loads it again.
+  EXPECT_EQ(Stream("1"), textures[1]);
+  m_loader.WaitForLoads();
+  EXPECT_NE(textures[1]->GetData(), nullptr);
+  EXPECT_EQ(m_library->GetLoadCount("1"), 2);
+}
+
+TEST_F(CustomAssetLoaderTest, PrefetchesOnlyWithinBudget)
+{
+  std::shared_ptr<GameTextureAsset> textures[6];
+  for (int i = 0; i < 6; ++i)
+  {
+    textures[i] = Stream(std::to_string(i), CustomAssetLoader::LoadPriority::Prefetch);
+    m_loader.WaitForLoads();
+  }
+
+  int loaded = 0;
+  for (const auto& texture : textures)
+    loaded += texture->GetData() != nullptr;
+  EXPECT_EQ(loaded, 4);
+  EXPECT_EQ(m_loader.GetStreamingStats().textures_unloaded, 0u);
+
+  // Using a texture which didn't fit loads it by unloading a prefetched one.
+  Stream("5");
+  m_loader.WaitForLoads();
+  EXPECT_NE(textures[5]->GetData(), nullptr);
+  EXPECT_EQ(m_loader.GetStreamingStats().textures_unloaded, 1u);
+}
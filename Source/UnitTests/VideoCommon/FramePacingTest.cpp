@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/FramePacing.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Frames presented every 10 ms with a latency of 1 ms, except for every 20th frame, which is late
+void AddFrames(FramePacingTracker& tracker, int count)
+{
+  TimePoint time{};
+  for (int i = 0; i < count; i++)
+  {
+    time += i % 20 == 19 ? 30ms : 10ms;
+
+    FrameTiming timing;
+    timing.emulated_time = i * 10ms;
+    timing.cpu_finish = time - 1ms;
+    timing.gpu_submit = time - 1ms;
+    timing.present_call = time - 500us;
+    timing.present_return = time;
+    tracker.AddFrame(timing);
+  }
+}
+}  // namespace
+
+TEST(FramePacing, Percentiles)
+{
+  FramePacingTracker tracker;
+  EXPECT_EQ(tracker.GetSummary().num_frames, 0u);
+
+  AddFrames(tracker, 101);
+  const FramePacingTracker::Summary summary = tracker.GetSummary();
+  EXPECT_EQ(summary.num_frames, 101u);
+  EXPECT_EQ(summary.frame_time.p50, DT(10ms));
+  EXPECT_EQ(summary.frame_time.p95, DT(10ms));
+  EXPECT_EQ(summary.frame_time.p99, DT(30ms));
+  EXPECT_EQ(summary.latency.p50, DT(1ms));
+  EXPECT_EQ(summary.latency.p99, DT(1ms));
+
+  tracker.Reset();
+  EXPECT_EQ(tracker.GetSummary().num_frames, 0u);
+}
+
+TEST(FramePacing, KeepsOnlyRecentFrames)
+{
+  FramePacingTracker tracker;
+  AddFrames(tracker, 10000);
+  EXPECT_EQ(tracker.GetSummary().num_frames, 4096u);
+}
+
+TEST(FramePacing, WritesCSV)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/pacing.csv";
+
+  FramePacingTracker tracker;
+  AddFrames(tracker, 3);
+  ASSERT_TRUE(tracker.WriteCSV(path));
+
+  std::string contents;
+  ASSERT_TRUE(File::ReadFileToString(path, contents));
+  File::DeleteDirRecursively(directory);
+
+  const std::vector<std::string> lines = SplitString(contents, '\n');
+  ASSERT_EQ(lines.size(), 4u);
+  EXPECT_EQ(lines[0], "frame,emulated_time_ms,cpu_finish_ms,gpu_submit_ms,present_call_ms,"
+                      "present_return_ms,frame_time_ms,latency_ms");
+  EXPECT_EQ(lines[1], "0,0.000,0.000,0.000,0.500,1.000,,1.000");
+  EXPECT_EQ(lines[2], "1,10.000,10.000,10.000,10.500,11.000,10.000,1.000");
+}
@@ -0,0 +1,251 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/EfbInterface.h"
+#include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/Rasterizer.h"
+#include "VideoBackends/Software/Tev.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
+#include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/XFMemory.h"
+
+namespace
+{
+using Triangle = std::array<OutputVertexData, 3>;
+
+// Sets up a render state which blends the vertex colors with depth testing.
+void SetUpRenderState()
+{
+  std::memset(static_cast<void*>(&bpmem), 0, sizeof(bpmem));
+  std::memset(static_cast<void*>(&xfmem), 0, sizeof(xfmem));
+
+  bpmem.genMode.numcolchans = 1;
+  bpmem.tevorders[0].colorchan_even = RasColorChan::Color0;
+  auto& color = bpmem.combiners[0].colorC;
+  color.a = TevColorArg::Zero;
+  color.b = TevColorArg::Zero;
+  color.c = TevColorArg::Zero;
+  color.d = TevColorArg::RasColor;
+  auto& alpha = bpmem.combiners[0].alphaC;
+  alpha.a = TevAlphaArg::Zero;
+  alpha.b = TevAlphaArg::Zero;
+  alpha.c = TevAlphaArg::Zero;
+  alpha.d = TevAlphaArg::RasAlpha;
+
+  bpmem.alpha_test.comp0 = CompareMode::Always;
+  bpmem.alpha_test.comp1 = CompareMode::Always;
+  bpmem.zmode.testenable = true;
+  bpmem.zmode.func = CompareMode::LEqual;
+  bpmem.zmode.updateenable = true;
+  bpmem.blendmode.blendenable = true;
+  bpmem.blendmode.colorupdate = true;
+  bpmem.blendmode.alphaupdate = true;
+  bpmem.blendmode.srcfactor = SrcBlendFactor::SrcAlpha;
+  bpmem.blendmode.dstfactor = DstBlendFactor::InvSrcAlpha;
+
+  // The GX SDK adds 342 to the scissor rectangle and offset.
+  bpmem.scissorTL.x = 342;
+  bpmem.scissorTL.y = 342;
+  bpmem.scissorBR.x = 342 + EFB_WIDTH - 1;
+  bpmem.scissorBR.y = 342 + EFB_HEIGHT - 1;
+  bpmem.scissorOffset.x = 342 / 2;
+  bpmem.scissorOffset.y = 342 / 2;
+  xfmem.viewport.wd = EFB_WIDTH / 2;
+  xfmem.viewport.ht = -static_cast<float>(EFB_HEIGHT / 2);
+  xfmem.viewport.xOrig = 342 + EFB_WIDTH / 2;
+  xfmem.viewport.yOrig = 342 + EFB_HEIGHT / 2;
+  Rasterizer::ScissorChanged();
+}
+
+// Makes a scene of mostly small triangles, with a few covering large parts of the EFB.
+std::vector<Triangle> MakeScene(u32 num_triangles)
+{
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> x_dist(0.0f, EFB_WIDTH);
+  std::uniform_real_distribution<float> y_dist(0.0f, EFB_HEIGHT);
+  std::uniform_real_distribution<float> z_dist(0.0f, 16777215.0f);
+  std::uniform_int_distribution<u32> color_dist(0, 255);
+
+  std::vector<Triangle> scene(num_triangles);
+  for (u32 i = 0; i < num_triangles; ++i)
+  {
+    const float size = i % 16 == 0 ? 400.0f : 40.0f;
+    const float x = x_dist(rng);
+    const float y = y_dist(rng);
+    for (OutputVertexData& vertex : scene[i])
+    {
+      vertex.screenPosition = {x + x_dist(rng) / EFB_WIDTH * size,
+                               y + y_dist(rng) / EFB_HEIGHT * size, z_dist(rng)};
+      vertex.projectedPosition.w = 1.0f;
+      for (u8& component : vertex.color[0])
+        component = static_cast<u8>(color_dist(rng));
+    }
+
+    // The rasterizer only draws triangles with one winding.
+    const Vec3& p0 = scene[i][0].screenPosition;
+    const Vec3& p1 = scene[i][1].screenPosition;
+    const Vec3& p2 = scene[i][2].screenPosition;
+    if ((p1.x - p0.x) * (p2.y - p0.y) - (p1.y - p0.y) * (p2.x - p0.x) > 0.0f)
+      std::swap(scene[i][1], scene[i][2]);
+  }
+  return scene;
+}
+
+void ClearEFB()
+{
+  std::array<u8, 4> clear_color = {0, 0, 0, 0};
+  for (u16 y = 0; y < EFB_HEIGHT; ++y)
+  {
+    for (u16 x = 0; x < EFB_WIDTH; ++x)
+    {
+      EfbInterface::SetColor(x, y, clear_color.data());
+      EfbInterface::SetDepth(x, y, 0xFFFFFF);
+    }
+  }
+}
+
+// Draws the scene in batches of the given size with the given number of rasterizer threads.
+void DrawScene(const std::vector<Triangle>& scene, u32 batch_size, int num_threads)
+{
+  g_ActiveConfig.iSWRasterizerThreads = num_threads;
+  for (size_t first = 0; first < scene.size(); first += batch_size)
+  {
+    Rasterizer::BeginBatch();
+    const size_t last = std::min(scene.size(), first + batch_size);
+    for (size_t i = first; i < last; ++i)
+      Rasterizer::DrawTriangleFrontFace(&scene[i][0], &scene[i][1], &scene[i][2]);
+    Rasterizer::EndBatch();
+  }
+}
+
+std::vector<u32> ReadEFB()
+{
+  std::vector<u32> values;
+  values.reserve(EFB_WIDTH * EFB_HEIGHT * 2);
+  for (u16 y = 0; y < EFB_HEIGHT; ++y)
+  {
+    for (u16 x = 0; x < EFB_WIDTH; ++x)
+    {
+      values.push_back(EfbInterface::GetColor(x, y));
+      values.push_back(EfbInterface::GetDepth(x, y));
+    }
+  }
+  return values;
+}
+
+std::array<u32, PQ_NUM_MEMBERS> ReadPerfQueries()
+{
+  std::array<u32, PQ_NUM_MEMBERS> values;
+  for (size_t i = 0; i < values.size(); ++i)
+    values[i] = EfbInterface::GetPerfQueryResult(static_cast<PerfQueryType>(i));
+  return values;
+}
+}  // namespace
+
+TEST(SWRasterizer, ThreadsMatchSingleThread)
+{
+  SetUpRenderState();
+  const std::vector<Triangle> scene = MakeScene(2000);
+
+  ClearEFB();
+  const std::vector<u32> cleared = ReadEFB();
+  EfbInterface::ResetPerfQuery();
+  DrawScene(scene, 100, 0);
+  const std::vector<u32> expected = ReadEFB();
+  const std::array<u32, PQ_NUM_MEMBERS> expected_perf = ReadPerfQueries();
+  ASSERT_NE(expected, cleared);
+  ASSERT_NE(expected_perf[PQ_BLEND_INPUT], 0u);
+
+  for (const int num_threads : {1, 3, 7})
+  {
+    ClearEFB();
+    EfbInterface::ResetPerfQuery();
+    DrawScene(scene, 100, num_threads);
+    const std::vector<u32> drawn = ReadEFB();
+    const auto mismatch = std::ranges::mismatch(drawn, expected).in1;
+    EXPECT_EQ(mismatch, drawn.end())
+        << fmt::format("{} threads: pixel {} differs", num_threads, (mismatch - drawn.begin()) / 2);
+    EXPECT_EQ(ReadPerfQueries(), expected_perf) << fmt::format("{} threads", num_threads);
+  }
+
+  Rasterizer::Shutdown();
+}
+
+TEST(SWRasterizer, BatchesLargerThanTheBins)
+{
+  // Batches of more triangles than fit in the bins are drawn in several passes, with the pipeline
+  // of the batch in use by every pass.
+  SetUpRenderState();
+  const std::vector<Triangle> scene = MakeScene(10000);
+
+  ClearEFB();
+  DrawScene(scene, 100, 0);
+  const std::vector<u32> expected = ReadEFB();
+
+  const Tev::Pipeline& pipeline = Tev::GetPipeline(GetTevPipelineUid());
+  ClearEFB();
+  DrawScene(scene, static_cast<u32>(scene.size()), 3);
+  EXPECT_EQ(ReadEFB(), expected);
+  EXPECT_EQ(&Tev::GetPipeline(GetTevPipelineUid()), &pipeline);
+
+  Rasterizer::Shutdown();
+}
+
+TEST(SWTev, PipelinesOnlyDependOnStagesInUse)
+{
+  SetUpRenderState();
+  const TevPipelineUid uid = GetTevPipelineUid();
+  const Tev::Pipeline& pipeline = Tev::GetPipeline(uid);
+
+  // Only the first stage is in use.
+  bpmem.combiners[1].colorC.op = TevOp::Sub;
+  bpmem.tevind[1].bs = IndTexBumpAlpha::S;
+  EXPECT_EQ(GetTevPipelineUid(), uid);
+  EXPECT_EQ(&Tev::GetPipeline(GetTevPipelineUid()), &pipeline);
+
+  bpmem.combiners[0].colorC.op = TevOp::Sub;
+  EXPECT_NE(GetTevPipelineUid(), uid);
+  EXPECT_NE(&Tev::GetPipeline(GetTevPipelineUid()), &pipeline);
+
+  bpmem.genMode.numtevstages = 1;
+  EXPECT_NE(GetTevPipelineUid(), uid);
+
+  Tev::ClearPipelineCache();
+}
+
+TEST(SWRasterizer, BatchSizesMatchSingleThread)
+{
+  // The threads wait for each other at the end of each batch, so both long and short batches must
+  // draw the same scene as a single thread.
+  SetUpRenderState();
+  const std::vector<Triangle> scene = MakeScene(4000);
+
+  ClearEFB();
+  DrawScene(scene, 1000, 0);
+  const std::vector<u32> expected = ReadEFB();
+
+  for (const u32 batch_size : {1000u, 20u})
+  {
+    for (const int num_threads : {1, 3, 7})
+    {
+      ClearEFB();
+      DrawScene(scene, batch_size, num_threads);
+      EXPECT_EQ(ReadEFB(), expected)
+          << fmt::format("Batches of {} triangles, {} threads", batch_size, num_threads);
+    }
+  }
+
+  Rasterizer::Shutdown();
+}
@@ -0,0 +1,146 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Prints how long it takes to decode each texture format at a few sizes, with each instruction set
+// the decoders can use and with the decode pool. This isn't part of the unit tests, as the timings
+// depend on the machine and don't have anything to check against.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecodePool.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr std::array<TextureFormat, 11> ALL_FORMATS = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4, TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR};
+
+constexpr std::array<std::pair<int, int>, 3> SIZES = {{{128, 128}, {512, 512}, {1024, 1024}}};
+
+// Large enough for the palette of C14X2 textures.
+constexpr size_t TLUT_SIZE = 16384 * sizeof(u16);
+
+// Each size is decoded until roughly this many texels have been decoded.
+constexpr u64 TEXELS_PER_MEASUREMENT = 64 * 1024 * 1024;
+
+std::vector<u8> MakeData(size_t size, u32 seed)
+{
+  std::vector<u8> data(size);
+  u32 state = seed;
+  for (u8& byte : data)
+  {
+    state = state * 1103515245 + 12345;
+    byte = static_cast<u8>(state >> 16);
+  }
+  return data;
+}
+
+// Restricts the texture decoders to the given instruction sets while in scope.
+class ScopedSIMDLevel
+{
+public:
+  ScopedSIMDLevel(bool avx2, bool ssse3)
+      : m_avx2(std::exchange(cpu_info.bAVX2, avx2 && cpu_info.bAVX2)),
+        m_ssse3(std::exchange(cpu_info.bSSSE3, ssse3 && cpu_info.bSSSE3))
+  {
+  }
+  ~ScopedSIMDLevel()
+  {
+    cpu_info.bAVX2 = m_avx2;
+    cpu_info.bSSSE3 = m_ssse3;
+  }
+
+private:
+  bool m_avx2;
+  bool m_ssse3;
+};
+
+struct SIMDLevel
+{
+  const char* name;
+  bool avx2;
+  bool ssse3;
+};
+constexpr std::array<SIMDLevel, 3> ALL_SIMD_LEVELS = {
+    {{"baseline", false, false}, {"SSSE3", false, true}, {"AVX2", true, true}}};
+
+// Returns the average time it takes to run the decode function once, in microseconds.
+template <typename DecodeFunction>
+double Measure(int width, int height, DecodeFunction decode)
+{
+  const u64 iterations =
+      std::max<u64>(TEXELS_PER_MEASUREMENT / (static_cast<u64>(width) * height), 1);
+
+  // Warm up the caches and wake up any worker threads first.
+  decode();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (u64 i = 0; i < iterations; ++i)
+    decode();
+  const std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / iterations;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const u32 num_workers = argc > 1 ? static_cast<u32>(std::strtoul(argv[1], nullptr, 10)) :
+                                     std::max(std::thread::hardware_concurrency(), 2u) - 1;
+  VideoCommon::TextureDecodePool pool;
+  pool.Start(num_workers);
+
+  const std::vector<u8> tlut = MakeData(TLUT_SIZE, 42);
+  fmt::print("Decode pool workers: {}\n", num_workers);
+  fmt::print("Times are in microseconds. The decode pool uses every instruction set.\n");
+  fmt::print("{:<10} {:>10}", "format", "size");
+  for (const SIMDLevel& level : ALL_SIMD_LEVELS)
+    fmt::print(" {:>10}", level.name);
+  fmt::print(" {:>10}\n", "pool");
+
+  for (const TextureFormat format : ALL_FORMATS)
+  {
+    for (const auto& [width, height] : SIZES)
+    {
+      const std::vector<u8> src =
+          MakeData(TexDecoder_GetTextureSizeInBytes(width, height, format), width + height);
+      std::vector<u8> dst(static_cast<size_t>(width) * height * sizeof(u32));
+      const auto decode = [&] {
+        TexDecoder_Decode(dst.data(), src.data(), width, height, format, tlut.data(),
+                          TLUTFormat::RGB5A3);
+      };
+      const auto decode_in_pool = [&] {
+        pool.Decode(dst.data(), src.data(), width, height, format, tlut.data(),
+                    TLUTFormat::RGB5A3);
+      };
+
+      fmt::print("{:<10} {:>10}", fmt::format("{}", format), fmt::format("{}x{}", width, height));
+      for (const SIMDLevel& level : ALL_SIMD_LEVELS)
+      {
+        if ((level.avx2 && !cpu_info.bAVX2) || (level.ssse3 && !cpu_info.bSSSE3))
+        {
+          fmt::print(" {:>10}", "n/a");
+          continue;
+        }
+
+        const ScopedSIMDLevel scoped_level(level.avx2, level.ssse3);
+        fmt::print(" {:>10.1f}", Measure(width, height, decode));
+      }
+      fmt::print(" {:>10.1f}\n", Measure(width, height, decode_in_pool));
+    }
+  }
+
+  return 0;
+}
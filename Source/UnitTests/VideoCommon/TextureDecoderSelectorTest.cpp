@@ -0,0 +1,70 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoderSelector.h"
+
+namespace
+{
+using Selector = VideoCommon::TextureDecoderSelector;
+using Path = Selector::Path;
+using std::chrono::microseconds;
+
+// Decodes textures with the paths the selector picks, which take the given times, and returns how
+// many of the last RETIME_INTERVAL textures were decoded on the GPU.
+u32 RunTextures(Selector& selector, TextureFormat format, u32 num_texels, microseconds cpu_time,
+                microseconds gpu_time)
+{
+  u32 gpu_count = 0;
+  for (u32 i = 0; i < 10 * Selector::RETIME_INTERVAL; ++i)
+  {
+    const Path path = selector.Select(format, num_texels);
+    selector.ReportTime(path, format, num_texels, path == Path::GPU ? gpu_time : cpu_time);
+    if (i >= 9 * Selector::RETIME_INTERVAL && path == Path::GPU)
+      gpu_count++;
+  }
+  return gpu_count;
+}
+}  // namespace
+
+TEST(TextureDecoderSelector, GuessesBeforeTimings)
+{
+  Selector selector;
+  EXPECT_EQ(selector.Select(TextureFormat::RGBA8, 64 * 64), Path::CPU);
+  EXPECT_EQ(selector.Select(TextureFormat::RGBA8, 1024 * 1024), Path::GPU);
+  EXPECT_EQ(selector.Select(TextureFormat::C8, 64 * 64), Path::GPU);
+}
+
+TEST(TextureDecoderSelector, FollowsTimings)
+{
+  Selector selector;
+
+  // Both go against the guess, and still only retime the slower path once per interval.
+  EXPECT_EQ(RunTextures(selector, TextureFormat::I8, 64 * 64, microseconds(100), microseconds(10)),
+            Selector::RETIME_INTERVAL - 1);
+  EXPECT_EQ(RunTextures(selector, TextureFormat::CMPR, 512 * 512, microseconds(100),
+                        microseconds(1000)),
+            1u);
+
+  // Each format and size class is timed on its own.
+  EXPECT_EQ(selector.Select(TextureFormat::I8, 1024 * 1024), Path::GPU);
+  EXPECT_EQ(selector.Select(TextureFormat::CMPR, 64 * 64), Path::CPU);
+  EXPECT_EQ(selector.Select(TextureFormat::RGB565, 64 * 64), Path::CPU);
+}
+
+TEST(TextureDecoderSelector, AdaptsWhenTimingsChange)
+{
+  Selector selector;
+  EXPECT_EQ(RunTextures(selector, TextureFormat::C4, 128 * 128, microseconds(50), microseconds(20)),
+            Selector::RETIME_INTERVAL - 1);
+  EXPECT_EQ(RunTextures(selector, TextureFormat::C4, 128 * 128, microseconds(50), microseconds(80)),
+            1u);
+
+  selector.Reset();
+  EXPECT_EQ(selector.Select(TextureFormat::C4, 128 * 128), Path::GPU);
+}
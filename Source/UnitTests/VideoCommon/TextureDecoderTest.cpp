@@ -0,0 +1,226 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecodePool.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr std::array<TextureFormat, 11> ALL_FORMATS = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4, TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR};
+
+constexpr std::array<TLUTFormat, 3> ALL_TLUT_FORMATS = {TLUTFormat::IA8, TLUTFormat::RGB565,
+                                                         TLUTFormat::RGB5A3};
+
+// Large enough for the palette of C14X2 textures.
+constexpr size_t TLUT_SIZE = 16384 * sizeof(u16);
+
+std::vector<u8> MakeData(size_t size, u32 seed)
+{
+  std::vector<u8> data(size);
+  u32 state = seed;
+  for (u8& byte : data)
+  {
+    state = state * 1103515245 + 12345;
+    byte = static_cast<u8>(state >> 16);
+  }
+  return data;
+}
+
+struct TestTexture
+{
+  TestTexture(TextureFormat format_, int width_, int height_,
+              TLUTFormat tlut_format_ = TLUTFormat::RGB5A3)
+      : format(format_), tlut_format(tlut_format_), width(width_), height(height_),
+        src(MakeData(TexDecoder_GetTextureSizeInBytes(width, height, format), width + height)),
+        tlut(MakeData(TLUT_SIZE, 42))
+  {
+  }
+
+  std::vector<u8> Decode() const
+  {
+    std::vector<u8> dst(static_cast<size_t>(width) * height * sizeof(u32));
+    TexDecoder_Decode(dst.data(), src.data(), width, height, format, tlut.data(), tlut_format);
+    return dst;
+  }
+
+  std::vector<u8> Decode(VideoCommon::TextureDecodePool& pool) const
+  {
+    std::vector<u8> dst(static_cast<size_t>(width) * height * sizeof(u32));
+    pool.Decode(dst.data(), src.data(), width, height, format, tlut.data(), tlut_format);
+    return dst;
+  }
+
+  // Decodes every texel on its own, which doesn't share any code with the texture decoders.
+  std::vector<u8> DecodeTexels() const
+  {
+    std::vector<u8> dst(static_cast<size_t>(width) * height * sizeof(u32));
+    for (int t = 0; t < height; ++t)
+    {
+      for (int s = 0; s < width; ++s)
+      {
+        TexDecoder_DecodeTexel(&dst[(static_cast<size_t>(t) * width + s) * sizeof(u32)], src, s, t,
+                               width - 1, format, tlut, tlut_format);
+      }
+    }
+    return dst;
+  }
+
+  TextureFormat format;
+  TLUTFormat tlut_format;
+  int width;
+  int height;
+  std::vector<u8> src;
+  std::vector<u8> tlut;
+};
+
+// Restricts the texture decoders to the given instruction sets while in scope.
+class ScopedSIMDLevel
+{
+public:
+  ScopedSIMDLevel(bool avx2, bool ssse3)
+      : m_avx2(std::exchange(cpu_info.bAVX2, avx2 && cpu_info.bAVX2)),
+        m_ssse3(std::exchange(cpu_info.bSSSE3, ssse3 && cpu_info.bSSSE3))
+  {
+  }
+  ~ScopedSIMDLevel()
+  {
+    cpu_info.bAVX2 = m_avx2;
+    cpu_info.bSSSE3 = m_ssse3;
+  }
+
+private:
+  bool m_avx2;
+  bool m_ssse3;
+};
+
+struct SIMDLevel
+{
+  const char* name;
+  bool avx2;
+  bool ssse3;
+};
+constexpr std::array<SIMDLevel, 3> ALL_SIMD_LEVELS = {
+    {{"baseline", false, false}, {"SSSE3", false, true}, {"AVX2", true, true}}};
+}  // namespace
+
+TEST(TextureDecoder, MatchesTexelDecoder)
+{
+  // Covers both sides of the size thresholds for decoding the palette up front.
+  constexpr std::array<std::pair<int, int>, 3> SIZES = {{{8, 8}, {64, 32}, {128, 128}}};
+  for (const SIMDLevel& level : ALL_SIMD_LEVELS)
+  {
+    const ScopedSIMDLevel scoped_level(level.avx2, level.ssse3);
+    for (const TextureFormat format : ALL_FORMATS)
+    {
+      for (const TLUTFormat tlut_format : ALL_TLUT_FORMATS)
+      {
+        // Only paletted formats use the TLUT format.
+        if (!IsColorIndexed(format) && tlut_format != TLUTFormat::RGB5A3)
+          continue;
+
+        for (const auto& [width, height] : SIZES)
+        {
+          const TestTexture texture(format, width, height, tlut_format);
+          const std::vector<u8> decoded = texture.Decode();
+          const std::vector<u8> expected = texture.DecodeTexels();
+          const auto mismatch = std::ranges::mismatch(decoded, expected).in1;
+          EXPECT_EQ(mismatch, decoded.end())
+              << fmt::format("{} {} {}x{} {}: texel {} differs", level.name, format, width, height,
+                             tlut_format, (mismatch - decoded.begin()) / sizeof(u32));
+        }
+      }
+    }
+  }
+}
+
+TEST(TextureDecodePool, MatchesSerialDecoding)
+{
+  VideoCommon::TextureDecodePool pool;
+  pool.Start(3);
+
+  // Sizes which decode in one go, in a few strips, and in strips of single block rows.
+  constexpr std::array<std::pair<int, int>, 4> SIZES = {
+      {{64, 64}, {512, 512}, {1024, 1024}, {16384, 16}}};
+  for (const TextureFormat format : ALL_FORMATS)
+  {
+    for (const auto& [width, height] : SIZES)
+    {
+      const TestTexture texture(format, width, height);
+      EXPECT_EQ(texture.Decode(pool), texture.Decode()) << fmt::format("{} {}x{}", format, width,
+                                                                       height);
+    }
+  }
+}
+
+TEST(TextureDecodePool, DecodesTmemPreloadsAhead)
+{
+  VideoCommon::TextureDecodePool pool;
+  pool.Start(1);
+
+  constexpr u32 TMEM_ADDRESS = 0x8000;
+  const TestTexture texture(TextureFormat::CMPR, 256, 256);
+  const std::vector<u8> expected = texture.Decode();
+  std::vector<u8> dst(expected.size());
+  const auto decode_from_tmem = [&](const std::vector<u8>& src) {
+    return pool.DecodeFromTmem(TMEM_ADDRESS, dst.data(), src.data(), texture.width,
+                               texture.height, texture.format, nullptr, TLUTFormat::IA8);
+  };
+
+  // The first load only tells the pool what to expect at the address.
+  pool.OnTmemPreload(TMEM_ADDRESS, texture.src.data(), static_cast<u32>(texture.src.size()));
+  EXPECT_FALSE(decode_from_tmem(texture.src));
+  EXPECT_EQ(dst, expected);
+
+  // Preloads which the worker hasn't started on yet are decoded on the calling thread instead, so
+  // let it finish this one.
+  pool.OnTmemPreload(TMEM_ADDRESS, texture.src.data(), static_cast<u32>(texture.src.size()));
+  pool.WaitForPreloads();
+  EXPECT_TRUE(decode_from_tmem(texture.src));
+  EXPECT_EQ(dst, expected);
+
+  // Data which was overwritten after the preload must be decoded again.
+  TestTexture changed_texture = texture;
+  changed_texture.src[100] ^= 0xFF;
+  pool.OnTmemPreload(TMEM_ADDRESS, texture.src.data(), static_cast<u32>(texture.src.size()));
+  EXPECT_FALSE(decode_from_tmem(changed_texture.src));
+  EXPECT_EQ(dst, changed_texture.Decode());
+}
+
+TEST(TextureDecoder, LargeTexturesMatchAcrossDecoders)
+{
+  // Large textures take the paths that decode in strips and with the palette decoded up front, so
+  // every instruction set and the decode pool must agree with the baseline decoder on them too.
+  constexpr int SIZE = 1024;
+  VideoCommon::TextureDecodePool pool;
+  pool.Start(3);
+
+  for (const TextureFormat format : ALL_FORMATS)
+  {
+    const TestTexture texture(format, SIZE, SIZE);
+    std::vector<u8> expected;
+    {
+      const ScopedSIMDLevel scoped_level(false, false);
+      expected = texture.Decode();
+    }
+
+    for (const SIMDLevel& level : ALL_SIMD_LEVELS)
+    {
+      const ScopedSIMDLevel scoped_level(level.avx2, level.ssse3);
+      EXPECT_EQ(texture.Decode(), expected) << fmt::format("{} {}", level.name, format);
+    }
+    EXPECT_EQ(texture.Decode(pool), expected) << fmt::format("decode pool {}", format);
+  }
+}
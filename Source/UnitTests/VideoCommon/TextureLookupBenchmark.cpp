@@ -0,0 +1,129 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Replays a synthetic trace of texture loads against the texture lookup index and against the
+// address map walk it replaced, and prints how long both took. This isn't part of the unit tests,
+// as the timings depend on the machine and don't have anything to check against.
+
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureLookupIndex.h"
+
+namespace
+{
+using Index = VideoCommon::TextureLookupIndex<u32>;
+
+constexpr u32 NUM_TEXTURES = 2000;
+
+// A recorded texture load: the unit it was bound to, and the parameters used for the lookup.
+struct TextureLookup
+{
+  u32 unit;
+  u32 address;
+  u64 hash;
+};
+
+u32 GetAddress(u32 texture)
+{
+  // Some addresses hold several textures, like fonts with different palettes.
+  return 0x80000000 + (texture / 4) * 0x8000;
+}
+
+u64 GetHash(u32 texture)
+{
+  return 0x9E3779B97F4A7C15ull * texture;
+}
+
+// Approximates the texture loads of a frame: most draws reuse the textures of the previous draw
+// on the same unit.
+std::vector<TextureLookup> MakeLookupTrace(u32 num_lookups)
+{
+  std::vector<TextureLookup> trace;
+  trace.reserve(num_lookups);
+  u32 state = 12345;
+  const auto next = [&state] {
+    state = state * 1103515245 + 12345;
+    return state >> 8;
+  };
+
+  std::vector<u32> current(Index::NUM_UNITS);
+  for (u32 i = 0; i < num_lookups; ++i)
+  {
+    const u32 unit = next() % 4;
+    if (next() % 8 == 0)
+      current[unit] = next() % NUM_TEXTURES;
+
+    const u32 texture = current[unit];
+    trace.push_back({unit, GetAddress(texture), GetHash(texture)});
+  }
+  return trace;
+}
+
+template <typename LookupFunction>
+u64 MeasureUs(const std::vector<TextureLookup>& trace, u64* sum, LookupFunction lookup)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (const TextureLookup& entry : trace)
+    *sum += lookup(entry);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const u32 num_lookups =
+      argc > 1 ? static_cast<u32>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+  const std::vector<TextureLookup> trace = MakeLookupTrace(num_lookups);
+
+  struct Entry
+  {
+    u64 hash;
+    u32 id;
+  };
+  std::multimap<u32, Entry> by_address;
+  Index index;
+  for (u32 texture = 0; texture < NUM_TEXTURES; ++texture)
+  {
+    by_address.emplace(GetAddress(texture), Entry{GetHash(texture), texture});
+    index.Insert(Index::MakeKey(GetAddress(texture), TextureFormat::RGBA8, TLUTFormat::IA8,
+                                GetHash(texture)),
+                 texture);
+  }
+
+  // The sums keep the lookups from being optimized out, and must match.
+  u64 map_sum = 0;
+  const u64 map_us = MeasureUs(trace, &map_sum, [&](const TextureLookup& lookup) -> u32 {
+    const auto range = by_address.equal_range(lookup.address);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      if (iter->second.hash == lookup.hash)
+        return iter->second.id;
+    }
+    return 0;
+  });
+
+  u64 index_sum = 0;
+  const u64 index_us = MeasureUs(trace, &index_sum, [&](const TextureLookup& lookup) -> u32 {
+    const u32* id = index.Find(
+        Index::MakeKey(lookup.address, TextureFormat::RGBA8, TLUTFormat::IA8, lookup.hash),
+        lookup.unit);
+    return id ? *id : 0;
+  });
+
+  fmt::print("{} lookups: address map {} us, index {} us\n", trace.size(), map_us, index_us);
+  if (map_sum != index_sum)
+  {
+    fmt::print("The index returned different textures than the address map\n");
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,192 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureLookupIndex.h"
+
+namespace
+{
+using Index = VideoCommon::TextureLookupIndex<u32>;
+
+Index::Key MakeKey(u32 address, u64 hash, TextureFormat format = TextureFormat::RGBA8,
+                   TLUTFormat tlut_format = TLUTFormat::IA8)
+{
+  return Index::MakeKey(address, format, tlut_format, hash);
+}
+
+// A recorded texture load: the unit it was bound to, and the parameters used for the lookup.
+struct TextureLookup
+{
+  u32 unit;
+  u32 address;
+  u64 hash;
+};
+
+// Approximates the texture loads of a frame: most draws reuse the textures of the previous draw
+// on the same unit, and some addresses hold several textures, like fonts with different palettes.
+std::vector<TextureLookup> MakeLookupTrace(u32 num_textures, u32 num_lookups)
+{
+  std::vector<TextureLookup> trace;
+  trace.reserve(num_lookups);
+  u32 state = 12345;
+  const auto next = [&state] {
+    state = state * 1103515245 + 12345;
+    return state >> 8;
+  };
+
+  std::vector<u32> current(Index::NUM_UNITS);
+  for (u32 i = 0; i < num_lookups; ++i)
+  {
+    const u32 unit = next() % 4;
+    if (next() % 8 == 0)
+      current[unit] = next() % num_textures;
+
+    const u32 texture = current[unit];
+    trace.push_back({unit, 0x80000000 + (texture / 4) * 0x8000, 0x9E3779B97F4A7C15ull * texture});
+  }
+  return trace;
+}
+}  // namespace
+
+TEST(TextureLookupIndex, InsertFindRemove)
+{
+  Index index;
+  EXPECT_EQ(index.Find(MakeKey(0x1000, 1), 0), nullptr);
+
+  EXPECT_TRUE(index.Insert(MakeKey(0x1000, 1), 10));
+  EXPECT_TRUE(index.Insert(MakeKey(0x1000, 2), 20));
+  EXPECT_FALSE(index.Insert(MakeKey(0x1000, 1), 30));
+  EXPECT_EQ(index.GetSize(), 2u);
+
+  ASSERT_NE(index.Find(MakeKey(0x1000, 1), 0), nullptr);
+  EXPECT_EQ(*index.Find(MakeKey(0x1000, 1), 0), 10u);
+  EXPECT_EQ(*index.Find(MakeKey(0x1000, 2), 0), 20u);
+  EXPECT_EQ(index.Find(MakeKey(0x2000, 1), 0), nullptr);
+
+  // Removing requires the indexed value, so removing a duplicate keeps the original.
+  index.Remove(MakeKey(0x1000, 1), 30);
+  EXPECT_NE(index.Find(MakeKey(0x1000, 1), 0), nullptr);
+  index.Remove(MakeKey(0x1000, 1), 10);
+  EXPECT_EQ(index.Find(MakeKey(0x1000, 1), 0), nullptr);
+  EXPECT_EQ(index.GetSize(), 1u);
+
+  index.Clear();
+  EXPECT_EQ(index.Find(MakeKey(0x1000, 2), 0), nullptr);
+}
+
+TEST(TextureLookupIndex, TlutFormatOnlyMattersForPalettes)
+{
+  Index index;
+  index.Insert(MakeKey(0x1000, 1, TextureFormat::C8, TLUTFormat::IA8), 1);
+  index.Insert(MakeKey(0x2000, 1, TextureFormat::I8, TLUTFormat::IA8), 2);
+
+  EXPECT_EQ(index.Find(MakeKey(0x1000, 1, TextureFormat::C8, TLUTFormat::RGB565), 0), nullptr);
+  EXPECT_NE(index.Find(MakeKey(0x2000, 1, TextureFormat::I8, TLUTFormat::RGB565), 0), nullptr);
+  EXPECT_EQ(index.Find(MakeKey(0x2000, 1, TextureFormat::I4), 0), nullptr);
+}
+
+TEST(TextureLookupIndex, MatchesMapAfterManyRemovals)
+{
+  // Growing and backward shift deletion move entries between slots, which must not break probing
+  // or let a stale last hit return the wrong entry.
+  Index index;
+  std::map<u32, u32> reference;
+  for (u32 i = 0; i < 4000; ++i)
+  {
+    const u32 texture = (i * 7919) % 1000;
+    const Index::Key key = MakeKey(texture & ~3u, texture);
+    if (reference.contains(texture))
+    {
+      index.Remove(key, reference[texture]);
+      reference.erase(texture);
+    }
+    else
+    {
+      EXPECT_TRUE(index.Insert(key, i));
+      reference[texture] = i;
+    }
+
+    const u32 probe = (i * 31) % 1000;
+    const u32* found = index.Find(MakeKey(probe & ~3u, probe), i % Index::NUM_UNITS);
+    if (reference.contains(probe))
+    {
+      ASSERT_NE(found, nullptr) << i;
+      EXPECT_EQ(*found, reference[probe]) << i;
+    }
+    else
+    {
+      EXPECT_EQ(found, nullptr) << i;
+    }
+  }
+  EXPECT_EQ(index.GetSize(), reference.size());
+}
+
+TEST(TextureLookupIndex, CountsCopies)
+{
+  Index index;
+  EXPECT_FALSE(index.HasCopies(0x1000));
+  index.AddCopy(0x1000);
+  index.AddCopy(0x1000);
+  index.AddCopy(0x2000);
+  index.RemoveCopy(0x1000);
+  EXPECT_TRUE(index.HasCopies(0x1000));
+  index.RemoveCopy(0x1000);
+  EXPECT_FALSE(index.HasCopies(0x1000));
+  EXPECT_TRUE(index.HasCopies(0x2000));
+}
+
+TEST(TextureLookupIndex, ReplayedLookupsMatchAddressMap)
+{
+  // Replays the same lookups against the address multimap walk that the texture cache used to do
+  // for every load, and against the index.
+  constexpr u32 NUM_TEXTURES = 2000;
+  const std::vector<TextureLookup> trace = MakeLookupTrace(NUM_TEXTURES, 20000);
+
+  struct Entry
+  {
+    u64 hash;
+    u32 id;
+  };
+  std::multimap<u32, Entry> by_address;
+  Index index;
+  for (u32 texture = 0; texture < NUM_TEXTURES; ++texture)
+  {
+    const u32 address = 0x80000000 + (texture / 4) * 0x8000;
+    const u64 hash = 0x9E3779B97F4A7C15ull * texture;
+    by_address.emplace(address, Entry{hash, texture});
+    index.Insert(MakeKey(address, hash), texture);
+  }
+
+  u32 num_found = 0;
+  u32 num_mismatches = 0;
+  for (const TextureLookup& lookup : trace)
+  {
+    std::optional<u32> expected;
+    const auto range = by_address.equal_range(lookup.address);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      if (iter->second.hash == lookup.hash)
+      {
+        expected = iter->second.id;
+        break;
+      }
+    }
+
+    const u32* id = index.Find(MakeKey(lookup.address, lookup.hash), lookup.unit);
+    const std::optional<u32> actual = id ? std::optional<u32>(*id) : std::nullopt;
+    if (actual != expected)
+      num_mismatches++;
+    if (expected)
+      num_found++;
+  }
+
+  EXPECT_NE(num_found, 0u);
+  EXPECT_EQ(num_mismatches, 0u);
+}
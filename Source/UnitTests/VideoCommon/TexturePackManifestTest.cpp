@@ -0,0 +1,129 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Swap.h"
+#include "VideoCommon/TexturePackManifest.h"
+
+using VideoCommon::TexturePackManifest;
+
+class TexturePackManifestTest : public testing::Test
+{
+protected:
+  TexturePackManifestTest()
+      : m_parent_directory(File::CreateTempDir()), m_root(m_parent_directory + "/Textures"),
+        m_manifest_path(m_parent_directory + "/test.manifest")
+  {
+  }
+
+  ~TexturePackManifestTest() override
+  {
+    if (!m_parent_directory.empty())
+      File::DeleteDirRecursively(m_parent_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_parent_directory.empty())
+      FAIL();
+
+    File::CreateFullPath(m_root + "/GAMEID/sub/");
+    File::CreateFullPath(m_root + "/other/");
+    WritePNG(m_root + "/GAMEID/tex1_64x64_a.png", 128, 64);
+    WritePNG(m_root + "/GAMEID/sub/tex1_32x32_b.PNG", 32, 32);
+    File::WriteStringToFile(m_root + "/GAMEID/GAMEID.txt", "");
+    File::WriteStringToFile(m_root + "/other/tex1_8x8_c.dds", "not a dds");
+
+    // Modification times are coarse, so changes made by the tests wouldn't be noticed otherwise
+    const auto past = std::filesystem::file_time_type::clock::now() - std::chrono::hours{1};
+    for (const char* directory : {"", "/GAMEID", "/GAMEID/sub", "/other"})
+      std::filesystem::last_write_time(m_root + directory, past);
+  }
+
+  static void WritePNG(const std::string& path, u32 width, u32 height)
+  {
+    constexpr std::array<u8, 16> signature = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n',
+                                              0,    0,   0,   13,  'I',  'H',  'D',  'R'};
+    const std::array<u32, 2> dimensions = {Common::swap32(width), Common::swap32(height)};
+    File::IOFile file(path, "wb");
+    file.WriteArray(signature);
+    file.WriteArray(dimensions);
+  }
+
+  static std::vector<std::string> GetPaths(const std::vector<TexturePackManifest::FoundFile>& files)
+  {
+    std::vector<std::string> paths;
+    for (const auto& file : files)
+      paths.push_back(file.path);
+    return paths;
+  }
+
+  const std::string m_parent_directory;
+  const std::string m_root;
+  const std::string m_manifest_path;
+};
+
+TEST_F(TexturePackManifestTest, FindsFilesLikeFileSearch)
+{
+  TexturePackManifest manifest(m_root);
+  EXPECT_TRUE(manifest.Update());
+  EXPECT_FALSE(manifest.Update());
+
+  EXPECT_TRUE(manifest.HasDirectory(m_root + "/GAMEID"));
+  EXPECT_FALSE(manifest.HasDirectory(m_root + "/GAME"));
+
+  const auto files = manifest.FindFiles(m_root + "/GAMEID", {".png", ".dds"});
+  EXPECT_EQ(GetPaths(files), (std::vector<std::string>{m_root + "/GAMEID/sub/tex1_32x32_b.PNG",
+                                                       m_root + "/GAMEID/tex1_64x64_a.png"}));
+  ASSERT_EQ(files.size(), 2u);
+  EXPECT_EQ(files[1].info->format, TexturePackManifest::FileFormat::PNG);
+  EXPECT_EQ(files[1].info->width, 128u);
+  EXPECT_EQ(files[1].info->height, 64u);
+
+  EXPECT_EQ(GetPaths(manifest.FindFiles(m_root, {".txt"})),
+            std::vector<std::string>{m_root + "/GAMEID/GAMEID.txt"});
+
+  // Files with an unreadable header have no size
+  const auto dds_files = manifest.FindFiles(m_root + "/other", {".dds"});
+  ASSERT_EQ(dds_files.size(), 1u);
+  EXPECT_EQ(dds_files[0].info->width, 0u);
+}
+
+TEST_F(TexturePackManifestTest, UpdatesChangedDirectoriesAfterLoading)
+{
+  {
+    TexturePackManifest manifest(m_root);
+    manifest.Update();
+    ASSERT_TRUE(manifest.Save(m_manifest_path));
+  }
+
+  TexturePackManifest other_root(m_parent_directory);
+  EXPECT_FALSE(other_root.Load(m_manifest_path));
+
+  TexturePackManifest manifest(m_root);
+  ASSERT_TRUE(manifest.Load(m_manifest_path));
+  EXPECT_FALSE(manifest.Update());
+  EXPECT_EQ(manifest.FindFiles(m_root, {}).size(), 4u);
+
+  File::Delete(m_root + "/GAMEID/sub/tex1_32x32_b.PNG");
+  File::DeleteDirRecursively(m_root + "/other");
+  WritePNG(m_root + "/GAMEID/sub/tex1_16x16_d.png", 16, 32);
+  EXPECT_TRUE(manifest.Update());
+
+  const auto files = manifest.FindFiles(m_root, {".png"});
+  ASSERT_EQ(GetPaths(files), (std::vector<std::string>{m_root + "/GAMEID/sub/tex1_16x16_d.png",
+                                                       m_root + "/GAMEID/tex1_64x64_a.png"}));
+  EXPECT_EQ(files[0].info->height, 32u);
+  EXPECT_EQ(files[1].info->width, 128u);
+  EXPECT_FALSE(manifest.HasDirectory(m_root + "/other"));
+}
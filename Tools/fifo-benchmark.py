@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+
+'''
+Replays FIFO logs with the benchmark mode of dolphin-emu-nogui on backends which don't need a GPU,
+and compares the results against a baseline to catch performance regressions.
+
+Usage:
+    fifo-benchmark.py --dolphin build/Binaries/dolphin-emu-nogui --logs fifologs \\
+        --baseline baseline.json
+
+Run with --update-baseline on a known good build to write the baseline in the first place.
+'''
+
+import argparse
+import json
+import pathlib
+import subprocess
+import sys
+import tempfile
+
+BACKENDS = {
+    "Null": "Null",
+    "Software": "Software Renderer",
+}
+
+PARTS = ["opcode_decoding", "vertex_loading", "texture_decoding", "drawing"]
+
+# Per-frame times below this are mostly noise, so they are never reported as regressions.
+MIN_COMPARED_MS = 0.05
+
+
+def run_benchmark(args, log: pathlib.Path, backend: str) -> dict:
+    with tempfile.TemporaryDirectory() as temp_dir:
+        report_path = pathlib.Path(temp_dir) / "report.json"
+        command = [
+            args.dolphin,
+            "--platform=headless",
+            f"--video_backend={BACKENDS[backend]}",
+            f"--benchmark_frames={args.frames}",
+            f"--benchmark_warmup={args.warmup}",
+            f"--benchmark_report={report_path}",
+            "--user", str(pathlib.Path(temp_dir) / "User"),
+            "--exec", str(log),
+        ]
+        try:
+            subprocess.run(command, check=True, timeout=args.timeout,
+                           stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        except subprocess.CalledProcessError as e:
+            raise RuntimeError(f"exited with {e.returncode}: {e.stderr.decode(errors='replace')}")
+        except subprocess.TimeoutExpired:
+            raise RuntimeError(f"timed out after {args.timeout} seconds")
+
+        report = json.loads(report_path.read_text())
+
+    frames = report["frames"]
+    result = {"fps": report["fps"]}
+    for part in PARTS:
+        result[f"{part}_ms"] = report["gpu_thread_part_ms"][part] / frames
+    return result
+
+
+def compare(result: dict, baseline: dict, tolerance: float) -> list:
+    regressions = []
+    if result["fps"] < baseline["fps"] * (1.0 - tolerance):
+        regressions.append(f"fps {baseline['fps']:.1f} -> {result['fps']:.1f}")
+    for part in PARTS:
+        key = f"{part}_ms"
+        if key not in baseline or max(result[key], baseline[key]) < MIN_COMPARED_MS:
+            continue
+        if result[key] > baseline[key] * (1.0 + tolerance):
+            regressions.append(f"{key} {baseline[key]:.3f} -> {result[key]:.3f}")
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--dolphin", required=True, help="Path to dolphin-emu-nogui")
+    parser.add_argument("--logs", required=True, type=pathlib.Path,
+                        help="Directory with the .dff FIFO logs to replay")
+    parser.add_argument("--backends", default="Null,Software",
+                        help="Comma separated video backends to replay the logs with")
+    parser.add_argument("--frames", type=int, default=600, help="Number of frames to time")
+    parser.add_argument("--warmup", type=int, default=60,
+                        help="Number of frames to run before timing")
+    parser.add_argument("--timeout", type=int, default=600,
+                        help="Seconds after which a replay counts as failed")
+    parser.add_argument("--baseline", type=pathlib.Path, help="Baseline JSON to compare against")
+    parser.add_argument("--tolerance", type=float, default=0.1,
+                        help="Fraction by which results may be worse than the baseline")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="Write the results to the baseline instead of comparing")
+    parser.add_argument("--output", type=pathlib.Path, help="Write the results to this JSON file")
+    args = parser.parse_args()
+    if args.update_baseline and not args.baseline:
+        parser.error("--update-baseline needs --baseline")
+
+    backends = args.backends.split(",")
+    for backend in backends:
+        if backend not in BACKENDS:
+            parser.error(f"unknown backend {backend}, expected one of {', '.join(BACKENDS)}")
+
+    logs = sorted(args.logs.glob("*.dff"))
+    if not logs:
+        parser.error(f"no .dff files in {args.logs}")
+
+    baseline = {}
+    if args.baseline and args.baseline.exists() and not args.update_baseline:
+        baseline = json.loads(args.baseline.read_text())
+
+    results = {}
+    failed = False
+    print(f"{'Log':<40} {'Backend':<10} {'FPS':>8} " +
+          " ".join(f"{part:>16}" for part in PARTS))
+    for log in logs:
+        for backend in backends:
+            name = f"{log.stem}/{backend}"
+            try:
+                result = run_benchmark(args, log, backend)
+            except RuntimeError as e:
+                print(f"{log.stem:<40} {backend:<10} FAILED: {e}")
+                failed = True
+                continue
+
+            results[name] = result
+            print(f"{log.stem:<40} {backend:<10} {result['fps']:>8.1f} " +
+                  " ".join(f"{result[f'{part}_ms']:>13.3f} ms" for part in PARTS))
+
+            if name in baseline:
+                regressions = compare(result, baseline[name], args.tolerance)
+                for regression in regressions:
+                    print(f"  REGRESSION: {regression}")
+                failed = failed or bool(regressions)
+
+    if args.output:
+        args.output.write_text(json.dumps(results, indent=2, sort_keys=True) + "\n")
+    if args.update_baseline:
+        args.baseline.write_text(json.dumps(results, indent=2, sort_keys=True) + "\n")
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())